@@ -33,6 +33,9 @@ format_map = {
       'BF16' : np.float16,
     }
 
+# layouts in which the blob memory has the same order as its dims
+planar_layouts = ["NCHW", "NCDHW", "CHW", "HW", "NC", "C", "SCALAR"]
+
 layout_str_to_enum = {'ANY': C.Layout.ANY,
                       "NHWC": C.Layout.NHWC,
                       "NCHW": C.Layout.NCHW,
@@ -32,13 +32,17 @@ cdef class InferRequest:
 
     cpdef BlobBuffer _get_blob_buffer(self, const string & blob_name)
 
-    cpdef infer(self, inputs = ?)
-    cpdef async_infer(self, inputs = ?)
+    cpdef infer(self, inputs = ?, share_inputs = ?)
+    cpdef async_infer(self, inputs = ?, share_inputs = ?)
     cpdef wait(self, timeout = ?)
     cpdef get_perf_counts(self)
     cdef void user_callback(self, int status) with gil
     cdef public:
-        _inputs_list, _outputs_list, _py_callback, _py_data, _py_callback_used, _py_callback_called, _user_blobs
+        _inputs_list, _outputs_list, _py_callback, _py_data, _py_callback_used, _py_callback_called, _user_blobs, _bound_inputs
+
+cdef class AsyncInferQueue:
+    cdef public:
+        _exec_net, _requests, _callback, _userdata, _lock
 
 cdef class IENetwork:
     cdef C.IENetwork impl
@@ -26,7 +26,7 @@ from collections import OrderedDict, namedtuple
 from .cimport ie_api_impl_defs as C
 from .ie_api_impl_defs cimport SizeVector, Precision
 from .constants import WaitMode, StatusCode, MeanVariant, layout_str_to_enum, format_map, layout_int_to_str_map,\
-    known_plugins, supported_precisions, ResizeAlgorithm, ColorFormat
+    known_plugins, supported_precisions, ResizeAlgorithm, ColorFormat, planar_layouts
 
 import numpy as np
 
@@ -953,11 +953,18 @@ cdef class ExecutableNetwork:
     #                  If not specified, `timeout` value is set to -1 by default.
     #  @return Request status code: OK or RESULT_NOT_READY
     cpdef wait(self, num_requests=None, timeout=None):
+        cdef int c_num_requests
+        cdef int64_t c_timeout
+        cdef int status
         if num_requests is None:
             num_requests = len(self.requests)
         if timeout is None:
             timeout = WaitMode.RESULT_READY
-        return deref(self.impl).wait(<int> num_requests, <int64_t> timeout)
+        c_num_requests = num_requests
+        c_timeout = timeout
+        with nogil:
+            status = deref(self.impl).wait(c_num_requests, c_timeout)
+        return status
 
     ## Get idle request ID
     #  @return Request index
@@ -980,6 +987,7 @@ cdef class InferRequest:
         self._py_callback_used = False
         self._py_callback_called = threading.Event()
         self._py_data = None
+        self._bound_inputs = {}
 
     cdef void user_callback(self, int status) with gil:
         if self._py_callback:
@@ -1078,10 +1086,14 @@ cdef class InferRequest:
         else:
             deref(self.impl).setBlob(blob_name.encode(), blob._ptr)
         self._user_blobs[blob_name] = blob
+        self._bound_inputs.pop(blob_name, None)
     ## Starts synchronous inference of the infer request and fill outputs array
     #
     #  @param inputs: A dictionary that maps input layer names to `numpy.ndarray` objects of proper shape with
     #                 input data for the layer
+    #  @param share_inputs: If True, C-contiguous arrays of the input precision and shape are used as the input
+    #                       blobs without copying, so they must not be changed until the next inputs are given.
+    #                       The arrays are copied to the blobs of the request by default.
     #  @return None
     #
     #  Usage example:\n
@@ -1094,15 +1106,18 @@ cdef class InferRequest:
     #         5.45198545e-02, 2.44456064e-02, 5.41366823e-03, 3.42589128e-03,
     #         2.26027006e-03, 2.12283316e-03 ...])
     #  ```
-    cpdef infer(self, inputs=None):
+    cpdef infer(self, inputs=None, share_inputs=False):
         if inputs is not None:
-            self._fill_inputs(inputs)
+            self._fill_inputs(inputs, share_inputs)
 
-        deref(self.impl).infer()
+        with nogil:
+            deref(self.impl).infer()
 
     ## Starts asynchronous inference of the infer request and fill outputs array
     #
     #  @param inputs: A dictionary that maps input layer names to `numpy.ndarray` objects of proper shape with input data for the layer
+    #  @param share_inputs: If True, C-contiguous arrays of the input precision and shape are used as the input
+    #                       blobs without copying, see `infer()`. The arrays are copied by default.
     #  @return: None
     #
     #  Usage example:\n
@@ -1112,12 +1127,13 @@ cdef class InferRequest:
     #  request_status = exec_net.requests[0].wait()
     #  res = exec_net.requests[0].output_blobs['prob']
     #  ```
-    cpdef async_infer(self, inputs=None):
+    cpdef async_infer(self, inputs=None, share_inputs=False):
         if inputs is not None:
-            self._fill_inputs(inputs)
+            self._fill_inputs(inputs, share_inputs)
         if self._py_callback_used:
             self._py_callback_called.clear()
-        deref(self.impl).infer_async()
+        with nogil:
+            deref(self.impl).infer_async()
 
     ## Waits for the result to become available. Blocks until specified timeout elapses or the result
     #  becomes available, whichever comes first.
@@ -1133,6 +1149,8 @@ cdef class InferRequest:
     #
     #  Usage example: See `async_infer()` method of the the `InferRequest` class.
     cpdef wait(self, timeout=None):
+        cdef int64_t c_timeout
+        cdef int status
         if self._py_callback_used:
             # check request status to avoid blocking for idle requests
             status = deref(self.impl).wait(WaitMode.STATUS_ONLY)
@@ -1151,7 +1169,10 @@ cdef class InferRequest:
         if timeout is None:
             timeout = WaitMode.RESULT_READY
 
-        return deref(self.impl).wait(<int64_t> timeout)
+        c_timeout = timeout
+        with nogil:
+            status = deref(self.impl).wait(c_timeout)
+        return status
 
     ## Queries performance measures per layer to get feedback of what is the most time consuming layer.
     #
@@ -1239,14 +1260,115 @@ cdef class InferRequest:
             raise ValueError(f"Batch size should be positive integer number but {size} specified")
         deref(self.impl).setBatch(size)
 
-    def _fill_inputs(self, inputs):
+    def _fill_inputs(self, inputs, share_inputs=False):
         for k, v in inputs.items():
             assert k in self._inputs_list, f"No input with name {k} found in network"
+            if share_inputs and self._bind_input(k, v):
+                continue
+            if k in self._bound_inputs:
+                # the array bound before must not be overwritten, so the request gets its own blob back
+                deref(self.impl).setBlob(k.encode(), (<Blob> self._bound_inputs.pop(k))._ptr)
+                del self._user_blobs[k]
             if self.input_blobs[k].tensor_desc.precision == "FP16":
                 self.input_blobs[k].buffer[:] = v.view(dtype=np.int16)
             else:
                 self.input_blobs[k].buffer[:] = v
 
+    # Sets a C-contiguous array of the input precision and shape as the input blob instead of copying it.
+    # The array is referenced by the request until another input is given. Used only with share_inputs=True.
+    def _bind_input(self, name, array):
+        cdef Blob own_blob
+        cdef Blob blob
+        if name in self._user_blobs and name not in self._bound_inputs:
+            # blob set by the user with set_blob() is filled as before
+            return False
+        if not isinstance(array, np.ndarray) or not array.flags['C_CONTIGUOUS']:
+            return False
+        tensor_desc = self.input_blobs[name].tensor_desc
+        if tensor_desc.layout not in planar_layouts or tensor_desc.precision in ["FP16", "BF16"] or \
+                array.dtype != format_map[tensor_desc.precision] or array.shape != tuple(tensor_desc.dims):
+            return False
+        if name not in self._bound_inputs:
+            own_blob = Blob()
+            deref(self.impl).getBlobPtr(name.encode(), own_blob._ptr)
+            self._bound_inputs[name] = own_blob
+        blob = Blob(tensor_desc, array)
+        deref(self.impl).setBlob(name.encode(), blob._ptr)
+        self._user_blobs[name] = blob
+        return True
+
+
+## This class provides a pool of infer requests of `ExecutableNetwork` which runs asynchronous jobs on the idle
+#  requests and calls the user callback once a job is done.
+#
+#  \note The pool uses the completion callbacks of all infer requests of the executable network.
+#  The blocking calls release the GIL, so jobs can be started from several Python threads and from the callback.
+#  A callback which starts a job waits for another request, as its own request becomes idle when it returns.
+cdef class AsyncInferQueue:
+    ## Class constructor
+    #  @param exec_net: `ExecutableNetwork` whose infer requests run the jobs
+    #  @param callback: Function called as `callback(request, status, userdata)` when a job is done. The request
+    #                   isn't given to another job until the callback returns, so it may read the outputs.
+    #  @return Instance of AsyncInferQueue class
+    #
+    #  Usage example:\n
+    #  ```python
+    #  def callback(request, status, frame_id):
+    #      results[frame_id] = request.output_blobs['prob'].buffer.copy()
+    #
+    #  exec_net = ie_core.load_network(network=net, device_name="CPU", num_requests=4)
+    #  queue = AsyncInferQueue(exec_net, callback)
+    #  for frame_id, frame in enumerate(frames):
+    #      queue.start_async({input_blob: frame}, userdata=frame_id)
+    #  queue.wait_all()
+    #  ```
+    def __init__(self, ExecutableNetwork exec_net, callback=None):
+        self._exec_net = exec_net
+        self._requests = exec_net.requests
+        self._callback = callback
+        self._userdata = [None] * len(self._requests)
+        self._lock = threading.Lock()
+        for request_id, request in enumerate(self._requests):
+            request.set_completion_callback(self._on_completion, request_id)
+
+    def _on_completion(self, status, request_id):
+        if self._callback:
+            self._callback(self._requests[request_id], status, self._userdata[request_id])
+
+    ## Number of infer requests in the pool
+    def __len__(self):
+        return len(self._requests)
+
+    ## Infer request of the pool with the given index
+    def __getitem__(self, request_id):
+        return self._requests[request_id]
+
+    ## Waits for an idle infer request and starts the asynchronous job on it
+    #  @param inputs: A dictionary that maps input layer names to `numpy.ndarray` objects of proper shape with
+    #                 input data for the layer
+    #  @param userdata: Any object passed to the callback of the job
+    #  @param share_inputs: If True, C-contiguous arrays of the input precision and shape are used without copying,
+    #                       so they must not be changed until the job is done. The arrays are copied by default.
+    #  @return Index of the infer request which runs the job
+    def start_async(self, inputs=None, userdata=None, share_inputs=False):
+        while True:
+            # the lock is not held while waiting, so the callbacks which start jobs can take it
+            self._exec_net.wait(num_requests=1, timeout=WaitMode.RESULT_READY)
+            with self._lock:
+                request_id = self._exec_net.get_idle_request_id()
+                if request_id < 0:
+                    # the idle request was taken by another thread meanwhile
+                    continue
+                self._userdata[request_id] = userdata
+                self._requests[request_id].async_infer(inputs, share_inputs)
+                return request_id
+
+    ## Waits until all jobs are done and their callbacks have returned
+    #  @param timeout: Time to wait in milliseconds or -1 to wait without a limit (default value)
+    #  @return Request status code: OK or RESULT_NOT_READY
+    def wait_all(self, timeout=None):
+        return self._exec_net.wait(num_requests=len(self._requests), timeout=timeout)
+
 
 ## This class contains the information about the network model read from IR and allows you to manipulate with
 #  some model parameters such as layers affinity and output layers.
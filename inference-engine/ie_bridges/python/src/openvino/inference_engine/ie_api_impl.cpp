@@ -382,22 +382,24 @@ void InferenceEnginePython::InferRequestWrap::setBatch(int size) {
 }
 
 void latency_callback(InferenceEngine::IInferRequest::Ptr request, InferenceEngine::StatusCode code) {
-    if (code != InferenceEngine::StatusCode::OK) {
-        IE_EXCEPTION_SWITCH(code, ExceptionType,
-            InferenceEngine::details::ThrowNow<ExceptionType>{}
-                <<= std::stringstream{} << IE_LOCATION
-                << InferenceEngine::details::ExceptionTraits<ExceptionType>::string());
-    }
     InferenceEnginePython::InferRequestWrap *requestWrap;
     InferenceEngine::ResponseDesc dsc;
     request->GetUserData(reinterpret_cast<void **>(&requestWrap), &dsc);
     auto end_time = Time::now();
     auto execTime = std::chrono::duration_cast<ns>(end_time - requestWrap->start_time);
     requestWrap->exec_time = static_cast<double>(execTime.count()) * 0.000001;
-    requestWrap->request_queue_ptr->setRequestIdle(requestWrap->index);
+    // The request becomes idle after the user callback, so the callback may read the outputs
+    // before the request is taken by another job
     if (requestWrap->user_callback) {
         requestWrap->user_callback(requestWrap->user_data, code);
     }
+    requestWrap->request_queue_ptr->setRequestIdle(requestWrap->index);
+    if (code != InferenceEngine::StatusCode::OK) {
+        IE_EXCEPTION_SWITCH(code, ExceptionType,
+            InferenceEngine::details::ThrowNow<ExceptionType>{}
+                <<= std::stringstream{} << IE_LOCATION
+                << InferenceEngine::details::ExceptionTraits<ExceptionType>::string());
+    }
 }
 
 void InferenceEnginePython::InferRequestWrap::setCyCallback(cy_callback callback, void *data) {
@@ -500,7 +502,10 @@ int InferenceEnginePython::IdleInferRequestQueue::wait(int num_requests, int64_t
 
 void InferenceEnginePython::IdleInferRequestQueue::setRequestIdle(int index) {
    std::unique_lock<std::mutex> lock(mutex);
-   idle_ids.emplace_back(index);
+   // may be reported both by the completion callback and by InferRequestWrap::wait
+   if (std::find(idle_ids.begin(), idle_ids.end(), index) == idle_ids.end()) {
+       idle_ids.emplace_back(index);
+   }
    cv.notify_all();
 }
 
@@ -0,0 +1,98 @@
+# Copyright (C) 2018-2021 Intel Corporation
+# SPDX-License-Identifier: Apache-2.0
+
+import numpy as np
+import os
+import threading
+
+from openvino.inference_engine import ie_api as ie
+from conftest import model_path, image_path
+
+is_myriad = os.environ.get("TEST_DEVICE") == "MYRIAD"
+test_net_xml, test_net_bin = model_path(is_myriad)
+path_to_img = image_path()
+
+
+def read_image():
+    import cv2
+    n, c, h, w = (1, 3, 32, 32)
+    image = cv2.imread(path_to_img)
+    if image is None:
+        raise FileNotFoundError("Input image not found")
+
+    image = cv2.resize(image, (h, w)) / 255
+    image = image.transpose((2, 0, 1)).astype(np.float32)
+    image = image.reshape((n, c, h, w))
+    return image
+
+
+def load_sample_model(device, num_requests=1):
+    ie_core = ie.IECore()
+    net = ie_core.read_network(test_net_xml, test_net_bin)
+    executable_network = ie_core.load_network(net, device, num_requests=num_requests)
+    return executable_network
+
+
+def test_len_and_getitem(device):
+    exec_net = load_sample_model(device, num_requests=3)
+    queue = ie.AsyncInferQueue(exec_net)
+    assert len(queue) == 3
+    assert queue[1] is exec_net.requests[1]
+
+
+def test_callback_gets_userdata(device):
+    exec_net = load_sample_model(device, num_requests=2)
+    img = read_image()
+    results = {}
+
+    def callback(request, status, userdata):
+        assert status == ie.StatusCode.OK
+        results[userdata] = np.argmax(request.output_blobs['fc_out'].buffer)
+
+    queue = ie.AsyncInferQueue(exec_net, callback)
+    for job_id in range(8):
+        queue.start_async({'data': img}, userdata=job_id)
+    assert queue.wait_all() == ie.StatusCode.OK
+    assert results == {job_id: 2 for job_id in range(8)}
+
+
+def test_start_async_from_threads(device):
+    exec_net = load_sample_model(device, num_requests=2)
+    img = read_image()
+    lock = threading.Lock()
+    done = []
+
+    def callback(request, status, userdata):
+        with lock:
+            done.append(userdata)
+
+    queue = ie.AsyncInferQueue(exec_net, callback)
+
+    def worker(worker_id):
+        for i in range(4):
+            queue.start_async({'data': img}, userdata=(worker_id, i))
+
+    threads = [threading.Thread(target=worker, args=(worker_id,)) for worker_id in range(3)]
+    for thread in threads:
+        thread.start()
+    for thread in threads:
+        thread.join()
+    queue.wait_all()
+    assert sorted(done) == [(worker_id, i) for worker_id in range(3) for i in range(4)]
+
+
+def test_callback_starts_next_job(device):
+    exec_net = load_sample_model(device, num_requests=2)
+    img = read_image()
+    done = []
+
+    def callback(request, status, job_id):
+        done.append(job_id)
+        if job_id < 5:
+            queue.start_async({'data': img}, userdata=job_id + 1)
+
+    queue = ie.AsyncInferQueue(exec_net, callback)
+    queue.start_async({'data': img}, userdata=0)
+    # the next job is started before the request of the callback becomes idle
+    assert queue.wait_all(timeout=10000) == ie.StatusCode.OK
+    assert done == list(range(6))
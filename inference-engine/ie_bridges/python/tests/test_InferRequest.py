@@ -167,6 +167,44 @@ def test_infer(device):
     del net
 
 
+def test_infer_copies_input_by_default(device):
+    ie_core = ie.IECore()
+    net = ie_core.read_network(test_net_xml, test_net_bin)
+    exec_net = ie_core.load_network(net, device, num_requests=1)
+    img = read_image()
+    request = exec_net.requests[0]
+    request.infer({'data': img})
+    assert not np.shares_memory(request.input_blobs['data'].buffer, img)
+    assert np.array_equal(request.input_blobs['data'].buffer, img)
+    del exec_net
+    del ie_core
+    del net
+
+
+def test_infer_shares_contiguous_input(device):
+    ie_core = ie.IECore()
+    net = ie_core.read_network(test_net_xml, test_net_bin)
+    exec_net = ie_core.load_network(net, device, num_requests=1)
+    img = read_image()
+    request = exec_net.requests[0]
+    request.infer({'data': img}, share_inputs=True)
+    assert np.shares_memory(request.input_blobs['data'].buffer, img)
+    # a non-contiguous array is copied to the own blob of the request, the shared array stays intact
+    strided = np.repeat(img, 2, axis=3)[:, :, :, ::2]
+    request.infer({'data': strided * 0}, share_inputs=True)
+    assert not np.shares_memory(request.input_blobs['data'].buffer, img)
+    assert np.count_nonzero(img) > 0
+    request.infer({'data': img}, share_inputs=True)
+    # without share_inputs the request gets its own blob back
+    request.infer({'data': img})
+    assert not np.shares_memory(request.input_blobs['data'].buffer, img)
+    res = request.output_blobs['fc_out'].buffer
+    assert np.argmax(res) == 2
+    del exec_net
+    del ie_core
+    del net
+
+
 def test_async_infer_default_timeout(device):
     ie_core = ie.IECore()
     net = ie_core.read_network(test_net_xml, test_net_bin)
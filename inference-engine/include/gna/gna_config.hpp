@@ -98,6 +98,13 @@ DECLARE_GNA_CONFIG_KEY(PWL_UNIFORM_DESIGN);
 */
 DECLARE_GNA_CONFIG_KEY(PWL_MAX_ERROR_PERCENT);
 
+/**
+* @brief The option to specify a directory to store designed PWL functions in.
+* Activation functions found there are not designed again by following network compilations.
+* By default (in case of empty value set), designed functions are reused within the process only.
+*/
+DECLARE_GNA_CONFIG_KEY(PWL_DESIGN_CACHE_DIR);
+
 /**
 * @brief By default, the GNA plugin uses one worker thread for inference computations.
 * This parameter allows you to create up to 127 threads for software modes.
@@ -113,6 +120,19 @@ namespace Metrics {
     * @brief Metric to get a std::string of GNA Library version, usually in the form <API_REVISION>.<RELEASE_LINE>.<RELEASE>.<BUILD>
     */
     DECLARE_METRIC_KEY(GNA_LIBRARY_FULL_VERSION, std::string);
+
+    /**
+    * @brief Metric to get the size in bytes of the GNA read-write memory of a network compiled by LoadNetwork
+    * for one request.
+    * Intermediate buffers which are never used at the same time share the memory in GNA_COMPACT_MODE.
+    */
+    DECLARE_METRIC_KEY(GNA_RW_MEMORY_SIZE, uint64_t);
+
+    /**
+    * @brief Metric to get the size in bytes the GNA read-write memory of a network compiled by LoadNetwork would take
+    * if intermediate buffers did not share the memory
+    */
+    DECLARE_METRIC_KEY(GNA_RW_MEMORY_SIZE_WITHOUT_REUSE, uint64_t);
 }  // namespace Metrics
 
 }  // namespace InferenceEngine
@@ -2438,6 +2438,32 @@ void GNAGraphCompiler::Reset() {
     }
 }
 
+std::unordered_map<const void *, memory::BufferUsage> GNAGraphCompiler::getBufferUsages() {
+    std::unordered_map<const void *, memory::BufferUsage> usages;
+
+    // delayed operations are executed after all the others
+    size_t direct_id = 0;
+    size_t delayed_id = static_cast<size_t>(std::count_if(dnnComponents.components.begin(), dnnComponents.components.end(),
+        [](const backend::DnnComponentExtra & c) { return !c.isDelayed; }));
+    for (auto && c : dnnComponents.components) {
+        size_t &id = c.isDelayed ? delayed_id : direct_id;
+        usages[&c.dnnComponent.ptr_inputs] = {memory::BufferUsage::READ, id};
+        usages[&c.dnnComponent.ptr_outputs] = {memory::BufferUsage::WRITE, id};
+        id++;
+    }
+
+    // non functional crops only shift pointers, unless their data are also connected to concat
+    for (auto && crop : crop_connection) {
+        auto &consumers = getInputTo(crop.second.getCrop()->outData.front());
+        if (std::none_of(consumers.begin(), consumers.end(), [](const std::pair<const std::string, CNNLayerPtr> & consumer) {
+                return LayerInfo(consumer.second).isConcat();
+            })) {
+            usages[&crop.second.gna_ptr] = {memory::BufferUsage::BINDING, 0};
+        }
+    }
+    return usages;
+}
+
 void GNAGraphCompiler::printTensorDesc(const std::string& name, const InferenceEngine::TensorDesc& desc) {
     gnalog() << name << " layout: " << desc.getLayout() << " shape: ";
     for (auto i = 0; i < desc.getDims().size(); i++) {
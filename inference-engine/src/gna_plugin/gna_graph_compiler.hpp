@@ -134,6 +134,11 @@ public:
         uint32_t out_batch, uint32_t out_channels, uint32_t out_height, uint32_t out_width);
 #endif
 
+    /**
+     * @brief describes how GNA operations use the pointers set up in memory requests, in execution order
+     */
+    std::unordered_map<const void *, memory::BufferUsage> getBufferUsages();
+
     void Reset();
 };
 }  // namespace GNAPluginNS
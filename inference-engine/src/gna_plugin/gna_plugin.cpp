@@ -36,6 +36,7 @@
 #include "memory/gna_memory_state.hpp"
 #include "gna_model_serial.hpp"
 #include "runtime/gna_float_runtime.hpp"
+#include "runtime/pwl_design_cache.hpp"
 #include <layers/gna_fake_quantize_layer.hpp>
 #include "gna_graph_patterns.hpp"
 #include "gna_tensor_tools.hpp"
@@ -866,11 +867,20 @@ void GNAPlugin::LoadNetwork(CNNNetwork & _network) {
         inputsDesc->getPtrInputsGlobal(input.first).resize(gnaFlags->gna_lib_async_threads_num);
     }
 
+    // PWL functions designed by previous compilations are reused
+    if (!config.pwlDesignCacheDir.empty()) {
+        runtime::PwlDesignCache::instance().load(config.pwlDesignCacheDir);
+    }
+
     // CreatingLayer primitives
     for (auto & layer : sortedNoMem) {
         graphCompiler.CreateLayerPrimitive(layer);
     }
 
+    if (!config.pwlDesignCacheDir.empty()) {
+        runtime::PwlDesignCache::instance().save(config.pwlDesignCacheDir);
+    }
+
     for (auto& inputLayer : inputLayers) {
         auto layerInfo = LayerInfo(inputLayer);
         if (layerInfo.isInput() && 0 == inputsDesc->bytes_allocated_for_input[inputLayer->name]) {
@@ -928,14 +938,23 @@ void GNAPlugin::LoadNetwork(CNNNetwork & _network) {
 
     void *pParallelExecutionData  = nullptr;
 
+    if (gnaFlags->compact_mode) {
+        // intermediate buffers which are never used at the same time share memory
+        gnamem->setLifetimes(graphCompiler.getBufferUsages());
+    }
+
     // reserving more bytes for intermediate data in parallel case - TODO: this works incorrectly in compact mode at lest
     rwSegmentSize = gnamem->getRWBytes();
+    rwSegmentSizeWithoutReuse = gnamem->getRWBytesWithoutReuse();
     if (gnaFlags->gna_lib_async_threads_num > 1) {
         gnamem->reserve_ptr(&pParallelExecutionData, gnamem->getRWBytes() * (gnaFlags->gna_lib_async_threads_num - 1), 64);
     }
 
     gnamem->commit();
 
+    gnalog() << "GNA RW memory of " << _network.getName() << ": " << rwSegmentSize << " bytes, "
+             << rwSegmentSizeWithoutReuse << " bytes without buffer reuse\n";
+
     dnn->Init(gnamem->getBasePtr(),
              gnamem->getTotalBytes(),
              gnaFlags->sw_fp32 ? kDnnFloat : kDnnInt,
@@ -82,6 +82,10 @@ class GNAPlugin : public InferenceEngine::IInferencePlugin {
      * @brief size of RW segment without extra memory for parallel execution
      */
     uint32_t rwSegmentSize = 0;
+    /**
+     * @brief size the RW segment would take if intermediate buffers did not share memory
+     */
+    uint32_t rwSegmentSizeWithoutReuse = 0;
 
     InferenceEngine::InputsDataMap inputsDataMap;
     InferenceEngine::OutputsDataMap outputsDataMap;
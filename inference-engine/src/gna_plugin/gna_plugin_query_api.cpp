@@ -47,6 +47,10 @@ Parameter GNAPlugin::GetMetric(const std::string& name, const std::map<std::stri
             return deviceName;
         }},
         {METRIC_KEY(GNA_LIBRARY_FULL_VERSION), [this]() {return GNADeviceHelper::GetGnaLibraryVersion();}},
+        {METRIC_KEY(GNA_RW_MEMORY_SIZE), [this]() {return static_cast<uint64_t>(rwSegmentSize);}},
+        {METRIC_KEY(GNA_RW_MEMORY_SIZE_WITHOUT_REUSE), [this]() {
+            return static_cast<uint64_t>(rwSegmentSizeWithoutReuse);
+        }},
         {METRIC_KEY(SUPPORTED_METRICS), [&queryApiSupported, this]() {
             std::vector<std::string> availablesMetrics;
             for (auto && supportedAPI : queryApiSupported) {
@@ -5,6 +5,8 @@
 #pragma once
 
 #include <functional>
+#include <limits>
+#include <utility>
 #include <vector>
 #include <algorithm>
 
@@ -26,6 +28,20 @@ enum rRegion {
     REGION_AUTO,
 };
 
+/**
+ * @brief how GNA operations use a pointer set up by memory requests
+ */
+struct BufferUsage {
+    enum Kind : uint8_t {
+        READ,
+        WRITE,
+        // pointer is only used to bind other pointers to, not accessed during inference
+        BINDING,
+    } kind;
+    // execution position of the operation
+    size_t order;
+};
+
 struct MemRequest {
     rRegion  _region;
     uint8_t   _type;
@@ -40,6 +56,8 @@ struct MemRequest {
     size_t _offset = 0;
     // expansion in bytes due to large depended layers
     size_t _padding = 0;
+    // first and last execution positions the buffer is used at, default one covers the whole inference
+    std::pair<size_t, size_t> _life_limits {0, std::numeric_limits<size_t>::max()};
     MemRequest(rRegion region,
                 rType req,
                 void *ptr_out,
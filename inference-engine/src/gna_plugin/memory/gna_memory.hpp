@@ -7,12 +7,15 @@
 #include "gna_mem_requests.hpp"
 #include <ie_memcpy.h>
 #include "gna_mem_requests_queue.hpp"
+#include "gna_memory_solver.hpp"
 #include <cstdint>
 #include <memory>
 #include <vector>
 #include <list>
 #include <algorithm>
 #include <functional>
+#include <limits>
+#include <unordered_map>
 #include "gna_lib_ver_selector.hpp"
 
 namespace GNAPluginNS {
@@ -28,7 +31,10 @@ class GNAMemory : public GNAMemRequestsQueue {
     std::list<std::vector<char>> _local_storage;
     size_t _total = 0;
     size_t _rw_section_size = 0;
+    size_t _rw_section_size_no_reuse = 0;
     size_t _ro_section_size = 0;
+    // offsets in RW section of requests with limited lifetime, indexed as _future_heap
+    std::vector<size_t> _planned_offsets;
     Allocator _allocator;
     std::shared_ptr<uint8_t> heap = nullptr;
     size_t _page_alignment = 1;
@@ -96,9 +102,12 @@ class GNAMemory : public GNAMemRequestsQueue {
 
                 auto sz = re._element_size * re._num_elements;
 
+                bool planned = !(re._type & REQUEST_BIND) && isLifetimeLimited(re);
+
                 if (re._ptr_out != nullptr) {
-                    auto cptr = heap.get() + offset;
-                    size_t cptr_avail_size = _total - offset;
+                    auto cptr_offset = planned ? _planned_offsets[&re - &_future_heap.front()] : offset;
+                    auto cptr = heap.get() + cptr_offset;
+                    size_t cptr_avail_size = _total - cptr_offset;
                     if (re._type & REQUEST_BIND) {
                         cptr = reinterpret_cast<uint8_t*>(*reinterpret_cast<void **>(re._ptr_out));
                         cptr_avail_size = sz;
@@ -135,7 +144,7 @@ class GNAMemory : public GNAMemRequestsQueue {
                         }
                     }
                 }
-                if (!(re._type & REQUEST_BIND)) {
+                if (!(re._type & REQUEST_BIND) && !planned) {
                     offset += ALIGN(sz + re._padding, re._alignment);
                 }
             }
@@ -160,6 +169,61 @@ class GNAMemory : public GNAMemRequestsQueue {
         return _rw_section_size;
     }
 
+    /**
+     * @brief size of RW section if every request got its own memory
+     */
+    size_t getRWBytesWithoutReuse() {
+        updateSectionsSizes();
+        return _rw_section_size_no_reuse;
+    }
+
+    /**
+     * @brief limits lifetimes of allocation requests to the execution positions of operations using them,
+     * requests never used at the same time are assigned overlapping memory
+     * @param usages - how pointers of requests are used by GNA operations, a buffer with any of its pointers
+     * missing there is kept for the whole inference
+     */
+    void setLifetimes(const std::unordered_map<const void *, BufferUsage> & usages) {
+        for (auto &re : _future_heap) {
+            if (re._type != REQUEST_ALLOCATE || re._region != REGION_RW || re._ptr_out == nullptr) continue;
+
+            bool known = true;
+            bool first_written = false;
+            bool first_read = false;
+            size_t first = std::numeric_limits<size_t>::max();
+            size_t last = 0;
+            auto visit = [&](const void *ptr) {
+                auto usage = usages.find(ptr);
+                if (usage == usages.end()) {
+                    known = false;
+                    return;
+                }
+                if (usage->second.kind == BufferUsage::BINDING) return;
+                if (usage->second.order < first) {
+                    first = usage->second.order;
+                    first_written = false;
+                    first_read = false;
+                }
+                if (usage->second.order == first) {
+                    (usage->second.kind == BufferUsage::WRITE ? first_written : first_read) = true;
+                }
+                last = std::max(last, usage->second.order);
+            };
+
+            visit(re._ptr_out);
+            iterate_binded(re, [&](MemRequest &, MemRequest & binded) {
+                // initialized data have to be kept for the whole inference
+                if (binded._type != REQUEST_BIND) known = false;
+                visit(binded._ptr_out);
+            });
+
+            // content of the buffer can be lost between usages only if each inference writes it before reading
+            if (known && first_written && !first_read) {
+                re._life_limits = {first, last};
+            }
+        }
+    }
+
     size_t getTotalBytes() {
         updateSectionsSizes();
         return _total;
@@ -200,10 +264,19 @@ class GNAMemory : public GNAMemRequestsQueue {
     }
 
  protected:
+    static bool isLifetimeLimited(const MemRequest & re) {
+        // padding past the data is expected to stay zeroed, so padded buffers never share memory
+        return re._region == REGION_RW && re._padding == 0 &&
+               re._life_limits.second != std::numeric_limits<size_t>::max();
+    }
+
     void updateSectionsSizes() {
         // count total size and size of read/write regions
         _rw_section_size = 0;
         _ro_section_size = 0;
+        std::vector<GNAMemorySolver::Box> boxes;
+        std::vector<size_t> boxed_requests;
+        size_t max_alignment = 1;
         for (auto &re : _future_heap) {
             auto current = ALIGN(re._num_elements * re._element_size + re._padding, re._alignment);
 #ifdef GNA_HEAP_PROFILER
@@ -217,12 +290,33 @@ class GNAMemory : public GNAMemRequestsQueue {
 #endif
             if (re._type == REQUEST_BIND) continue;
 
-            if (re._region == REGION_RW) {
+            if (!(re._type & REQUEST_BIND) && isLifetimeLimited(re)) {
+                boxes.push_back({re._life_limits.first, re._life_limits.second, current, re._alignment});
+                boxed_requests.push_back(&re - &_future_heap.front());
+                max_alignment = std::max(max_alignment, re._alignment);
+            } else if (re._region == REGION_RW) {
                 _rw_section_size += current;
             } else {
                 _ro_section_size += current;
             }
         }
+
+        _rw_section_size_no_reuse = _rw_section_size;
+        for (auto &box : boxes) {
+            _rw_section_size_no_reuse += box.size;
+        }
+        _rw_section_size_no_reuse = ALIGN(_rw_section_size_no_reuse, _page_alignment);
+
+        // buffers with limited lifetime are placed after all the others
+        if (!boxes.empty()) {
+            auto base = ALIGN(_rw_section_size, max_alignment);
+            GNAMemorySolver solver(boxes);
+            _rw_section_size = base + solver.solve();
+            _planned_offsets.assign(_future_heap.size(), 0);
+            for (size_t i = 0; i != boxed_requests.size(); i++) {
+                _planned_offsets[boxed_requests[i]] = base + solver.getOffset(i);
+            }
+        }
         _rw_section_size = ALIGN(_rw_section_size, _page_alignment);
         _ro_section_size = ALIGN(_ro_section_size, _page_alignment);
     }
@@ -0,0 +1,57 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "gna_memory_solver.hpp"
+
+#include <algorithm>
+#include <numeric>
+#include <utility>
+
+#include "gna_lib_ver_selector.hpp"
+
+using namespace GNAPluginNS::memory;
+
+GNAMemorySolver::GNAMemorySolver(std::vector<Box> boxes) : _boxes(std::move(boxes)) {}
+
+size_t GNAMemorySolver::solve() {
+    std::vector<size_t> order(_boxes.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [this](size_t l, size_t r) {
+        return _boxes[l].size > _boxes[r].size;
+    });
+
+    _offsets.assign(_boxes.size(), 0);
+    std::vector<size_t> placed;
+    std::vector<size_t> neighbours;
+    size_t total = 0;
+    for (auto id : order) {
+        auto &box = _boxes[id];
+        neighbours.clear();
+        for (auto other : placed) {
+            if (_boxes[other].start <= box.finish && box.start <= _boxes[other].finish) {
+                neighbours.push_back(other);
+            }
+        }
+        std::sort(neighbours.begin(), neighbours.end(), [this](size_t l, size_t r) {
+            return _offsets[l] < _offsets[r];
+        });
+
+        // looking for the lowest gap between neighbours the box fits in
+        size_t offset = 0;
+        for (auto other : neighbours) {
+            if (ALIGN(offset, box.alignment) + box.size <= _offsets[other]) {
+                break;
+            }
+            offset = std::max(offset, _offsets[other] + _boxes[other].size);
+        }
+        _offsets[id] = ALIGN(offset, box.alignment);
+        total = std::max(total, _offsets[id] + box.size);
+        placed.push_back(id);
+    }
+    return total;
+}
+
+size_t GNAMemorySolver::getOffset(size_t id) const {
+    return _offsets.at(id);
+}
@@ -0,0 +1,47 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+namespace GNAPluginNS {
+namespace memory {
+/**
+ * @brief places buffers with known lifetimes in a single memory region,
+ * buffers which are never used at the same time can share the same bytes
+ */
+class GNAMemorySolver {
+public:
+    struct Box {
+        /**
+         * @brief first and last execution positions the buffer is used at, inclusive
+         */
+        size_t start;
+        size_t finish;
+        size_t size;
+        size_t alignment;
+    };
+
+    explicit GNAMemorySolver(std::vector<Box> boxes);
+
+    /**
+     * @brief assigns offsets to all the boxes, larger ones first, each one at the lowest offset
+     * where it doesn't overlap boxes alive at the same time
+     * @return size of the region required for all the boxes
+     */
+    size_t solve();
+
+    /**
+     * @brief offset of the box in the region, in the order boxes were passed to the constructor
+     */
+    size_t getOffset(size_t id) const;
+
+private:
+    std::vector<Box> _boxes;
+    std::vector<size_t> _offsets;
+};
+}  // namespace memory
+}  // namespace GNAPluginNS
@@ -6,9 +6,11 @@
 #include <limits>
 #include <cstdint>
 #include <cstdio>
+#include <utility>
 #include <gna_plugin_log.hpp>
 
 #include "cnn.h"
+#include "floatmath_kernels.hpp"
 #include "backend/dnn_types.h"
 #include "backend/gna_limitations.hpp"
 #include "gna_lib_ver_selector.hpp"
@@ -33,17 +35,29 @@ void CNNFilter32(intel_dnn_component_t *component) {
         THROW_GNA_EXCEPTION << "Bad num_columns_out in CNNFilter32!" << layer_name;
     }
 
-    for (uint32_t j = 0; j < num_filter_outputs; j++) {
-        float *ptr_in = ptr_inputs + j * num_inputs_band_stride;
-        for (uint32_t i = 0; i < component->op.conv1D.num_filters; i++) {
-            float *ptr_coef = ptr_filters + i * num_filter_coefficients;
-            float sum = ptr_biases[i];
-            for (uint32_t k = 0; k < num_filter_coefficients; k++) {
-                sum += ptr_in[k] * ptr_coef[k];
+    const uint32_t num_filters = component->op.conv1D.num_filters;
+    const size_t work = static_cast<size_t>(num_filter_outputs) * num_filters * num_filter_coefficients;
+    GNAPluginNS::runtime::kernels::parallel_if(work, num_filter_outputs, [&](size_t j) {
+        const float *ptr_in = ptr_inputs + j * num_inputs_band_stride;
+        float *ptr_out = ptr_outputs + j * num_filters;
+        // four filters share each load of the input band
+        uint32_t i = 0;
+        for (; i + 4 <= num_filters; i += 4) {
+            const float *filters[4];
+            for (uint32_t f = 0; f < 4; f++) {
+                filters[f] = ptr_filters + (i + f) * num_filter_coefficients;
+            }
+            float sums[4];
+            GNAPluginNS::runtime::kernels::dot4(ptr_in, filters, num_filter_coefficients, sums);
+            for (uint32_t f = 0; f < 4; f++) {
+                ptr_out[i + f] = ptr_biases[i + f] + sums[f];
             }
-            ptr_outputs[j * component->op.conv1D.num_filters + i] = sum;
         }
-    }
+        for (; i < num_filters; i++) {
+            ptr_out[i] = ptr_biases[i] +
+                GNAPluginNS::runtime::kernels::dot(ptr_in, ptr_filters + i * num_filter_coefficients, num_filter_coefficients);
+        }
+    });
 }
 
 void CNNMaxPoolLegacy(intel_dnn_component_t *component, intel_dnn_number_type_t number_type, const bool sumPoolingOverRide) {
@@ -185,49 +199,26 @@ void CNNMaxPool2DFloat(intel_dnn_component_t* component) {
 
 #if GNA_LIB_VER == 2
 
-bool matchesPaddedArea(unsigned filterIndex, unsigned outputIndex, unsigned inputSize, unsigned paddingSize, unsigned stride) {
-    const auto paddedIndex = stride * outputIndex + filterIndex;
+void checkPaddedArea(unsigned filterSize, unsigned outputSize, unsigned inputSize, unsigned paddingSize, unsigned stride) {
+    if (outputSize == 0 || filterSize == 0) {
+        return;
+    }
+    const auto paddedIndex = stride * (outputSize - 1) + filterSize - 1;
     if (paddedIndex >= inputSize + 2 * paddingSize) {
         THROW_GNA_EXCEPTION << "In: isZeroPaddingCase, paddedIndex >= inputSize + 2 * paddingSize";
     }
-    if (paddedIndex < paddingSize || paddedIndex >= inputSize + paddingSize) {
-        return true;
-    }
-    return false;
 }
 
-float CNN2DFilter32SingleHWC(const float bias, const float* filter, const unsigned KH, const unsigned KW, const unsigned KC,
-    const float* image, const unsigned IH, const unsigned IW, const unsigned IC,
-    const unsigned oh, const unsigned ow, const unsigned oc,
-    const std::array<uint32_t, 2>& convStride,
-    const std::array<uint32_t, 2>& zeroPadding) {
-
-    const auto cSH = convStride[0];
-    const auto cSW = convStride[1];
-
-    const auto zPH = zeroPadding[0];
-    const auto zPW = zeroPadding[1];
-    float output = 0;
-    for (unsigned kh = 0; kh < KH; kh++) {
-        for (unsigned kw = 0; kw < KW; kw++) {
-            for (unsigned kc = 0; kc < KC; kc++) {
-                if (!matchesPaddedArea(kh, oh, IH, zPH, cSH) &&
-                    !matchesPaddedArea(kw, ow, IW, zPW, cSW)) {
-                    const auto ih = (cSH * oh + kh) - zPH;
-                    const auto iw = (cSW * ow + kw) - zPW;
-                    const auto ic = kc;
-                    const auto imageIndex = getQubeIndex(ih, iw, ic, IW, IC);
-                    const auto imageElement = image[imageIndex];
-                    const auto filterIndex = getQubeIndex(kh, kw, kc, KW, KC);
-                    const auto filterElement = filter[filterIndex];
-                    const auto product = imageElement * filterElement;
-                    output += product;
-                }
-            }
-        }
-    }
-    output += bias;
-    return output;
+// Returns the range [begin, end) of filter indices which hit the input for the given output index,
+// the rest of the filter is over the zero padding
+std::pair<unsigned, unsigned> validFilterRange(unsigned filterSize, unsigned outputIndex, unsigned inputSize,
+                                               unsigned paddingSize, unsigned stride) {
+    const auto start = stride * outputIndex;
+    const auto begin = start < paddingSize ? (std::min)(paddingSize - start, filterSize) : 0;
+    const auto end = start + filterSize > inputSize + paddingSize
+                     ? (std::max)(begin, inputSize + paddingSize - (std::min)(start, inputSize + paddingSize))
+                     : filterSize;
+    return {begin, end};
 }
 
 void CNN2DFilter32(intel_dnn_component_t* component) {
@@ -258,21 +249,40 @@ void CNN2DFilter32(intel_dnn_component_t* component) {
     if (kc != IC) {
         THROW_GNA_EXCEPTION << "Depth of filter should be equal to input depth!" << layer_name;
     }
-    auto kernelIndex = 0;
-    for (unsigned oc = 0; oc < OC; oc++) {
-        for (unsigned ow = 0; ow < OW; ow++) {
-            for (unsigned oh = 0; oh < OH; oh++) {
-                const auto outputIndex = getQubeIndex(oh, ow, oc, OW, OC);
-                ptr_outputs[outputIndex] = CNN2DFilter32SingleHWC(*(ptr_biases + oc), ptr_filters + kernelIndex, kh, kw, kc,
-                    ptr_inputs, IH, IW, IC,
-                    oh, ow, oc,
-                    component->op.conv2D.convStride,
-                    component->op.conv2D.zeroPadding);
+
+    const auto cSH = component->op.conv2D.convStride[0];
+    const auto cSW = component->op.conv2D.convStride[1];
+    const auto zPH = component->op.conv2D.zeroPadding[0];
+    const auto zPW = component->op.conv2D.zeroPadding[1];
+    checkPaddedArea(kh, OH, IH, zPH, cSH);
+    checkPaddedArea(kw, OW, IW, zPW, cSW);
+
+    // kernel padded to 16B = 4 * sizeof(float)
+    const auto kernelStride = ALIGN(kh * kw * kc, GNAPluginNS::GNALimitations::convEachKernelByteAlignment / sizeof(float));
+
+    // Filter and image elements with consecutive (w, c) indices are adjacent in HWC layout,
+    // so each filter row which hits the input is a single contiguous dot product
+    const size_t work = static_cast<size_t>(OH) * OW * OC * kh * kw * kc;
+    GNAPluginNS::runtime::kernels::parallel_if(work, static_cast<size_t>(OH) * OW, [&](size_t position) {
+        const unsigned oh = static_cast<unsigned>(position / OW);
+        const unsigned ow = static_cast<unsigned>(position % OW);
+        const auto rangeH = validFilterRange(kh, oh, IH, zPH, cSH);
+        const auto rangeW = validFilterRange(kw, ow, IW, zPW, cSW);
+        const size_t rowLength = static_cast<size_t>(rangeW.second - rangeW.first) * kc;
+        const auto iw = cSW * ow + rangeW.first - zPW;
+
+        for (unsigned oc = 0; oc < OC; oc++) {
+            const float* filter = ptr_filters + static_cast<size_t>(oc) * kernelStride;
+            float output = 0;
+            for (unsigned fh = rangeH.first; fh < rangeH.second && rowLength != 0; fh++) {
+                const auto ih = cSH * oh + fh - zPH;
+                output += GNAPluginNS::runtime::kernels::dot(ptr_inputs + getQubeIndex<size_t>(ih, iw, 0, IW, IC),
+                                                             filter + getQubeIndex<size_t>(fh, rangeW.first, 0, kw, kc),
+                                                             rowLength);
             }
+            ptr_outputs[getQubeIndex<size_t>(oh, ow, oc, OW, OC)] = output + ptr_biases[oc];
         }
-        // kernel padded to 16B = 4 * sizeof(float)
-        kernelIndex += ALIGN(kh * kw * kc, GNAPluginNS::GNALimitations::convEachKernelByteAlignment / sizeof(float));
-    }
+    });
 }
 
 #endif
@@ -0,0 +1,72 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "floatmath_avx2.hpp"
+
+#include <immintrin.h>
+
+namespace GNAPluginNS {
+namespace runtime {
+namespace kernels {
+namespace avx2 {
+
+namespace {
+
+inline float reduce(__m256 v) {
+    __m128 sum = _mm_add_ps(_mm256_castps256_ps128(v), _mm256_extractf128_ps(v, 1));
+    sum = _mm_add_ps(sum, _mm_movehl_ps(sum, sum));
+    sum = _mm_add_ss(sum, _mm_movehdup_ps(sum));
+    return _mm_cvtss_f32(sum);
+}
+
+}  // namespace
+
+float dot(const float *a, const float *b, size_t size) {
+    __m256 acc0 = _mm256_setzero_ps();
+    __m256 acc1 = _mm256_setzero_ps();
+    size_t i = 0;
+    for (; i + 16 <= size; i += 16) {
+        acc0 = _mm256_fmadd_ps(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i), acc0);
+        acc1 = _mm256_fmadd_ps(_mm256_loadu_ps(a + i + 8), _mm256_loadu_ps(b + i + 8), acc1);
+    }
+    if (i + 8 <= size) {
+        acc0 = _mm256_fmadd_ps(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i), acc0);
+        i += 8;
+    }
+    float sum = reduce(_mm256_add_ps(acc0, acc1));
+    for (; i < size; i++) {
+        sum += a[i] * b[i];
+    }
+    return sum;
+}
+
+void dot4(const float *x, const float *const rows[4], size_t size, float result[4]) {
+    __m256 acc0 = _mm256_setzero_ps();
+    __m256 acc1 = _mm256_setzero_ps();
+    __m256 acc2 = _mm256_setzero_ps();
+    __m256 acc3 = _mm256_setzero_ps();
+    size_t i = 0;
+    for (; i + 8 <= size; i += 8) {
+        const __m256 vx = _mm256_loadu_ps(x + i);
+        acc0 = _mm256_fmadd_ps(vx, _mm256_loadu_ps(rows[0] + i), acc0);
+        acc1 = _mm256_fmadd_ps(vx, _mm256_loadu_ps(rows[1] + i), acc1);
+        acc2 = _mm256_fmadd_ps(vx, _mm256_loadu_ps(rows[2] + i), acc2);
+        acc3 = _mm256_fmadd_ps(vx, _mm256_loadu_ps(rows[3] + i), acc3);
+    }
+    result[0] = reduce(acc0);
+    result[1] = reduce(acc1);
+    result[2] = reduce(acc2);
+    result[3] = reduce(acc3);
+    for (; i < size; i++) {
+        result[0] += x[i] * rows[0][i];
+        result[1] += x[i] * rows[1][i];
+        result[2] += x[i] * rows[2][i];
+        result[3] += x[i] * rows[3][i];
+    }
+}
+
+}  // namespace avx2
+}  // namespace kernels
+}  // namespace runtime
+}  // namespace GNAPluginNS
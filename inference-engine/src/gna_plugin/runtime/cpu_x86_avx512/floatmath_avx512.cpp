@@ -0,0 +1,70 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "floatmath_avx512.hpp"
+
+#include <immintrin.h>
+
+namespace GNAPluginNS {
+namespace runtime {
+namespace kernels {
+namespace avx512 {
+
+namespace {
+
+inline __mmask16 tailMask(size_t tail) {
+    return static_cast<__mmask16>((1u << tail) - 1);
+}
+
+}  // namespace
+
+float dot(const float *a, const float *b, size_t size) {
+    __m512 acc0 = _mm512_setzero_ps();
+    __m512 acc1 = _mm512_setzero_ps();
+    size_t i = 0;
+    for (; i + 32 <= size; i += 32) {
+        acc0 = _mm512_fmadd_ps(_mm512_loadu_ps(a + i), _mm512_loadu_ps(b + i), acc0);
+        acc1 = _mm512_fmadd_ps(_mm512_loadu_ps(a + i + 16), _mm512_loadu_ps(b + i + 16), acc1);
+    }
+    for (; i + 16 <= size; i += 16) {
+        acc0 = _mm512_fmadd_ps(_mm512_loadu_ps(a + i), _mm512_loadu_ps(b + i), acc0);
+    }
+    if (i < size) {
+        const __mmask16 mask = tailMask(size - i);
+        acc1 = _mm512_fmadd_ps(_mm512_maskz_loadu_ps(mask, a + i), _mm512_maskz_loadu_ps(mask, b + i), acc1);
+    }
+    return _mm512_reduce_add_ps(_mm512_add_ps(acc0, acc1));
+}
+
+void dot4(const float *x, const float *const rows[4], size_t size, float result[4]) {
+    __m512 acc0 = _mm512_setzero_ps();
+    __m512 acc1 = _mm512_setzero_ps();
+    __m512 acc2 = _mm512_setzero_ps();
+    __m512 acc3 = _mm512_setzero_ps();
+    size_t i = 0;
+    for (; i + 16 <= size; i += 16) {
+        const __m512 vx = _mm512_loadu_ps(x + i);
+        acc0 = _mm512_fmadd_ps(vx, _mm512_loadu_ps(rows[0] + i), acc0);
+        acc1 = _mm512_fmadd_ps(vx, _mm512_loadu_ps(rows[1] + i), acc1);
+        acc2 = _mm512_fmadd_ps(vx, _mm512_loadu_ps(rows[2] + i), acc2);
+        acc3 = _mm512_fmadd_ps(vx, _mm512_loadu_ps(rows[3] + i), acc3);
+    }
+    if (i < size) {
+        const __mmask16 mask = tailMask(size - i);
+        const __m512 vx = _mm512_maskz_loadu_ps(mask, x + i);
+        acc0 = _mm512_fmadd_ps(vx, _mm512_maskz_loadu_ps(mask, rows[0] + i), acc0);
+        acc1 = _mm512_fmadd_ps(vx, _mm512_maskz_loadu_ps(mask, rows[1] + i), acc1);
+        acc2 = _mm512_fmadd_ps(vx, _mm512_maskz_loadu_ps(mask, rows[2] + i), acc2);
+        acc3 = _mm512_fmadd_ps(vx, _mm512_maskz_loadu_ps(mask, rows[3] + i), acc3);
+    }
+    result[0] = _mm512_reduce_add_ps(acc0);
+    result[1] = _mm512_reduce_add_ps(acc1);
+    result[2] = _mm512_reduce_add_ps(acc2);
+    result[3] = _mm512_reduce_add_ps(acc3);
+}
+
+}  // namespace avx512
+}  // namespace kernels
+}  // namespace runtime
+}  // namespace GNAPluginNS
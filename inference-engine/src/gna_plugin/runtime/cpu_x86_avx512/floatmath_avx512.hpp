@@ -0,0 +1,21 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+
+namespace GNAPluginNS {
+namespace runtime {
+namespace kernels {
+namespace avx512 {
+
+float dot(const float *a, const float *b, size_t size);
+
+void dot4(const float *x, const float *const rows[4], size_t size, float result[4]);
+
+}  // namespace avx512
+}  // namespace kernels
+}  // namespace runtime
+}  // namespace GNAPluginNS
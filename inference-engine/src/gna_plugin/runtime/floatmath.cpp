@@ -1,13 +1,71 @@
 // Copyright (C) 2018-2021 Intel Corporation
 // SPDX-License-Identifier: Apache-2.0
 //
-// floatmath.cpp : unoptimized floating point math routines (for reference)
+// floatmath.cpp : floating point math routines used by the software emulation mode
 //
 
+#include <algorithm>
 #include <cstdint>
 #include <cstdio>
+#include <vector>
 
 #include "floatmath.h"
+#include "floatmath_kernels.hpp"
+
+namespace {
+
+// C[l, :] += A[rows[l], :] * B for l in [0, L) where B is K x N. If rows is nullptr A rows are taken in order.
+// Columns of B are gathered into contiguous rows once, so every output element is a contiguous dot product
+// and four rows of A are processed per each loaded column of B. The gathered columns are kept per calling thread,
+// so the layers of an inference reuse the largest buffer instead of allocating it on every call.
+void sgemm_nn_accumulate(const uint32_t L, const uint32_t *rows, const uint32_t N, const uint32_t K,
+                         const float *A, const uint32_t lda, const float *B, const uint32_t ldb,
+                         float *C, const uint32_t ldc) {
+    if (L == 0 || N == 0) {
+        return;
+    }
+
+    static thread_local std::vector<float> transposedB;
+    const float *Bt = B;
+    if (N != 1 || ldb != 1) {
+        if (transposedB.size() < static_cast<size_t>(N) * K) {
+            transposedB.resize(static_cast<size_t>(N) * K);
+        }
+        for (uint32_t k = 0; k < K; k++) {
+            for (uint32_t j = 0; j < N; j++) {
+                transposedB[static_cast<size_t>(j) * K + k] = B[static_cast<size_t>(k) * ldb + j];
+            }
+        }
+        Bt = transposedB.data();
+    }
+
+    const size_t blocks = (L + 3) / 4;
+    GNAPluginNS::runtime::kernels::parallel_if(static_cast<size_t>(L) * N * K, blocks, [&](size_t block) {
+        const uint32_t first = static_cast<uint32_t>(block * 4);
+        const uint32_t count = std::min<uint32_t>(4, L - first);
+        const float *rowsA[4];
+        for (uint32_t r = 0; r < 4; r++) {
+            // the tail block repeats its last row to keep the kernel shape
+            const uint32_t l = first + std::min(r, count - 1);
+            rowsA[r] = A + static_cast<size_t>(rows ? rows[l] : l) * lda;
+        }
+        float result[4];
+        for (uint32_t j = 0; j < N; j++) {
+            GNAPluginNS::runtime::kernels::dot4(Bt + static_cast<size_t>(j) * K, rowsA, K, result);
+            for (uint32_t r = 0; r < count; r++) {
+                C[static_cast<size_t>(first + r) * ldc + j] += result[r];
+            }
+        }
+    });
+}
+
+void zero_rows(const uint32_t L, const uint32_t N, float *C, const uint32_t ldc) {
+    for (uint32_t l = 0; l < L; l++) {
+        std::fill_n(C + static_cast<size_t>(l) * ldc, N, 0.0f);
+    }
+}
+
+}  // namespace
 
 #ifdef __cplusplus
 extern "C" {  // API uses C linkage so that it can be used by C and C++ applications
@@ -27,15 +85,10 @@ void cblas_sgemm1(const CBLAS_LAYOUT Layout, const CBLAS_TRANSPOSE TransA,
     }
 
     if ((TransA == CblasNoTrans) && (TransB == CblasNoTrans)) {
-        for (i = 0; i < M; i++) {
-            for (j = 0; j < N; j++) {
-                float sum = (beta == 1.0) ? C[i * ldc + j] : 0;
-                for (k = 0; k < K; k++) {
-                    sum += A[i * lda + k] * B[k * ldb + j];
-                }
-                C[i * ldc + j] = sum;
-            }
+        if (beta != 1.0) {
+            zero_rows(M, N, C, ldc);
         }
+        sgemm_nn_accumulate(M, nullptr, N, K, A, lda, B, ldb, C, ldc);
     } else if ((TransA == CblasNoTrans) && (TransB == CblasTrans)) {
         for (i = 0; i < M; i++) {
             for (j = 0; j < N; j++) {
@@ -105,16 +158,10 @@ void cblas_sgemm_subset(const CBLAS_LAYOUT Layout, const CBLAS_TRANSPOSE TransA,
     }
 
     if ((TransA == CblasNoTrans) && (TransB == CblasNoTrans)) {
-        for (l = 0; l < L; l++) {
-            i = OutputList[l];
-            for (j = 0; j < N; j++) {
-                float sum = (beta == 1.0) ? C[l * ldc + j] : 0;
-                for (k = 0; k < K; k++) {
-                    sum += A[i * lda + k] * B[k * ldb + j];
-                }
-                C[l * ldc + j] = sum;
-            }
+        if (beta != 1.0) {
+            zero_rows(L, N, C, ldc);
         }
+        sgemm_nn_accumulate(L, OutputList, N, K, A, lda, B, ldb, C, ldc);
     } else if ((TransA == CblasNoTrans) && (TransB == CblasTrans)) {
         for (i = 0; i < M; i++) {
             for (l = 0; l < L; l++) {
@@ -153,20 +200,13 @@ void sgemv_split(const uint32_t N,
                  const float *X,
                  const float *B,
                  float *C) {
-    uint32_t num_columns = K1 + K2;
-    uint32_t num_rows = N;
-    uint32_t i, j;
-
-    for (i = 0; i < num_rows; i++) {
-        float sum = B[i];
-        for (j = 0; j < K1; j++) {
-            sum += A1[j] * X[i * num_columns + j];
-        }
-        for (j = K1; j < num_columns; j++) {
-            sum += A2[j - K1] * X[i * num_columns + j];
-        }
-        C[i] = sum;
-    }
+    const uint32_t num_columns = K1 + K2;
+    const uint32_t num_rows = N;
+
+    GNAPluginNS::runtime::kernels::parallel_if(static_cast<size_t>(num_rows) * num_columns, num_rows, [&](size_t i) {
+        const float *row = X + i * num_columns;
+        C[i] = B[i] + GNAPluginNS::runtime::kernels::dot(A1, row, K1) + GNAPluginNS::runtime::kernels::dot(A2, row + K1, K2);
+    });
 }
 
 #ifdef __cplusplus
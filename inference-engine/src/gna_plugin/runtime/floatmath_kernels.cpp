@@ -0,0 +1,83 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "floatmath_kernels.hpp"
+
+#include "ie_system_conf.h"
+
+#ifdef HAVE_AVX2
+#include "cpu_x86_avx2/floatmath_avx2.hpp"
+#endif
+#ifdef HAVE_AVX512
+#include "cpu_x86_avx512/floatmath_avx512.hpp"
+#endif
+
+namespace GNAPluginNS {
+namespace runtime {
+namespace kernels {
+
+namespace {
+
+// Independent accumulators break the dependency chain of the sum and let the compiler vectorize the loop
+constexpr size_t kLanes = 8;
+
+float dotGeneric(const float *a, const float *b, size_t size) {
+    float acc[kLanes] = {};
+    size_t i = 0;
+    for (; i + kLanes <= size; i += kLanes) {
+        for (size_t l = 0; l < kLanes; l++) {
+            acc[l] += a[i + l] * b[i + l];
+        }
+    }
+    float sum = 0.0f;
+    for (size_t l = 0; l < kLanes; l++) {
+        sum += acc[l];
+    }
+    for (; i < size; i++) {
+        sum += a[i] * b[i];
+    }
+    return sum;
+}
+
+void dot4Generic(const float *x, const float *const rows[4], size_t size, float result[4]) {
+    for (size_t r = 0; r < 4; r++) {
+        result[r] = dotGeneric(x, rows[r], size);
+    }
+}
+
+struct Kernels {
+    decltype(&dotGeneric) dot;
+    decltype(&dot4Generic) dot4;
+};
+
+const Kernels &selectKernels() {
+    static const Kernels selected = [] {
+#ifdef HAVE_AVX512
+        if (InferenceEngine::with_cpu_x86_avx512f()) {
+            return Kernels{avx512::dot, avx512::dot4};
+        }
+#endif
+#ifdef HAVE_AVX2
+        if (InferenceEngine::with_cpu_x86_avx2()) {
+            return Kernels{avx2::dot, avx2::dot4};
+        }
+#endif
+        return Kernels{dotGeneric, dot4Generic};
+    }();
+    return selected;
+}
+
+}  // namespace
+
+float dot(const float *a, const float *b, size_t size) {
+    return selectKernels().dot(a, b, size);
+}
+
+void dot4(const float *x, const float *const rows[4], size_t size, float result[4]) {
+    selectKernels().dot4(x, rows, size, result);
+}
+
+}  // namespace kernels
+}  // namespace runtime
+}  // namespace GNAPluginNS
@@ -0,0 +1,50 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "ie_parallel.hpp"
+
+namespace GNAPluginNS {
+namespace runtime {
+namespace kernels {
+
+/**
+ * @brief Returns the dot product of two float vectors.
+ * The implementation is selected once according to the instruction sets supported by the CPU.
+ */
+float dot(const float *a, const float *b, size_t size);
+
+/**
+ * @brief Computes dot products of the vector x with four vectors at once, so x is loaded only once.
+ */
+void dot4(const float *x, const float *const rows[4], size_t size, float result[4]);
+
+/**
+ * @brief Minimal number of multiply-accumulate operations worth to be split between threads
+ */
+constexpr size_t kParallelWorkThreshold = 1 << 16;
+
+/**
+ * @brief Runs body(i) for i in [0, count) in parallel if the amount of work is large enough
+ * to hide the threading overhead, sequentially otherwise.
+ * @param work Approximate number of multiply-accumulate operations of the whole loop
+ */
+template <typename F>
+void parallel_if(size_t work, size_t count, const F &body) {
+    if (work < kParallelWorkThreshold || count < 2) {
+        for (size_t i = 0; i < count; i++) {
+            body(i);
+        }
+    } else {
+        InferenceEngine::parallel_for(count, body);
+    }
+}
+
+}  // namespace kernels
+}  // namespace runtime
+}  // namespace GNAPluginNS
@@ -6,6 +6,7 @@
 #include "pwl.h"
 #include "cnn.h"
 #include "floatmath.h"
+#include "floatmath_kernels.hpp"
 
 using namespace GNAPluginNS;
 using namespace GNAPluginNS::runtime;
@@ -74,18 +75,13 @@ void FP::ApplyDiagonalTransform(intel_dnn_component_t *component) {
     auto B = reinterpret_cast<float *>(component->ptr_inputs);
     auto C = reinterpret_cast<float *>(component->ptr_outputs);
     auto bias = reinterpret_cast<float *>(transform->ptr_biases);
-    for (uint32_t i = 0; i < m; i++) {
+    kernels::parallel_if(static_cast<size_t>(m) * n, m, [&](size_t i) {
+        const float *Brow = B + i * n;
+        float *Crow = C + i * ldc;
         for (uint32_t j = 0; j < n; j++) {
-            C[i * ldc + j] = bias[i];
+            Crow[j] = bias[i] + A[i] * Brow[j];
         }
-    }
-    std::vector<float> Arow(n);
-    for (uint32_t i = 0; i < m; i++) {
-        float *Brow = B + i * n;
-        float *Crow = C + i * ldc;
-        std::fill(std::begin(Arow), std::end(Arow), A[i]);
-        cblas_ssbmv1(CblasRowMajor, CblasLower, n, 0, 1.0, Arow.data(), 1, Brow, 1, 1.0, Crow, 1);
-    }
+    });
 }
 
 void FP::ApplyRecurrentTransform(intel_dnn_component_t *component, uint32_t row, void *ptr_feedbacks) {
@@ -26,6 +26,8 @@
 #endif
 
 #include "pwl.h"
+#include "pwl_design_cache.hpp"
+#include "floatmath_kernels.hpp"
 #include "gna_plugin_log.hpp"
 #include "backend/dnn_types.h"
 #include "gna_slope_scale.h"
@@ -194,84 +196,67 @@ double pivot_search(std::vector<pwl_t>& result, double(*f)(const double),
     return pivot_search(result, fun, first_deriv, N, alpha_0, alpha_N, threshold, negative);
 }
 
-double calculate_error_pct(const DnnActivation& activation_type,
-                            const double l_bound,
-                            const double u_bound,
-                            const double offset,
-                            const int samples) {
+// Span of the function values at the points the approximation error is evaluated at
+static double function_range(const DnnActivation& activation_type,
+                             const double l_bound,
+                             const double u_bound,
+                             const int samples) {
     double delta = (u_bound - l_bound) / (samples + 1);
-    double min_val = 0.0;
-    double max_val = 0.0;
-
-    if ( delta < 0 ) {
-        return 0.0;
+    std::vector<double> values(std::max(samples, 1));
+    for (size_t i = 0; i < values.size(); i++) {
+        values[i] = l_bound + i * delta;
     }
 
+    auto apply = [&values](double (*f)(double)) {
+        for (auto& value : values) value = f(value);
+    };
     switch (activation_type) {
         case kActSigmoid:
-            min_val = max_val = sigmoid(l_bound);
+            apply(sigmoid);
             break;
         case kActTanh:
-            min_val = max_val = tanh(l_bound);
+            apply(tanh);
+            break;
+        case kActSoftSign:
+            apply(softsign);
             break;
         case kActExp:
-            min_val = max_val = exp(l_bound);
+            apply(exp);
             break;
         case kActLog:
-            min_val = max_val = log(l_bound);
+            apply(log);
             break;
         case kActNegLog:
-            min_val = max_val = neglog(l_bound);
+            apply(neglog);
             break;
         case kActNegHalfLog:
-            min_val = max_val = neghalflog(l_bound);
-            break;
-        case kActSoftSign:
-            min_val = max_val = softsign(l_bound);
+            apply(neghalflog);
             break;
         case kActPow:
-            min_val = max_val = pow(activation_type.args.pow.offset + activation_type.args.pow.scale * l_bound, activation_type.args.pow.exponent);
+            for (auto& value : values) {
+                value = pow(activation_type.args.pow.offset + activation_type.args.pow.scale * value, activation_type.args.pow.exponent);
+            }
             break;
         default:
-            break;
+            return 0.0;
     }
 
-    for (int i = 0; i < samples; i++) {
-        double arg = l_bound + i * delta;
-        double val = 0.0;
-        switch (activation_type) {
-            case kActSigmoid:
-                val = sigmoid(arg);
-                break;
-            case kActTanh:
-                val = tanh(arg);
-                break;
-            case kActSoftSign:
-                val = softsign(arg);
-                break;
-            case kActExp:
-                val = exp(arg);
-                break;
-            case kActLog:
-                val = log(arg);
-                break;
-            case kActNegLog:
-                val = neglog(arg);
-                break;
-            case kActNegHalfLog:
-                val = neghalflog(arg);
-                break;
-            case kActPow:
-                val = pow(activation_type.args.pow.offset + activation_type.args.pow.scale * arg, activation_type.args.pow.exponent);
-                break;
-            default:
-                break;
-        }
-        if (val > max_val) max_val = val;
-        if (val < min_val) min_val = val;
+    auto range = std::minmax_element(values.begin(), values.end());
+    return *range.second - *range.first;
+}
+
+double calculate_error_pct(const DnnActivation& activation_type,
+                            const double l_bound,
+                            const double u_bound,
+                            const double offset,
+                            const int samples) {
+    double delta = (u_bound - l_bound) / (samples + 1);
+
+    if ( delta < 0 ) {
+        return 0.0;
     }
 
-    return(100.0 * fabs(offset) / (max_val - min_val));
+    return(100.0 * fabs(offset) / function_range(activation_type, l_bound, u_bound, samples));
 }
 
 double get_break_bound(const DnnActivation& activation_type) {
@@ -340,6 +325,15 @@ std::vector<pwl_t> pwl_search(const DnnActivation& activation_type,
         return pwl;
     }
 
+    const bool is_searched = activation_type != kActIdentity && activation_type != kActKaldiLstmClipping &&
+                             activation_type != kActSign && activation_type != kActAbs;
+    const GNAPluginNS::runtime::PwlDesignCache::Key key(activation_type, l_bound, u_bound, threshold, allowed_err_pct, samples);
+    GNAPluginNS::runtime::PwlDesignCache::Design design;
+    if (is_searched && GNAPluginNS::runtime::PwlDesignCache::instance().find(key, design)) {
+        err_pct = design.err_pct;
+        return design.pwl;
+    }
+
     if (split_search(activation_type, l_bound, u_bound)) {
         std::vector<pwl_t> pwl2;
         double err_pct1 = 0.0, err_pct2 = 0.0;
@@ -446,7 +440,9 @@ std::vector<pwl_t> pwl_search(const DnnActivation& activation_type,
                 default:
                     break;
             }
-            err_pct = calculate_error_pct(activation_type, l_bound, u_bound, err, samples);
+            // the function range doesn't depend on the number of segments
+            const double range = function_range(activation_type, l_bound, u_bound, samples);
+            err_pct = 100.0 * fabs(err) / range;
 
             while ((n_segments < PWL_MAX_ITERATIONS) && (allowed_err_pct < err_pct)) {
                 n_segments += 1;
@@ -484,7 +480,7 @@ std::vector<pwl_t> pwl_search(const DnnActivation& activation_type,
                     default:
                         break;
                 }
-                err_pct = calculate_error_pct(activation_type, l_bound, u_bound, err, samples);
+                err_pct = 100.0 * fabs(err) / range;
             }
 
             if (n_segments >= PWL_MAX_ITERATIONS) {
@@ -492,6 +488,9 @@ std::vector<pwl_t> pwl_search(const DnnActivation& activation_type,
             }
         }
     }
+    if (is_searched) {
+        GNAPluginNS::runtime::PwlDesignCache::instance().insert(key, {pwl, err_pct});
+    }
     return(pwl);
 }
 
@@ -954,11 +953,13 @@ void PwlApply32(intel_dnn_component_t *component, uint32_t num_subset_size) {
     }
 }
 
-void PwlApply32(intel_dnn_component_t *component,
-                uint32_t num_row_start,
-                uint32_t num_row_end,
-                uint32_t num_col_start,
-                uint32_t num_col_end) {
+namespace {
+
+void PwlApply32Range(intel_dnn_component_t *component,
+                     uint32_t num_row_start,
+                     uint32_t num_row_end,
+                     uint32_t num_col_start,
+                     uint32_t num_col_end) {
     intel_piecewiselinear_t *transform = reinterpret_cast<intel_piecewiselinear_t *>(&component->op.pwl);
     float *ptr_in = reinterpret_cast<float *>(component->ptr_inputs);
     float *ptr_out = reinterpret_cast<float *>(component->ptr_outputs);
@@ -1113,3 +1114,42 @@ void PwlApply32(intel_dnn_component_t *component,
             THROW_GNA_EXCEPTION << component->original_layer_name << ", Unknown piecewise linear function type: " << transform->func_id.type;
     }
 }
+
+// Activation functions are mostly transcendental, so every element costs dozens of operations
+constexpr size_t kPwlElementCost = 16;
+
+}  // namespace
+
+void PwlApply32(intel_dnn_component_t *component,
+                uint32_t num_row_start,
+                uint32_t num_row_end,
+                uint32_t num_col_start,
+                uint32_t num_col_end) {
+    const auto type = component->op.pwl.func_id.type;
+    const bool supported = type != kActNone && type != kActLeakyRelu && type != kActCustom && type < kActNumType;
+    const size_t num_rows = num_row_end - num_row_start + 1;
+    const size_t num_cols = num_col_end - num_col_start + 1;
+    const size_t work = num_rows * num_cols * kPwlElementCost;
+    if (!supported || work < GNAPluginNS::runtime::kernels::kParallelWorkThreshold) {
+        // unsupported types throw from the sequential path
+        PwlApply32Range(component, num_row_start, num_row_end, num_col_start, num_col_end);
+        return;
+    }
+
+    if (num_rows > 1) {
+        InferenceEngine::parallel_for(num_rows, [&](size_t i) {
+            const uint32_t row = num_row_start + static_cast<uint32_t>(i);
+            PwlApply32Range(component, row, row, num_col_start, num_col_end);
+        });
+    } else {
+        // a single long row is split into column blocks
+        InferenceEngine::parallel_nt(0, [&](const int ithr, const int nthr) {
+            size_t start = 0, end = 0;
+            InferenceEngine::splitter(num_cols, nthr, ithr, start, end);
+            if (start < end) {
+                PwlApply32Range(component, num_row_start, num_row_end,
+                                num_col_start + static_cast<uint32_t>(start), num_col_start + static_cast<uint32_t>(end - 1));
+            }
+        });
+    }
+}
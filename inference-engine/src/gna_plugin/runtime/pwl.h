@@ -25,6 +25,7 @@
 #define PWL_MAX_NUM_SEGMENTS 128
 #define PWL_DESIGN_THRESHOLD 0.1f
 #define PWL_DESIGN_SAMPLES 500
+#define PWL_SEARCH_VERSION 1  // increment on any change of pwl_search results, stored designs get discarded
 #define ACTIVATION_SCALE_FACTOR 2048.0f
 #define IDENTITY_SCALE_FACTOR 2049.0f
 #define XBASEMASK 0xFFFFFFFC  // only top 30 bits are used
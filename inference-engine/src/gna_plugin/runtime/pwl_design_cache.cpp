@@ -0,0 +1,198 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <random>
+#include <sstream>
+#include <tuple>
+
+#ifdef _WIN32
+#include <process.h>
+#else
+#include <unistd.h>
+#endif
+
+#include <file_utils.h>
+
+#include "pwl_design_cache.hpp"
+#include "gna_plugin_log.hpp"
+
+using namespace GNAPluginNS::runtime;
+
+namespace {
+
+const char kCacheMagic[] = "GNAPWL";
+const uint32_t kCacheVersion = 2;
+const uint32_t kSearchVersion = PWL_SEARCH_VERSION;
+
+template <class T>
+void writeValue(std::ostream& os, const T& value) {
+    os.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template <class T>
+bool readValue(std::istream& is, T& value) {
+    return static_cast<bool>(is.read(reinterpret_cast<char*>(&value), sizeof(T)));
+}
+
+// name unique to the process and the call, so concurrent writers never share the temporary file
+std::string tempFileName(const std::string& path) {
+#ifdef _WIN32
+    const auto pid = _getpid();
+#else
+    const auto pid = getpid();
+#endif
+    std::random_device random;
+    std::ostringstream name;
+    name << path << "." << pid << "." << std::hex << random() << ".tmp";
+    return name.str();
+}
+
+}  // namespace
+
+PwlDesignCache::Key::Key(const DnnActivation& activation_type,
+                         double l_bound,
+                         double u_bound,
+                         double threshold,
+                         double allowed_err_pct,
+                         int samples)
+    : type(activation_type.type),
+      exponent(activation_type == kActPow ? activation_type.args.pow.exponent : 0.0),
+      scale(activation_type == kActPow ? activation_type.args.pow.scale : 0.0),
+      offset(activation_type == kActPow ? activation_type.args.pow.offset : 0.0),
+      l_bound(l_bound),
+      u_bound(u_bound),
+      threshold(threshold),
+      allowed_err_pct(allowed_err_pct),
+      samples(samples) {
+}
+
+bool PwlDesignCache::Key::operator<(const Key& other) const {
+    return std::tie(type, exponent, scale, offset, l_bound, u_bound, threshold, allowed_err_pct, samples) <
+        std::tie(other.type, other.exponent, other.scale, other.offset, other.l_bound, other.u_bound,
+                 other.threshold, other.allowed_err_pct, other.samples);
+}
+
+PwlDesignCache& PwlDesignCache::instance() {
+    static PwlDesignCache cache;
+    return cache;
+}
+
+bool PwlDesignCache::find(const Key& key, Design& design) const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto found = _designs.find(key);
+    if (found == _designs.end()) {
+        return false;
+    }
+    design = found->second;
+    return true;
+}
+
+void PwlDesignCache::insert(const Key& key, const Design& design) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_designs.emplace(key, design).second) {
+        _modified = true;
+    }
+}
+
+void PwlDesignCache::clear() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _designs.clear();
+    _modified = false;
+}
+
+std::string PwlDesignCache::fileName(const std::string& dir) {
+    return FileUtils::makePath(dir, std::string("gna_pwl_design.cache"));
+}
+
+void PwlDesignCache::load(const std::string& dir) {
+    std::ifstream is(fileName(dir), std::ios::in | std::ios::binary | std::ios::ate);
+    if (!is.good()) {
+        return;
+    }
+    const auto fileSize = is.tellg();
+    is.seekg(0);
+
+    char magic[sizeof(kCacheMagic)] = {};
+    uint32_t version = 0;
+    uint32_t searchVersion = 0;
+    uint64_t count = 0;
+    is.read(magic, sizeof(magic));
+    if (!is.good() || std::memcmp(magic, kCacheMagic, sizeof(magic)) != 0 ||
+        !readValue(is, version) || version != kCacheVersion ||
+        !readValue(is, searchVersion) || searchVersion != kSearchVersion || !readValue(is, count)) {
+        gnawarn() << "Ignoring incompatible PWL design cache " << fileName(dir) << "\n";
+        return;
+    }
+
+    std::map<Key, Design> designs;
+    for (uint64_t i = 0; i < count; i++) {
+        Key key(DnnActivation::fromType(kActNone), 0.0, 0.0, 0.0, 0.0, 0);
+        Design design;
+        uint64_t segments = 0;
+        if (!readValue(is, key) || !readValue(is, design.err_pct) || !readValue(is, segments) ||
+            segments > static_cast<uint64_t>(fileSize - is.tellg()) / sizeof(pwl_t)) {
+            gnawarn() << "Ignoring truncated PWL design cache " << fileName(dir) << "\n";
+            return;
+        }
+        design.pwl.resize(segments);
+        if (segments != 0 &&
+            !is.read(reinterpret_cast<char*>(design.pwl.data()), segments * sizeof(pwl_t))) {
+            gnawarn() << "Ignoring truncated PWL design cache " << fileName(dir) << "\n";
+            return;
+        }
+        designs.emplace(key, std::move(design));
+    }
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    // designs found by this process are kept, they are equal to the stored ones anyway
+    _designs.insert(designs.begin(), designs.end());
+    gnalog() << "Loaded " << designs.size() << " PWL designs from " << fileName(dir) << "\n";
+}
+
+void PwlDesignCache::save(const std::string& dir) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (!_modified) {
+        return;
+    }
+
+    // the file is written aside and then replaced, so concurrent processes never read a partially written cache
+    auto path = fileName(dir);
+    auto tmpPath = tempFileName(path);
+    {
+        std::ofstream os(tmpPath, std::ios::out | std::ios::binary | std::ios::trunc);
+        if (!os.good()) {
+            gnawarn() << "Cannot write PWL design cache " << path << "\n";
+            return;
+        }
+        os.write(kCacheMagic, sizeof(kCacheMagic));
+        writeValue(os, kCacheVersion);
+        writeValue(os, kSearchVersion);
+        writeValue(os, static_cast<uint64_t>(_designs.size()));
+        for (const auto& design : _designs) {
+            writeValue(os, design.first);
+            writeValue(os, design.second.err_pct);
+            writeValue(os, static_cast<uint64_t>(design.second.pwl.size()));
+            os.write(reinterpret_cast<const char*>(design.second.pwl.data()),
+                     design.second.pwl.size() * sizeof(pwl_t));
+        }
+        if (!os.good()) {
+            gnawarn() << "Cannot write PWL design cache " << path << "\n";
+            return;
+        }
+    }
+    if (std::rename(tmpPath.c_str(), path.c_str()) != 0) {
+        // rename doesn't replace an existing file on Windows
+        std::remove(path.c_str());
+        if (std::rename(tmpPath.c_str(), path.c_str()) != 0) {
+            gnawarn() << "Cannot write PWL design cache " << path << "\n";
+            std::remove(tmpPath.c_str());
+            return;
+        }
+    }
+    _modified = false;
+}
@@ -0,0 +1,76 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "backend/dnn_types.h"
+#include "pwl.h"
+
+namespace GNAPluginNS {
+namespace runtime {
+
+/**
+ * @brief Process-wide storage of PWL approximations found by pwl_search, so activations with the same
+ * function, bounds and error budget designed by any network are searched only once.
+ * The approximations can be persisted in a directory to be reused by following processes.
+ */
+class PwlDesignCache {
+public:
+    struct Key {
+        DnnActivationType type;
+        // arguments of kActPow, zeros for other functions
+        double exponent;
+        double scale;
+        double offset;
+        double l_bound;
+        double u_bound;
+        double threshold;
+        double allowed_err_pct;
+        int samples;
+
+        Key(const DnnActivation& activation_type,
+            double l_bound,
+            double u_bound,
+            double threshold,
+            double allowed_err_pct,
+            int samples);
+        bool operator<(const Key& other) const;
+    };
+
+    struct Design {
+        std::vector<pwl_t> pwl;
+        double err_pct;
+    };
+
+    static PwlDesignCache& instance();
+
+    bool find(const Key& key, Design& design) const;
+    void insert(const Key& key, const Design& design);
+    void clear();
+
+    /**
+     * @brief Merges approximations stored in the directory, missing or incompatible file is ignored
+     */
+    void load(const std::string& dir);
+
+    /**
+     * @brief Stores all the approximations in the directory if any were found since the last load or save
+     */
+    void save(const std::string& dir);
+
+private:
+    static std::string fileName(const std::string& dir);
+
+    mutable std::mutex _mutex;
+    std::map<Key, Design> _designs;
+    bool _modified = false;
+};
+
+}  // namespace runtime
+}  // namespace GNAPluginNS
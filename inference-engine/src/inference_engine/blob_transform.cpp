@@ -4,283 +4,321 @@
 
 #include "blob_transform.hpp"
 
+#include "ie_parallel.hpp"
 #include "ie_system_conf.h"
 #ifdef HAVE_SSE
 #include "cpu_x86_sse42/blob_transform_sse42.hpp"
 #endif
+#ifdef HAVE_AVX2
+#include "cpu_x86_avx2/blob_transform_avx2.hpp"
+#endif
+#ifdef HAVE_AVX512
+#include "cpu_x86_avx512/blob_transform_avx512.hpp"
+#endif
 
+#include <algorithm>
 #include <cstdint>
 #include <cstdlib>
+#include <cstring>
+#include <vector>
 
 //----------------------------------------------------------------------
 
 namespace InferenceEngine {
 
-template <InferenceEngine::Precision::ePrecision PRC>
-static void blob_copy_4d_t(Blob::Ptr src, Blob::Ptr dst) {
-    using data_t = typename InferenceEngine::PrecisionTrait<PRC>::value_type;
+namespace {
+
+// Every thread copies blocks of about this size, so the source and destination lines of a block stay in cache
+constexpr size_t kBlockBytes = 32 * 1024;
+// Smaller blobs are copied by the calling thread
+constexpr size_t kParallelBytes = 256 * 1024;
+
+struct CopyDim {
+    size_t size;
+    size_t src_stride;
+    size_t dst_stride;
+};
+
+SizeVector logical_strides(const TensorDesc& desc) {
+    const auto& blk_desc = desc.getBlockingDesc();
+    const auto& order = blk_desc.getOrder();
+    if (order.size() != desc.getDims().size())
+        IE_THROW() << "Unimplemented blob transformation for blocked layout " << desc.getLayout();
+
+    SizeVector strides(order.size());
+    for (size_t i = 0; i < order.size(); i++)
+        strides[order[i]] = blk_desc.getStrides()[i];
+    return strides;
+}
+
+// Dimensions of the copy in the memory order of the source. Dimensions of size 1 are dropped and the ones
+// contiguous in both blobs are merged, e.g. planes of NCHW -> NHWC copy are a single dimension.
+std::vector<CopyDim> copy_dims(const TensorDesc& src, const TensorDesc& dst) {
+    const auto& dims = src.getDims();
+    const auto src_strides = logical_strides(src);
+    const auto dst_strides = logical_strides(dst);
+
+    std::vector<CopyDim> result;
+    for (auto axis : src.getBlockingDesc().getOrder()) {
+        if (dims[axis] == 1)
+            continue;
+
+        CopyDim dim = {dims[axis], src_strides[axis], dst_strides[axis]};
+        if (!result.empty() && result.back().src_stride == dim.size * dim.src_stride &&
+            result.back().dst_stride == dim.size * dim.dst_stride) {
+            dim.size *= result.back().size;
+            result.back() = dim;
+        } else {
+            result.push_back(dim);
+        }
+    }
+    return result;
+}
+
+//----------------------------------------------------------------------
+//
+// Transposition kernels: dst[j * dst_ld + i] = src[i * src_ld + j]
+//
+//----------------------------------------------------------------------
 
-    auto* src_ptr = src->buffer().as<data_t*>();
-    auto* dst_ptr = dst->buffer().as<data_t*>();
+template <typename T>
+using transpose_t = void (*)(const T* src, size_t src_ld, T* dst, size_t dst_ld, size_t rows, size_t cols);
+
+template <typename T>
+void transpose_ref(const T* src, size_t src_ld, T* dst, size_t dst_ld, size_t rows, size_t cols) {
+    constexpr size_t tile = 16;
+    for (size_t i0 = 0; i0 < rows; i0 += tile) {
+        const size_t i1 = std::min(rows, i0 + tile);
+        for (size_t j0 = 0; j0 < cols; j0 += tile) {
+            const size_t j1 = std::min(cols, j0 + tile);
+            for (size_t i = i0; i < i1; i++)
+                for (size_t j = j0; j < j1; j++)
+                    dst[j * dst_ld + i] = src[i * src_ld + j];
+        }
+    }
+}
 
-    SizeVector dims = src->getTensorDesc().getDims();
+#ifdef HAVE_SSE
+// 3 planes to interleaved pixels and back, the rows of the split are pixels and the columns are channels
+void merge_u8c3(const uint8_t* src, size_t src_ld, uint8_t* dst, size_t, size_t, size_t cols) {
+    blob_copy_4d_merge_u8c3(src, dst, 0, 0, src_ld, 0, 0, 1, 1, static_cast<int>(cols));
+}
 
-    size_t N = dims[0];
-    size_t C = dims[1];
-    size_t H = dims[2];
-    size_t W = dims[3];
+void split_u8c3(const uint8_t* src, size_t, uint8_t* dst, size_t dst_ld, size_t rows, size_t) {
+    blob_copy_4d_split_u8c3(src, dst, 0, 0, 0, 0, dst_ld, 1, 1, static_cast<int>(rows));
+}
 
-    const Layout src_l = src->getTensorDesc().getLayout();
-    const auto& src_blk_dsc = src->getTensorDesc().getBlockingDesc();
-    const auto& src_strides = src_blk_dsc.getStrides();
-    const auto N_src_stride = src_strides[0];
-    const auto C_src_stride = src_l == NHWC ? src_strides[3] : src_strides[1];
-    const auto H_src_stride = src_l == NHWC ? src_strides[1] : src_strides[2];
-    const auto W_src_stride = src_l == NHWC ? src_strides[2] : src_strides[3];
-    src_ptr += src_blk_dsc.getOffsetPadding();
+void merge_u32c3(const uint32_t* src, size_t src_ld, uint32_t* dst, size_t, size_t, size_t cols) {
+    blob_copy_4d_merge_f32c3(reinterpret_cast<const float*>(src), reinterpret_cast<float*>(dst), 0, 0, src_ld, 0, 0,
+                             1, 1, static_cast<int>(cols));
+}
 
-    const Layout dst_l = dst->getTensorDesc().getLayout();
-    const auto& dst_blk_desc = dst->getTensorDesc().getBlockingDesc();
-    const auto& dst_strides = dst_blk_desc.getStrides();
-    const auto N_dst_stride = dst_strides[0];
-    const auto C_dst_stride = dst_l == NHWC ? dst_strides[3] : dst_strides[1];
-    const auto H_dst_stride = dst_l == NHWC ? dst_strides[1] : dst_strides[2];
-    const auto W_dst_stride = dst_l == NHWC ? dst_strides[2] : dst_strides[3];
+void split_u32c3(const uint32_t* src, size_t, uint32_t* dst, size_t dst_ld, size_t rows, size_t) {
+    blob_copy_4d_split_f32c3(reinterpret_cast<const float*>(src), reinterpret_cast<float*>(dst), 0, 0, 0, 0, dst_ld,
+                             1, 1, static_cast<int>(rows));
+}
+#endif  // HAVE_SSE
 
-    src_ptr += dst_blk_desc.getOffsetPadding();
+template <typename T>
+transpose_t<T> select_transpose(size_t, size_t, size_t, size_t) {
+    return transpose_ref<T>;
+}
 
+template <>
+transpose_t<uint8_t> select_transpose<uint8_t>(size_t rows, size_t cols, size_t src_ld, size_t dst_ld) {
 #ifdef HAVE_SSE
-    if (src->getTensorDesc().getLayout() == NHWC && dst->getTensorDesc().getLayout() == NCHW && C == 3 &&
-        C_src_stride == 1 && W_src_stride == 3 && W_dst_stride == 1 && with_cpu_x86_sse42()) {
-        if (PRC == Precision::U8) {
-            blob_copy_4d_split_u8c3(reinterpret_cast<const uint8_t*>(src_ptr), reinterpret_cast<uint8_t*>(dst_ptr),
-                                    N_src_stride, H_src_stride, N_dst_stride, H_dst_stride, C_dst_stride,
-                                    static_cast<int>(N), static_cast<int>(H), static_cast<int>(W));
-            return;
-        }
+    if (rows == 3 && dst_ld == 3 && with_cpu_x86_sse42())
+        return merge_u8c3;
+    if (cols == 3 && src_ld == 3 && with_cpu_x86_sse42())
+        return split_u8c3;
+#endif
+#ifdef HAVE_AVX2
+    if (with_cpu_x86_avx2())
+        return blob_transpose_u8_avx2;
+#endif
+    return transpose_ref<uint8_t>;
+}
 
-        if (PRC == Precision::FP32) {
-            blob_copy_4d_split_f32c3(reinterpret_cast<const float*>(src_ptr), reinterpret_cast<float*>(dst_ptr),
-                                     N_src_stride, H_src_stride, N_dst_stride, H_dst_stride, C_dst_stride,
-                                     static_cast<int>(N), static_cast<int>(H), static_cast<int>(W));
-            return;
-        }
-    }
+template <>
+transpose_t<uint16_t> select_transpose<uint16_t>(size_t, size_t, size_t, size_t) {
+#ifdef HAVE_AVX2
+    if (with_cpu_x86_avx2())
+        return blob_transpose_u16_avx2;
+#endif
+    return transpose_ref<uint16_t>;
+}
 
-    if (src->getTensorDesc().getLayout() == NCHW && dst->getTensorDesc().getLayout() == NHWC && C == 3 &&
-        C_dst_stride == 1 && W_dst_stride == 3 && W_src_stride == 1 && with_cpu_x86_sse42()) {
-        if (PRC == Precision::U8) {
-            blob_copy_4d_merge_u8c3(reinterpret_cast<const uint8_t*>(src_ptr), reinterpret_cast<uint8_t*>(dst_ptr),
-                                    N_src_stride, H_src_stride, C_src_stride, N_dst_stride, H_dst_stride,
-                                    static_cast<int>(N), static_cast<int>(H), static_cast<int>(W));
-            return;
-        }
+template <>
+transpose_t<uint32_t> select_transpose<uint32_t>(size_t rows, size_t cols, size_t src_ld, size_t dst_ld) {
+#ifdef HAVE_SSE
+    if (rows == 3 && dst_ld == 3 && with_cpu_x86_sse42())
+        return merge_u32c3;
+    if (cols == 3 && src_ld == 3 && with_cpu_x86_sse42())
+        return split_u32c3;
+#endif
+#ifdef HAVE_AVX512
+    if (with_cpu_x86_avx512f())
+        return blob_transpose_u32_avx512;
+#endif
+#ifdef HAVE_AVX2
+    if (with_cpu_x86_avx2())
+        return blob_transpose_u32_avx2;
+#endif
+    return transpose_ref<uint32_t>;
+}
 
-        if (PRC == Precision::FP32) {
-            blob_copy_4d_merge_f32c3(reinterpret_cast<const float*>(src_ptr), reinterpret_cast<float*>(dst_ptr),
-                                     N_src_stride, H_src_stride, C_src_stride, N_dst_stride, H_dst_stride,
-                                     static_cast<int>(N), static_cast<int>(H), static_cast<int>(W));
-            return;
-        }
+//----------------------------------------------------------------------
+//
+// Generic copy: the innermost one or two dimensions are copied by a kernel, the rest of them and the blocks
+// of the longest inner dimension are distributed between threads
+//
+//----------------------------------------------------------------------
+
+template <typename T>
+void blob_copy_t(const T* src_ptr, T* dst_ptr, std::vector<CopyDim> dims) {
+    if (dims.empty()) {
+        *dst_ptr = *src_ptr;
+        return;
     }
-#else
-    (void)H_dst_stride;
-#endif  // HAVE_SSE
 
-    if (src->getTensorDesc().getLayout() == NHWC && dst->getTensorDesc().getLayout() == NCHW) {
-        for (size_t n = 0; n < N; n++) {
-            for (size_t c = 0; c < C; c++) {
-                data_t* dst_ptr_l = dst_ptr + n * N_dst_stride + c * C_dst_stride;
-                data_t* src_ptr_l = src_ptr + n * N_src_stride + c * C_src_stride;
-                for (size_t h = 0; h < H; h++) {
-                    data_t* src_ptr_l_l = src_ptr_l + h * H_src_stride;
-                    for (size_t w = 0; w < W; w++) {
-                        *dst_ptr_l = *src_ptr_l_l;
-                        src_ptr_l_l += W_src_stride;
-                        dst_ptr_l++;
-                    }
-                }
-            }
-        }
-    } else if (src->getTensorDesc().getLayout() == NCHW && dst->getTensorDesc().getLayout() == NHWC) {
-        for (size_t n = 0; n < N; n++) {
-            for (size_t c = 0; c < C; c++) {
-                data_t* src_ptr_l = src_ptr + n * N_src_stride + c * C_src_stride;
-                data_t* dst_ptr_l = dst_ptr + n * N_dst_stride + c;
-                for (size_t h = 0; h < H; h++) {
-                    data_t* src_ptr_l_l = src_ptr_l + h * H_src_stride;
-                    for (size_t w = 0; w < W; w++) {
-                        *dst_ptr_l = *src_ptr_l_l;
-                        dst_ptr_l += W_dst_stride;
-                        src_ptr_l_l++;
-                    }
-                }
-            }
-        }
+    const auto src_inner = std::find_if(dims.begin(), dims.end(), [](const CopyDim& dim) {
+        return dim.src_stride == 1;
+    });
+    const auto dst_inner = std::find_if(dims.begin(), dims.end(), [](const CopyDim& dim) {
+        return dim.dst_stride == 1;
+    });
+
+    enum { COPY, TRANSPOSE, STRIDED } mode;
+    CopyDim rows = {1, 0, 0};  // the destination contiguous dimension of the transposition
+    CopyDim cols = {1, 0, 0};  // the source contiguous dimension, or the only inner dimension for copies
+    if (src_inner != dims.end() && src_inner == dst_inner) {
+        mode = COPY;
+        cols = *src_inner;
+    } else if (src_inner != dims.end() && dst_inner != dims.end()) {
+        mode = TRANSPOSE;
+        rows = *dst_inner;
+        cols = *src_inner;
     } else {
-        for (size_t i = 0; i < N * C * H * W; i++) {
-            dst_ptr[i] = src_ptr[i];
-        }
+        mode = STRIDED;
+        cols = dims.back();
     }
-}
 
-static inline void blob_copy_4d(Blob::Ptr src, Blob::Ptr dst) {
-    switch (src->getTensorDesc().getPrecision()) {
-    case Precision::FP32:
-    case Precision::I32:
-    case Precision::U32:
-        blob_copy_4d_t<Precision::FP32>(src, dst);
-        break;
-
-    case Precision::FP16:
-    case Precision::U16:
-    case Precision::I16:
-        blob_copy_4d_t<Precision::U16>(src, dst);
-        break;
+    std::vector<CopyDim> outer;
+    size_t outer_count = 1;
+    for (auto it = dims.begin(); it != dims.end(); ++it) {
+        if ((mode != STRIDED && (it == src_inner || it == dst_inner)) || (mode == STRIDED && it + 1 == dims.end()))
+            continue;
+        outer.push_back(*it);
+        outer_count *= it->size;
+    }
 
-    case Precision::U8:
-    case Precision::I8:
-        blob_copy_4d_t<Precision::U8>(src, dst);
-        break;
+    // the longer inner dimension is split to the blocks, the shorter one is always copied as a whole
+    const bool split_rows = rows.size > cols.size;
+    const size_t long_size = split_rows ? rows.size : cols.size;
+    const size_t short_size = split_rows ? cols.size : rows.size;
+    size_t block = std::max<size_t>(kBlockBytes / (short_size * sizeof(T)), 16);
+    block = (block + 15) / 16 * 16;
+    const size_t blocks = (long_size + block - 1) / block;
+
+    const transpose_t<T> transpose =
+        mode == TRANSPOSE ? select_transpose<T>(rows.size, cols.size, rows.src_stride, cols.dst_stride) : nullptr;
+
+    auto copy_block = [&](size_t task) {
+        const size_t begin = (task % blocks) * block;
+        const size_t size = std::min(block, long_size - begin);
+
+        const T* src = src_ptr;
+        T* dst = dst_ptr;
+        size_t index = task / blocks;
+        for (auto it = outer.rbegin(); it != outer.rend(); ++it) {
+            const size_t i = index % it->size;
+            index /= it->size;
+            src += i * it->src_stride;
+            dst += i * it->dst_stride;
+        }
+        const CopyDim& split = split_rows ? rows : cols;
+        src += begin * split.src_stride;
+        dst += begin * split.dst_stride;
+
+        switch (mode) {
+        case COPY:
+            std::memcpy(dst, src, size * sizeof(T));
+            break;
+        case TRANSPOSE:
+            if (split_rows)
+                transpose(src, rows.src_stride, dst, cols.dst_stride, size, cols.size);
+            else
+                transpose(src, rows.src_stride, dst, cols.dst_stride, rows.size, size);
+            break;
+        case STRIDED:
+            for (size_t i = 0; i < size; i++)
+                dst[i * cols.dst_stride] = src[i * cols.src_stride];
+            break;
+        }
+    };
 
-    default:
-        IE_THROW() << "Unsupported blob transformation for precision " << src->getTensorDesc().getPrecision();
+    const size_t tasks = outer_count * blocks;
+    if (outer_count * long_size * short_size * sizeof(T) < kParallelBytes) {
+        for (size_t task = 0; task < tasks; task++)
+            copy_block(task);
+    } else {
+        parallel_for(tasks, copy_block);
     }
 }
 
-template <InferenceEngine::Precision::ePrecision PRC>
-static void blob_copy_5d_t(Blob::Ptr src, Blob::Ptr dst) {
-    using data_t = typename InferenceEngine::PrecisionTrait<PRC>::value_type;
+template <typename T>
+void blob_copy_t(Blob::Ptr src, Blob::Ptr dst) {
+    const auto& src_desc = src->getTensorDesc();
+    const auto& dst_desc = dst->getTensorDesc();
 
-    const auto& src_blk_desc = src->getTensorDesc().getBlockingDesc();
-    const auto& dst_blk_desc = dst->getTensorDesc().getBlockingDesc();
+    const T* src_ptr = src->cbuffer().as<const T*>() + src_desc.getBlockingDesc().getOffsetPadding();
+    T* dst_ptr = dst->buffer().as<T*>() + dst_desc.getBlockingDesc().getOffsetPadding();
 
-    data_t* src_ptr = src->buffer().as<data_t*>() + src_blk_desc.getOffsetPadding();
-    data_t* dst_ptr = dst->buffer().as<data_t*>() + dst_blk_desc.getOffsetPadding();
-
-    SizeVector dims = src->getTensorDesc().getDims();  // == dst's dims
-
-    const size_t N = dims[0];
-    const size_t C = dims[1];
-    const size_t D = dims[2];
-    const size_t H = dims[3];
-    const size_t W = dims[4];
+    blob_copy_t(src_ptr, dst_ptr, copy_dims(src_desc, dst_desc));
+}
 
-    const Layout src_l = src->getTensorDesc().getLayout();
-    const auto& src_strides = src_blk_desc.getStrides();
-    const auto N_src_stride = src_strides[0];
-    const auto C_src_stride = src_l == NDHWC ? src_strides[4] : src_strides[1];
-    const auto D_src_stride = src_l == NDHWC ? src_strides[1] : src_strides[2];
-    const auto H_src_stride = src_l == NDHWC ? src_strides[2] : src_strides[3];
-    const auto W_src_stride = src_l == NDHWC ? src_strides[3] : src_strides[4];
+}  // namespace
 
-    const Layout dst_l = dst->getTensorDesc().getLayout();
-    const auto& dst_strides = dst_blk_desc.getStrides();
-    const auto N_dst_stride = dst_strides[0];
-    const auto C_dst_stride = dst_l == NDHWC ? dst_strides[4] : dst_strides[1];
-    const auto D_dst_stride = dst_l == NDHWC ? dst_strides[1] : dst_strides[2];
-    const auto H_dst_stride = dst_l == NDHWC ? dst_strides[2] : dst_strides[3];
-    const auto W_dst_stride = dst_l == NDHWC ? dst_strides[3] : dst_strides[4];
+void blob_copy(Blob::Ptr src, Blob::Ptr dst) {
+    if (src->buffer() == nullptr) IE_THROW() << "Cannot copy blob data. Source is not allocated.";
 
-#ifdef HAVE_SSE
-    if (src->getTensorDesc().getLayout() == NDHWC && dst->getTensorDesc().getLayout() == NCDHW && C == 3 &&
-        C_src_stride == 1 && W_src_stride == 3 && W_dst_stride == 1 && with_cpu_x86_sse42()) {
-        if (PRC == Precision::U8) {
-            blob_copy_5d_split_u8c3(reinterpret_cast<const uint8_t*>(src_ptr), reinterpret_cast<uint8_t*>(dst_ptr),
-                                    N_src_stride, D_src_stride, H_src_stride, N_dst_stride, D_dst_stride, H_dst_stride,
-                                    C_dst_stride, static_cast<int>(N), static_cast<int>(D), static_cast<int>(H),
-                                    static_cast<int>(W));
-            return;
-        }
+    if (dst->buffer() == nullptr) IE_THROW() << "Cannot copy blob data. Destination is not allocated.";
 
-        if (PRC == Precision::FP32) {
-            blob_copy_5d_split_f32c3(reinterpret_cast<const float*>(src_ptr), reinterpret_cast<float*>(dst_ptr),
-                                     N_src_stride, D_src_stride, H_src_stride, N_dst_stride, D_dst_stride, H_dst_stride,
-                                     C_dst_stride, static_cast<int>(N), static_cast<int>(D), static_cast<int>(H),
-                                     static_cast<int>(W));
-            return;
-        }
-    }
+    if (src->getTensorDesc().getPrecision() != dst->getTensorDesc().getPrecision())
+        IE_THROW() << "Unimplemented blob transformation from precision " << src->getTensorDesc().getPrecision()
+                           << " to " << src->getTensorDesc().getPrecision();
 
-    if (src->getTensorDesc().getLayout() == NCDHW && dst->getTensorDesc().getLayout() == NDHWC && C == 3 &&
-        C_dst_stride == 1 && W_dst_stride == 3 && W_src_stride == 1 && with_cpu_x86_sse42()) {
-        if (PRC == Precision::U8) {
-            blob_copy_5d_merge_u8c3(reinterpret_cast<const uint8_t*>(src_ptr), reinterpret_cast<uint8_t*>(dst_ptr),
-                                    N_src_stride, D_src_stride, H_src_stride, C_src_stride, N_dst_stride, D_dst_stride,
-                                    H_dst_stride, static_cast<int>(N), static_cast<int>(D), static_cast<int>(H),
-                                    static_cast<int>(W));
-            return;
-        }
+    if (src->getTensorDesc().getDims() != dst->getTensorDesc().getDims())
+        IE_THROW() << "Unimplemented blob transformation from different shapes ";
 
-        if (PRC == Precision::FP32) {
-            blob_copy_5d_merge_f32c3(reinterpret_cast<const float*>(src_ptr), reinterpret_cast<float*>(dst_ptr),
-                                     N_src_stride, D_src_stride, H_src_stride, C_src_stride, N_dst_stride, D_dst_stride,
-                                     H_dst_stride, static_cast<int>(N), static_cast<int>(D), static_cast<int>(H),
-                                     static_cast<int>(W));
-            return;
-        }
-    }
-#else
-    (void)H_dst_stride;
-#endif  // HAVE_SSE
-    if (src->getTensorDesc().getLayout() == NDHWC && dst->getTensorDesc().getLayout() == NCDHW) {
-        for (size_t n = 0; n < N; n++) {
-            for (size_t c = 0; c < C; c++) {
-                for (size_t d = 0; d < D; d++) {
-                    data_t* dst_ptr_l = dst_ptr + n * N_dst_stride + c * C_dst_stride + d * D_dst_stride;
-                    data_t* src_ptr_l = src_ptr + n * N_src_stride + c * C_src_stride + d * D_src_stride;
-                    for (size_t h = 0; h < H; h++) {
-                        data_t* src_ptr_l_l = src_ptr_l + h * H_src_stride;
-                        for (size_t w = 0; w < W; w++) {
-                            *dst_ptr_l = *src_ptr_l_l;
-                            src_ptr_l_l += W_src_stride;
-                            dst_ptr_l++;
-                        }
-                    }
-                }
-            }
-        }
-    } else if (src->getTensorDesc().getLayout() == NCDHW && dst->getTensorDesc().getLayout() == NDHWC) {
-        for (size_t n = 0; n < N; n++) {
-            for (size_t c = 0; c < C; c++) {
-                for (size_t d = 0; d < D; d++) {
-                    data_t* src_ptr_l = src_ptr + n * N_src_stride + c * C_src_stride + d * D_src_stride;
-                    data_t* dst_ptr_l = dst_ptr + n * N_dst_stride + c + d * D_dst_stride;
-                    for (size_t h = 0; h < H; h++) {
-                        data_t* src_ptr_l_l = src_ptr_l + h * H_src_stride;
-                        for (size_t w = 0; w < W; w++) {
-                            *dst_ptr_l = *src_ptr_l_l;
-                            dst_ptr_l += W_dst_stride;
-                            src_ptr_l_l++;
-                        }
-                    }
-                }
-            }
-        }
-    } else {
-        for (size_t i = 0; i < N * C * D * H * W; i++) {
-            dst_ptr[i] = src_ptr[i];
-        }
-    }
-}
+    const auto rank = src->getTensorDesc().getDims().size();
+    if (rank != 4 && rank != 5)
+        IE_THROW() << "Unimplemented blob transformation. Only 4d or 5d supported.";
 
-static inline void blob_copy_5d(Blob::Ptr src, Blob::Ptr dst) {
+    // elements are only moved, so the copy depends on the element size only
     switch (src->getTensorDesc().getPrecision()) {
+    case Precision::FP64:
+    case Precision::I64:
+    case Precision::U64:
+        blob_copy_t<uint64_t>(src, dst);
+        break;
+
     case Precision::FP32:
     case Precision::I32:
     case Precision::U32:
-        blob_copy_5d_t<Precision::FP32>(src, dst);
+        blob_copy_t<uint32_t>(src, dst);
         break;
 
     case Precision::FP16:
+    case Precision::BF16:
     case Precision::U16:
     case Precision::I16:
-        blob_copy_5d_t<Precision::U16>(src, dst);
+        blob_copy_t<uint16_t>(src, dst);
         break;
 
     case Precision::U8:
     case Precision::I8:
-        blob_copy_5d_t<Precision::U8>(src, dst);
+        blob_copy_t<uint8_t>(src, dst);
         break;
 
     default:
@@ -288,24 +326,4 @@ static inline void blob_copy_5d(Blob::Ptr src, Blob::Ptr dst) {
     }
 }
 
-void blob_copy(Blob::Ptr src, Blob::Ptr dst) {
-    if (src->buffer() == nullptr) IE_THROW() << "Cannot copy blob data. Source is not allocated.";
-
-    if (dst->buffer() == nullptr) IE_THROW() << "Cannot copy blob data. Destination is not allocated.";
-
-    if (src->getTensorDesc().getPrecision() != dst->getTensorDesc().getPrecision())
-        IE_THROW() << "Unimplemented blob transformation from precision " << src->getTensorDesc().getPrecision()
-                           << " to " << src->getTensorDesc().getPrecision();
-
-    if (src->getTensorDesc().getDims() != dst->getTensorDesc().getDims())
-        IE_THROW() << "Unimplemented blob transformation from different shapes ";
-
-    if (src->getTensorDesc().getDims().size() == 4)
-        blob_copy_4d(src, dst);
-    else if (src->getTensorDesc().getDims().size() == 5)
-        blob_copy_5d(src, dst);
-    else
-        IE_THROW() << "Unimplemented blob transformation. Only 4d or 5d supported.";
-}
-
 }  // namespace InferenceEngine
@@ -13,13 +13,18 @@
 #include <xml_parse_utils.h>
 
 #include "ie_itt.hpp"
+#include "ie_data_hash.hpp"
 #include "cpp_interfaces/exception2status.hpp"
+#include "ie_parallel.hpp"
 #include "transformations/serialize.hpp"
 #include "cpp/ie_cnn_network.h"
 #include "details/ie_exception.hpp"
 
 #include "ngraph/variant.hpp"
 #include "ngraph/opsets/opset6.hpp"
+#include "ngraph/op/util/sub_graph_base.hpp"
+#include "ngraph/op/util/variable.hpp"
+#include "ngraph/runtime/aligned_buffer.hpp"
 #include "transformations/rt_info/dequantization_attribute.hpp"
 #include "transformations/rt_info/fused_names_attribute.hpp"
 #include "transformations/rt_info/primitives_priority_attribute.hpp"
@@ -47,19 +52,169 @@ class OstreamHashWrapper final: public std::streambuf {
 public:
     std::size_t getResult() const { return m_res; }
     std::streamsize xsputn(const char* s, std::streamsize n) override {
-        const std::int64_t* intS = (const std::int64_t *)s;
-        std::streamsize n64 = n / sizeof(std::int64_t);
-        std::streamsize i = 0;
-        // Using 64-bit values executes much faster than char
-        while (i++ < n64) {
-            m_res += *(intS++);
+        m_res = hash_combine(m_res, data_hash(s, static_cast<std::size_t>(n)));
+        return n;
+    }
+};
+
+// Computes hash of ngraph::Function without serialization. Node attributes are taken
+// through AttributeVisitor, the content of constants is hashed at the end in parallel.
+class FunctionHashVisitor final : public ngraph::AttributeVisitor {
+    std::size_t m_seed = {};
+    std::vector<std::pair<const void*, std::size_t>> m_buffers;
+
+    template <typename T>
+    void hashValue(const std::string& name, const T& value) {
+        m_seed = hash_combine(m_seed, name);
+        m_seed = hash_combine(m_seed, value);
+    }
+
+    template <typename T>
+    void hashValues(const std::string& name, const std::vector<T>& values) {
+        m_seed = hash_combine(m_seed, name);
+        m_seed = hash_combine(m_seed, values.size());
+        for (const auto& value : values) {
+            m_seed = hash_combine(m_seed, value);
         }
+    }
 
-        std::streamsize rest = n % sizeof(std::int64_t);
-        for (i = 0; i < rest; i++) {
-            m_res += s[n - rest + i];
+    void hashPartialShape(const ngraph::PartialShape& shape) {
+        m_seed = hash_combine(m_seed, shape.rank().is_dynamic());
+        if (shape.rank().is_dynamic())
+            return;
+        for (const auto& dim : shape) {
+            m_seed = hash_combine(m_seed, dim.get_min_length());
+            m_seed = hash_combine(m_seed, dim.get_max_length());
         }
-        return n;
+    }
+
+public:
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<void>& adapter) override {
+        using namespace ngraph::op::util;
+        m_seed = hash_combine(m_seed, name);
+        if (auto a = ngraph::as_type<ngraph::AttributeAdapter<std::shared_ptr<ngraph::runtime::AlignedBuffer>>>(&adapter)) {
+            // Content is hashed later, in parallel with other constants
+            m_seed = hash_combine(m_seed, a->get()->size());
+            m_buffers.emplace_back(a->get()->get_ptr(), a->get()->size());
+        } else if (auto a = ngraph::as_type<ngraph::AttributeAdapter<std::shared_ptr<ngraph::Variable>>>(&adapter)) {
+            const auto& info = a->get()->get_info();
+            m_seed = hash_combine(m_seed, info.variable_id);
+            m_seed = hash_combine(m_seed, info.data_type.get_type_name());
+            hashPartialShape(info.data_shape);
+        } else if (auto a = ngraph::as_type<ngraph::AttributeAdapter<
+                std::vector<std::shared_ptr<SubGraphOp::InputDescription>>>>(&adapter)) {
+            for (const auto& desc : a->get()) {
+                m_seed = hash_combine(m_seed, std::string(desc->get_type_info().name));
+                m_seed = hash_combine(m_seed, desc->m_input_index);
+                m_seed = hash_combine(m_seed, desc->m_body_parameter_index);
+                if (auto slice = ngraph::as_type_ptr<SubGraphOp::SliceInputDescription>(desc)) {
+                    for (auto v : {slice->m_start, slice->m_stride, slice->m_part_size, slice->m_end, slice->m_axis})
+                        m_seed = hash_combine(m_seed, v);
+                } else if (auto merged = ngraph::as_type_ptr<SubGraphOp::MergedInputDescription>(desc)) {
+                    m_seed = hash_combine(m_seed, merged->m_body_value_index);
+                }
+            }
+        } else if (auto a = ngraph::as_type<ngraph::AttributeAdapter<
+                std::vector<std::shared_ptr<SubGraphOp::OutputDescription>>>>(&adapter)) {
+            for (const auto& desc : a->get()) {
+                m_seed = hash_combine(m_seed, std::string(desc->get_type_info().name));
+                m_seed = hash_combine(m_seed, desc->m_body_value_index);
+                m_seed = hash_combine(m_seed, desc->m_output_index);
+                if (auto concat = ngraph::as_type_ptr<SubGraphOp::ConcatOutputDescription>(desc)) {
+                    for (auto v : {concat->m_start, concat->m_stride, concat->m_part_size, concat->m_end, concat->m_axis})
+                        m_seed = hash_combine(m_seed, v);
+                } else if (auto body = ngraph::as_type_ptr<SubGraphOp::BodyOutputDescription>(desc)) {
+                    m_seed = hash_combine(m_seed, body->m_iteration);
+                }
+            }
+        } else if (auto a = ngraph::as_type<ngraph::AttributeAdapter<ngraph::op::v5::Loop::SpecialBodyPorts>>(&adapter)) {
+            m_seed = hash_combine(m_seed, a->get().current_iteration_input_idx);
+            m_seed = hash_combine(m_seed, a->get().body_condition_output_idx);
+        }
+    }
+
+#define ON_ADAPTER(T) \
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<T>& adapter) override { \
+        hashValue(name, adapter.get()); \
+    }
+#define ON_ADAPTER_VECTOR(T) \
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<T>>& adapter) override { \
+        hashValues(name, adapter.get()); \
+    }
+
+    ON_ADAPTER(std::string)
+    ON_ADAPTER(bool)
+    ON_ADAPTER(int8_t)
+    ON_ADAPTER(int16_t)
+    ON_ADAPTER(int32_t)
+    ON_ADAPTER(int64_t)
+    ON_ADAPTER(uint8_t)
+    ON_ADAPTER(uint16_t)
+    ON_ADAPTER(uint32_t)
+    ON_ADAPTER(uint64_t)
+    ON_ADAPTER(float)
+    ON_ADAPTER(double)
+    ON_ADAPTER_VECTOR(int8_t)
+    ON_ADAPTER_VECTOR(int16_t)
+    ON_ADAPTER_VECTOR(int32_t)
+    ON_ADAPTER_VECTOR(int64_t)
+    ON_ADAPTER_VECTOR(uint8_t)
+    ON_ADAPTER_VECTOR(uint16_t)
+    ON_ADAPTER_VECTOR(uint32_t)
+    ON_ADAPTER_VECTOR(uint64_t)
+    ON_ADAPTER_VECTOR(float)
+    ON_ADAPTER_VECTOR(double)
+    ON_ADAPTER_VECTOR(std::string)
+
+#undef ON_ADAPTER
+#undef ON_ADAPTER_VECTOR
+
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::shared_ptr<ngraph::Function>>& adapter) override {
+        m_seed = hash_combine(m_seed, name);
+        visitFunction(*adapter.get());
+    }
+
+    void visitFunction(const ngraph::Function& function) {
+        // Nodes are identified by the position in the topological order, it doesn't depend on addresses
+        std::unordered_map<const ngraph::Node*, std::size_t> nodeIds;
+        for (const auto& op : function.get_ordered_ops()) {
+            nodeIds.emplace(op.get(), nodeIds.size());
+
+            const auto& typeInfo = op->get_type_info();
+            m_seed = hash_combine(m_seed, std::string(typeInfo.name));
+            m_seed = hash_combine(m_seed, typeInfo.version);
+            m_seed = hash_combine(m_seed, op->get_friendly_name());
+
+            for (const auto& input : op->inputs()) {
+                const auto source = input.get_source_output();
+                m_seed = hash_combine(m_seed, nodeIds.at(source.get_node()));
+                m_seed = hash_combine(m_seed, source.get_index());
+            }
+            for (const auto& output : op->outputs()) {
+                m_seed = hash_combine(m_seed, output.get_element_type().get_type_name());
+                hashPartialShape(output.get_partial_shape());
+            }
+
+            op->visit_attributes(*this);
+        }
+
+        for (const auto& param : function.get_parameters())
+            m_seed = hash_combine(m_seed, nodeIds.at(param.get()));
+        for (const auto& result : function.get_results())
+            m_seed = hash_combine(m_seed, nodeIds.at(result.get()));
+    }
+
+    std::size_t getResult() const {
+        std::vector<uint64_t> hashes(m_buffers.size());
+        parallel_for(m_buffers.size(), [&](std::size_t i) {
+            hashes[i] = data_hash(m_buffers[i].first, m_buffers[i].second);
+        });
+
+        auto seed = m_seed;
+        for (auto hash : hashes) {
+            seed = hash_combine(seed, hash);
+        }
+        return seed;
     }
 };
 
@@ -85,32 +240,14 @@ std::string NetworkCompilationContext::calculateFileInfo(const std::string& file
     return std::to_string(seed);
 }
 
-std::string NetworkCompilationContext::computeHash(const CNNNetwork& network,
-                               const std::map<std::string, std::string>& compileOptions) {
-    OV_ITT_SCOPED_TASK(itt::domains::IE_LT, "NetworkCompilationContext::computeHash - CNN");
-    OstreamHashWrapper xmlHash;
-    OstreamHashWrapper binHash;
-    std::ostream xml(&xmlHash);
-    std::ostream bin(&binHash);
-
-    IE_ASSERT(network.getFunction());
-
-    // 1. Serialize
-    CNNNetwork net(network);
-    ngraph::pass::Serialize serializer(xml, bin,
-        ngraph::pass::Serialize::Version::IR_V10);
-    serializer.run_on_function(net.getFunction());
-
-    // 2. Compute hash on serialized data and options
-    size_t seed {};
-    seed = hash_combine(seed, xmlHash.getResult());
-    seed = hash_combine(seed, binHash.getResult());
-
+// Hashes the compile options and the network information which is not a part of the function
+static std::size_t hashNetworkInfo(std::size_t seed, const CNNNetwork& network,
+                                   const std::map<std::string, std::string>& compileOptions) {
     for (const auto& kvp : compileOptions) {
         seed = hash_combine(seed, kvp.first + kvp.second);
     }
 
-    // 3. Add runtime information which may not be serialized
+    // Add runtime information which may not be serialized
     for (const auto& op : network.getFunction()->get_ordered_ops()) {
         const auto& rt = op->get_rt_info();
         for (const auto& rtMapData : rt) {
@@ -130,7 +267,7 @@ std::string NetworkCompilationContext::computeHash(const CNNNetwork& network,
         }
     }
 
-    // 4. Add inputs info
+    // Add inputs info
     for (const auto& input : network.getInputsInfo()) {
         InputInfo::Ptr info = input.second;
         seed = hash_combine(seed, as_int32_t(info->getPrecision()));
@@ -151,13 +288,55 @@ std::string NetworkCompilationContext::computeHash(const CNNNetwork& network,
         }
     }
 
-    // 5. Add outputs info
+    // Add outputs info
     for (const auto& output : network.getOutputsInfo()) {
         DataPtr info = output.second;
         seed = hash_combine(seed, as_int32_t(info->getPrecision()));
         seed = hash_combine(seed, as_int32_t(info->getLayout()));
     }
 
+    return seed;
+}
+
+std::string NetworkCompilationContext::computeHash(const CNNNetwork& network,
+                               const std::map<std::string, std::string>& compileOptions) {
+    OV_ITT_SCOPED_TASK(itt::domains::IE_LT, "NetworkCompilationContext::computeHash - CNN");
+    IE_ASSERT(network.getFunction());
+
+    // 1. Walk the function: topology, attributes, shapes and constants content
+    FunctionHashVisitor visitor;
+    visitor.visitFunction(*network.getFunction());
+
+    // 2. Compute hash on the function, options and the rest of network information
+    size_t seed {};
+    seed = hash_combine(seed, visitor.getResult());
+    seed = hashNetworkInfo(seed, network, compileOptions);
+
+    return std::to_string(seed);
+}
+
+std::string NetworkCompilationContext::computeLegacyHash(const CNNNetwork& network,
+                               const std::map<std::string, std::string>& compileOptions) {
+    OV_ITT_SCOPED_TASK(itt::domains::IE_LT, "NetworkCompilationContext::computeLegacyHash - CNN");
+    OstreamHashWrapper xmlHash;
+    OstreamHashWrapper binHash;
+    std::ostream xml(&xmlHash);
+    std::ostream bin(&binHash);
+
+    IE_ASSERT(network.getFunction());
+
+    // 1. Serialize
+    CNNNetwork net(network);
+    ngraph::pass::Serialize serializer(xml, bin,
+        ngraph::pass::Serialize::Version::IR_V10);
+    serializer.run_on_function(net.getFunction());
+
+    // 2. Compute hash on serialized data, options and the rest of network information
+    size_t seed {};
+    seed = hash_combine(seed, xmlHash.getResult());
+    seed = hash_combine(seed, binHash.getResult());
+    seed = hashNetworkInfo(seed, network, compileOptions);
+
     return std::to_string(seed);
 }
 
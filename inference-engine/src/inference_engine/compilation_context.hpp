@@ -19,6 +19,10 @@ struct NetworkCompilationContext final {
     static std::string computeHash(const CNNNetwork& network,
                                    const std::map<std::string, std::string>& compileOptions);
 
+    // Key of the releases which hashed the serialized network, used to find their cache entries
+    static std::string computeLegacyHash(const CNNNetwork& network,
+                                         const std::map<std::string, std::string>& compileOptions);
+
     static std::string computeHash(const std::string& modelName,
                                    const std::map<std::string, std::string>& compileOptions);
 };
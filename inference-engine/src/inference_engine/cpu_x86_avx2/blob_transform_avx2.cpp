@@ -0,0 +1,360 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "blob_transform_avx2.hpp"
+
+#include <immintrin.h>
+
+#include <cstring>
+
+namespace InferenceEngine {
+
+namespace {
+
+template <typename T>
+using transpose_tile_t = void (*)(const T* src, size_t src_ld, T* dst, size_t dst_ld);
+
+template <typename T>
+inline void transpose_scalar(const T* src, size_t src_ld, T* dst, size_t dst_ld, size_t rows, size_t cols) {
+    for (size_t i = 0; i < rows; i++)
+        for (size_t j = 0; j < cols; j++)
+            dst[j * dst_ld + i] = src[i * src_ld + j];
+}
+
+// Transposes the matrix by TR x TC tiles, the partial tiles on the edges are transposed by scalar code.
+// The loop over the longer side is the inner one, so the shorter side stays in cache.
+template <typename T, size_t TR, size_t TC>
+inline void transpose_tiled(const T* src, size_t src_ld, T* dst, size_t dst_ld, size_t rows, size_t cols,
+                            transpose_tile_t<T> tile) {
+    const size_t rows_t = rows - rows % TR;
+    const size_t cols_t = cols - cols % TC;
+
+    if (rows < cols) {
+        for (size_t i = 0; i < rows_t; i += TR)
+            for (size_t j = 0; j < cols_t; j += TC)
+                tile(src + i * src_ld + j, src_ld, dst + j * dst_ld + i, dst_ld);
+    } else {
+        for (size_t j = 0; j < cols_t; j += TC)
+            for (size_t i = 0; i < rows_t; i += TR)
+                tile(src + i * src_ld + j, src_ld, dst + j * dst_ld + i, dst_ld);
+    }
+
+    transpose_scalar(src + cols_t, src_ld, dst + cols_t * dst_ld, dst_ld, rows_t, cols - cols_t);
+    transpose_scalar(src + rows_t * src_ld, src_ld, dst + rows_t, dst_ld, rows - rows_t, cols);
+}
+
+inline __m128i load32(const void* ptr) {
+    int32_t value;
+    std::memcpy(&value, ptr, sizeof(value));
+    return _mm_cvtsi32_si128(value);
+}
+
+inline void store32(void* ptr, __m128i value) {
+    int32_t v = _mm_cvtsi128_si32(value);
+    std::memcpy(ptr, &v, sizeof(v));
+}
+
+inline void store_hi64(void* ptr, __m128i value) {
+    _mm_storeh_pd(reinterpret_cast<double*>(ptr), _mm_castsi128_pd(value));
+}
+
+//------------------------------------------------------------------------
+// 8-bit elements
+//------------------------------------------------------------------------
+
+void transpose_16x16_u8(const uint8_t* src, size_t src_ld, uint8_t* dst, size_t dst_ld) {
+    __m128i a[16], b[16];
+    for (int k = 0; k < 16; k++)
+        a[k] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + k * src_ld));
+
+    // pairs of rows: b[k] holds columns 0..7, b[k + 8] columns 8..15 of rows 2k, 2k + 1
+    for (int k = 0; k < 8; k++) {
+        b[k] = _mm_unpacklo_epi8(a[2 * k], a[2 * k + 1]);
+        b[k + 8] = _mm_unpackhi_epi8(a[2 * k], a[2 * k + 1]);
+    }
+    // quads of rows: a[4g + k] holds columns 4g..4g+3 of rows 4k..4k+3
+    for (int h = 0; h < 2; h++) {
+        for (int k = 0; k < 4; k++) {
+            a[8 * h + k] = _mm_unpacklo_epi16(b[8 * h + 2 * k], b[8 * h + 2 * k + 1]);
+            a[8 * h + 4 + k] = _mm_unpackhi_epi16(b[8 * h + 2 * k], b[8 * h + 2 * k + 1]);
+        }
+    }
+    // octets of rows: b[2g + k] holds columns 2g, 2g + 1 of rows 8k..8k+7
+    for (int g = 0; g < 4; g++) {
+        for (int k = 0; k < 2; k++) {
+            b[4 * g + k] = _mm_unpacklo_epi32(a[4 * g + 2 * k], a[4 * g + 2 * k + 1]);
+            b[4 * g + 2 + k] = _mm_unpackhi_epi32(a[4 * g + 2 * k], a[4 * g + 2 * k + 1]);
+        }
+    }
+    for (int g = 0; g < 8; g++) {
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + (2 * g) * dst_ld),
+                         _mm_unpacklo_epi64(b[2 * g], b[2 * g + 1]));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + (2 * g + 1) * dst_ld),
+                         _mm_unpackhi_epi64(b[2 * g], b[2 * g + 1]));
+    }
+}
+
+// 4 planes to 16 interleaved pixels
+void transpose_4x16_u8(const uint8_t* src, size_t src_ld, uint8_t* dst, size_t dst_ld) {
+    __m128i r0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+    __m128i r1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + src_ld));
+    __m128i r2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 2 * src_ld));
+    __m128i r3 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 3 * src_ld));
+
+    __m128i a0 = _mm_unpacklo_epi8(r0, r1);
+    __m128i a1 = _mm_unpackhi_epi8(r0, r1);
+    __m128i b0 = _mm_unpacklo_epi8(r2, r3);
+    __m128i b1 = _mm_unpackhi_epi8(r2, r3);
+
+    __m128i o[4] = {_mm_unpacklo_epi16(a0, b0), _mm_unpackhi_epi16(a0, b0),
+                    _mm_unpacklo_epi16(a1, b1), _mm_unpackhi_epi16(a1, b1)};
+
+    if (dst_ld == 4) {
+        for (int k = 0; k < 4; k++)
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + 16 * k), o[k]);
+    } else {
+        for (int k = 0; k < 4; k++) {
+            store32(dst + (4 * k) * dst_ld, o[k]);
+            store32(dst + (4 * k + 1) * dst_ld, _mm_srli_si128(o[k], 4));
+            store32(dst + (4 * k + 2) * dst_ld, _mm_srli_si128(o[k], 8));
+            store32(dst + (4 * k + 3) * dst_ld, _mm_srli_si128(o[k], 12));
+        }
+    }
+}
+
+// 16 interleaved pixels to 4 planes
+void transpose_16x4_u8(const uint8_t* src, size_t src_ld, uint8_t* dst, size_t dst_ld) {
+    __m128i q[4];
+    if (src_ld == 4) {
+        for (int k = 0; k < 4; k++)
+            q[k] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 16 * k));
+    } else {
+        for (int k = 0; k < 4; k++) {
+            q[k] = _mm_unpacklo_epi64(_mm_unpacklo_epi32(load32(src + (4 * k) * src_ld),
+                                                         load32(src + (4 * k + 1) * src_ld)),
+                                      _mm_unpacklo_epi32(load32(src + (4 * k + 2) * src_ld),
+                                                         load32(src + (4 * k + 3) * src_ld)));
+        }
+    }
+
+    // group bytes of each channel within the quads of pixels
+    const __m128i group = _mm_setr_epi8(0, 4, 8, 12, 1, 5, 9, 13, 2, 6, 10, 14, 3, 7, 11, 15);
+    for (int k = 0; k < 4; k++)
+        q[k] = _mm_shuffle_epi8(q[k], group);
+
+    __m128i lo01 = _mm_unpacklo_epi32(q[0], q[1]);
+    __m128i hi01 = _mm_unpackhi_epi32(q[0], q[1]);
+    __m128i lo23 = _mm_unpacklo_epi32(q[2], q[3]);
+    __m128i hi23 = _mm_unpackhi_epi32(q[2], q[3]);
+
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), _mm_unpacklo_epi64(lo01, lo23));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + dst_ld), _mm_unpackhi_epi64(lo01, lo23));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + 2 * dst_ld), _mm_unpacklo_epi64(hi01, hi23));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + 3 * dst_ld), _mm_unpackhi_epi64(hi01, hi23));
+}
+
+//------------------------------------------------------------------------
+// 16-bit elements
+//------------------------------------------------------------------------
+
+void transpose_8x8_u16(const uint16_t* src, size_t src_ld, uint16_t* dst, size_t dst_ld) {
+    __m128i r[8], a[8], b[8];
+    for (int k = 0; k < 8; k++)
+        r[k] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + k * src_ld));
+
+    // a[k] holds columns 0..3, a[k + 4] columns 4..7 of rows 2k, 2k + 1
+    for (int k = 0; k < 4; k++) {
+        a[k] = _mm_unpacklo_epi16(r[2 * k], r[2 * k + 1]);
+        a[k + 4] = _mm_unpackhi_epi16(r[2 * k], r[2 * k + 1]);
+    }
+    // b[2g + k] holds columns 2g, 2g + 1 of rows 4k..4k+3
+    for (int g = 0; g < 2; g++) {
+        for (int k = 0; k < 2; k++) {
+            b[4 * g + k] = _mm_unpacklo_epi32(a[4 * g + 2 * k], a[4 * g + 2 * k + 1]);
+            b[4 * g + 2 + k] = _mm_unpackhi_epi32(a[4 * g + 2 * k], a[4 * g + 2 * k + 1]);
+        }
+    }
+    for (int g = 0; g < 4; g++) {
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + (2 * g) * dst_ld),
+                         _mm_unpacklo_epi64(b[2 * g], b[2 * g + 1]));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + (2 * g + 1) * dst_ld),
+                         _mm_unpackhi_epi64(b[2 * g], b[2 * g + 1]));
+    }
+}
+
+// 4 planes to 8 interleaved pixels
+void transpose_4x8_u16(const uint16_t* src, size_t src_ld, uint16_t* dst, size_t dst_ld) {
+    __m128i r0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+    __m128i r1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + src_ld));
+    __m128i r2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 2 * src_ld));
+    __m128i r3 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 3 * src_ld));
+
+    __m128i a0 = _mm_unpacklo_epi16(r0, r1);
+    __m128i a1 = _mm_unpackhi_epi16(r0, r1);
+    __m128i b0 = _mm_unpacklo_epi16(r2, r3);
+    __m128i b1 = _mm_unpackhi_epi16(r2, r3);
+
+    __m128i o[4] = {_mm_unpacklo_epi32(a0, b0), _mm_unpackhi_epi32(a0, b0),
+                    _mm_unpacklo_epi32(a1, b1), _mm_unpackhi_epi32(a1, b1)};
+
+    if (dst_ld == 4) {
+        for (int k = 0; k < 4; k++)
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + 8 * k), o[k]);
+    } else {
+        for (int k = 0; k < 4; k++) {
+            _mm_storel_epi64(reinterpret_cast<__m128i*>(dst + (2 * k) * dst_ld), o[k]);
+            store_hi64(dst + (2 * k + 1) * dst_ld, o[k]);
+        }
+    }
+}
+
+// 8 interleaved pixels to 4 planes
+void transpose_8x4_u16(const uint16_t* src, size_t src_ld, uint16_t* dst, size_t dst_ld) {
+    __m128i q[4];
+    for (int k = 0; k < 4; k++) {
+        q[k] = _mm_unpacklo_epi64(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(src + (2 * k) * src_ld)),
+                                  _mm_loadl_epi64(reinterpret_cast<const __m128i*>(src + (2 * k + 1) * src_ld)));
+    }
+
+    __m128i x0 = _mm_unpacklo_epi16(q[0], q[1]);
+    __m128i x1 = _mm_unpackhi_epi16(q[0], q[1]);
+    __m128i x2 = _mm_unpacklo_epi16(q[2], q[3]);
+    __m128i x3 = _mm_unpackhi_epi16(q[2], q[3]);
+
+    __m128i y0 = _mm_unpacklo_epi16(x0, x1);
+    __m128i y1 = _mm_unpackhi_epi16(x0, x1);
+    __m128i y2 = _mm_unpacklo_epi16(x2, x3);
+    __m128i y3 = _mm_unpackhi_epi16(x2, x3);
+
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), _mm_unpacklo_epi64(y0, y2));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + dst_ld), _mm_unpackhi_epi64(y0, y2));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + 2 * dst_ld), _mm_unpacklo_epi64(y1, y3));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + 3 * dst_ld), _mm_unpackhi_epi64(y1, y3));
+}
+
+//------------------------------------------------------------------------
+// 32-bit elements
+//------------------------------------------------------------------------
+
+inline __m256 load8(const uint32_t* ptr) {
+    return _mm256_loadu_ps(reinterpret_cast<const float*>(ptr));
+}
+
+inline void store8(uint32_t* ptr, __m256 value) {
+    _mm256_storeu_ps(reinterpret_cast<float*>(ptr), value);
+}
+
+inline void store4(uint32_t* ptr, __m128 value) {
+    _mm_storeu_ps(reinterpret_cast<float*>(ptr), value);
+}
+
+void transpose_8x8_u32(const uint32_t* src, size_t src_ld, uint32_t* dst, size_t dst_ld) {
+    __m256 r[8], t[8], u[8];
+    for (int k = 0; k < 8; k++)
+        r[k] = load8(src + k * src_ld);
+
+    for (int k = 0; k < 4; k++) {
+        t[2 * k] = _mm256_unpacklo_ps(r[2 * k], r[2 * k + 1]);
+        t[2 * k + 1] = _mm256_unpackhi_ps(r[2 * k], r[2 * k + 1]);
+    }
+    // u[4h + c] holds columns c | c + 4 of rows 4h..4h+3
+    for (int h = 0; h < 2; h++) {
+        u[4 * h + 0] = _mm256_shuffle_ps(t[4 * h + 0], t[4 * h + 2], 0x44);
+        u[4 * h + 1] = _mm256_shuffle_ps(t[4 * h + 0], t[4 * h + 2], 0xEE);
+        u[4 * h + 2] = _mm256_shuffle_ps(t[4 * h + 1], t[4 * h + 3], 0x44);
+        u[4 * h + 3] = _mm256_shuffle_ps(t[4 * h + 1], t[4 * h + 3], 0xEE);
+    }
+    for (int c = 0; c < 4; c++) {
+        store8(dst + c * dst_ld, _mm256_permute2f128_ps(u[c], u[c + 4], 0x20));
+        store8(dst + (c + 4) * dst_ld, _mm256_permute2f128_ps(u[c], u[c + 4], 0x31));
+    }
+}
+
+// 4 planes to 8 interleaved pixels
+void transpose_4x8_u32(const uint32_t* src, size_t src_ld, uint32_t* dst, size_t dst_ld) {
+    __m256 r0 = load8(src);
+    __m256 r1 = load8(src + src_ld);
+    __m256 r2 = load8(src + 2 * src_ld);
+    __m256 r3 = load8(src + 3 * src_ld);
+
+    __m256 t0 = _mm256_unpacklo_ps(r0, r1);
+    __m256 t1 = _mm256_unpackhi_ps(r0, r1);
+    __m256 t2 = _mm256_unpacklo_ps(r2, r3);
+    __m256 t3 = _mm256_unpackhi_ps(r2, r3);
+
+    // u[c] holds pixels c | c + 4
+    __m256 u[4] = {_mm256_shuffle_ps(t0, t2, 0x44), _mm256_shuffle_ps(t0, t2, 0xEE),
+                   _mm256_shuffle_ps(t1, t3, 0x44), _mm256_shuffle_ps(t1, t3, 0xEE)};
+
+    if (dst_ld == 4) {
+        store8(dst, _mm256_permute2f128_ps(u[0], u[1], 0x20));
+        store8(dst + 8, _mm256_permute2f128_ps(u[2], u[3], 0x20));
+        store8(dst + 16, _mm256_permute2f128_ps(u[0], u[1], 0x31));
+        store8(dst + 24, _mm256_permute2f128_ps(u[2], u[3], 0x31));
+    } else {
+        for (int c = 0; c < 4; c++) {
+            store4(dst + c * dst_ld, _mm256_castps256_ps128(u[c]));
+            store4(dst + (c + 4) * dst_ld, _mm256_extractf128_ps(u[c], 1));
+        }
+    }
+}
+
+// 8 interleaved pixels to 4 planes
+void transpose_8x4_u32(const uint32_t* src, size_t src_ld, uint32_t* dst, size_t dst_ld) {
+    __m256 a[4];
+    for (int k = 0; k < 4; k++) {
+        a[k] = _mm256_insertf128_ps(
+            _mm256_castps128_ps256(_mm_loadu_ps(reinterpret_cast<const float*>(src + k * src_ld))),
+            _mm_loadu_ps(reinterpret_cast<const float*>(src + (k + 4) * src_ld)), 1);
+    }
+
+    __m256 t0 = _mm256_unpacklo_ps(a[0], a[1]);
+    __m256 t1 = _mm256_unpackhi_ps(a[0], a[1]);
+    __m256 t2 = _mm256_unpacklo_ps(a[2], a[3]);
+    __m256 t3 = _mm256_unpackhi_ps(a[2], a[3]);
+
+    store8(dst, _mm256_shuffle_ps(t0, t2, 0x44));
+    store8(dst + dst_ld, _mm256_shuffle_ps(t0, t2, 0xEE));
+    store8(dst + 2 * dst_ld, _mm256_shuffle_ps(t1, t3, 0x44));
+    store8(dst + 3 * dst_ld, _mm256_shuffle_ps(t1, t3, 0xEE));
+}
+
+}  // namespace
+
+//------------------------------------------------------------------------
+//
+// Blob-copy transposition primitives manually vectored for AVX2
+//
+//------------------------------------------------------------------------
+
+void blob_transpose_u8_avx2(const uint8_t* src, size_t src_ld, uint8_t* dst, size_t dst_ld, size_t rows, size_t cols) {
+    if (rows == 4)
+        transpose_tiled<uint8_t, 4, 16>(src, src_ld, dst, dst_ld, rows, cols, transpose_4x16_u8);
+    else if (cols == 4)
+        transpose_tiled<uint8_t, 16, 4>(src, src_ld, dst, dst_ld, rows, cols, transpose_16x4_u8);
+    else
+        transpose_tiled<uint8_t, 16, 16>(src, src_ld, dst, dst_ld, rows, cols, transpose_16x16_u8);
+}
+
+void blob_transpose_u16_avx2(const uint16_t* src, size_t src_ld, uint16_t* dst, size_t dst_ld, size_t rows,
+                             size_t cols) {
+    if (rows == 4)
+        transpose_tiled<uint16_t, 4, 8>(src, src_ld, dst, dst_ld, rows, cols, transpose_4x8_u16);
+    else if (cols == 4)
+        transpose_tiled<uint16_t, 8, 4>(src, src_ld, dst, dst_ld, rows, cols, transpose_8x4_u16);
+    else
+        transpose_tiled<uint16_t, 8, 8>(src, src_ld, dst, dst_ld, rows, cols, transpose_8x8_u16);
+}
+
+void blob_transpose_u32_avx2(const uint32_t* src, size_t src_ld, uint32_t* dst, size_t dst_ld, size_t rows,
+                             size_t cols) {
+    if (rows == 4)
+        transpose_tiled<uint32_t, 4, 8>(src, src_ld, dst, dst_ld, rows, cols, transpose_4x8_u32);
+    else if (cols == 4)
+        transpose_tiled<uint32_t, 8, 4>(src, src_ld, dst, dst_ld, rows, cols, transpose_8x4_u32);
+    else
+        transpose_tiled<uint32_t, 8, 8>(src, src_ld, dst, dst_ld, rows, cols, transpose_8x8_u32);
+}
+
+}  // namespace InferenceEngine
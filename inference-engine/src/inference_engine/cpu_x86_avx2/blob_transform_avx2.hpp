@@ -0,0 +1,30 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <stdint.h>
+#include <stdlib.h>
+
+namespace InferenceEngine {
+
+//------------------------------------------------------------------------
+//
+// Blob-copy transposition primitives manually vectored for AVX2
+//
+// Each function transposes the rows x cols matrix of 1, 2 or 4 byte elements:
+//     dst[j * dst_ld + i] = src[i * src_ld + j]
+// Leading dimensions are given in elements.
+//
+//------------------------------------------------------------------------
+
+void blob_transpose_u8_avx2(const uint8_t* src, size_t src_ld, uint8_t* dst, size_t dst_ld, size_t rows, size_t cols);
+
+void blob_transpose_u16_avx2(const uint16_t* src, size_t src_ld, uint16_t* dst, size_t dst_ld, size_t rows,
+                             size_t cols);
+
+void blob_transpose_u32_avx2(const uint32_t* src, size_t src_ld, uint32_t* dst, size_t dst_ld, size_t rows,
+                             size_t cols);
+
+}  // namespace InferenceEngine
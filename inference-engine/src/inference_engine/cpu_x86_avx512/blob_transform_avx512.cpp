@@ -0,0 +1,87 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "blob_transform_avx512.hpp"
+
+#ifdef HAVE_AVX2
+#include "cpu_x86_avx2/blob_transform_avx2.hpp"
+#endif
+
+#include <immintrin.h>
+
+namespace InferenceEngine {
+
+namespace {
+
+void transpose_16x16_u32(const uint32_t* src, size_t src_ld, uint32_t* dst, size_t dst_ld) {
+    __m512 r[16], t[16];
+    for (int k = 0; k < 16; k++)
+        r[k] = _mm512_loadu_ps(reinterpret_cast<const float*>(src + k * src_ld));
+
+    for (int k = 0; k < 8; k++) {
+        t[2 * k] = _mm512_unpacklo_ps(r[2 * k], r[2 * k + 1]);
+        t[2 * k + 1] = _mm512_unpackhi_ps(r[2 * k], r[2 * k + 1]);
+    }
+    // r[4q + m] holds rows 4q..4q+3 of column 4l + m in each 128-bit lane l
+    for (int q = 0; q < 4; q++) {
+        r[4 * q + 0] = _mm512_shuffle_ps(t[4 * q + 0], t[4 * q + 2], 0x44);
+        r[4 * q + 1] = _mm512_shuffle_ps(t[4 * q + 0], t[4 * q + 2], 0xEE);
+        r[4 * q + 2] = _mm512_shuffle_ps(t[4 * q + 1], t[4 * q + 3], 0x44);
+        r[4 * q + 3] = _mm512_shuffle_ps(t[4 * q + 1], t[4 * q + 3], 0xEE);
+    }
+    // gather the lanes of the same column from the four quads of rows
+    for (int m = 0; m < 4; m++) {
+        __m512 even01 = _mm512_shuffle_f32x4(r[m], r[4 + m], 0x88);
+        __m512 odd01 = _mm512_shuffle_f32x4(r[m], r[4 + m], 0xDD);
+        __m512 even23 = _mm512_shuffle_f32x4(r[8 + m], r[12 + m], 0x88);
+        __m512 odd23 = _mm512_shuffle_f32x4(r[8 + m], r[12 + m], 0xDD);
+
+        _mm512_storeu_ps(reinterpret_cast<float*>(dst + m * dst_ld), _mm512_shuffle_f32x4(even01, even23, 0x88));
+        _mm512_storeu_ps(reinterpret_cast<float*>(dst + (4 + m) * dst_ld), _mm512_shuffle_f32x4(odd01, odd23, 0x88));
+        _mm512_storeu_ps(reinterpret_cast<float*>(dst + (8 + m) * dst_ld), _mm512_shuffle_f32x4(even01, even23, 0xDD));
+        _mm512_storeu_ps(reinterpret_cast<float*>(dst + (12 + m) * dst_ld), _mm512_shuffle_f32x4(odd01, odd23, 0xDD));
+    }
+}
+
+void transpose_edge(const uint32_t* src, size_t src_ld, uint32_t* dst, size_t dst_ld, size_t rows, size_t cols) {
+#ifdef HAVE_AVX2
+    blob_transpose_u32_avx2(src, src_ld, dst, dst_ld, rows, cols);
+#else
+    for (size_t i = 0; i < rows; i++)
+        for (size_t j = 0; j < cols; j++)
+            dst[j * dst_ld + i] = src[i * src_ld + j];
+#endif
+}
+
+}  // namespace
+
+//------------------------------------------------------------------------
+//
+// Blob-copy transposition primitives manually vectored for AVX-512
+//
+//------------------------------------------------------------------------
+
+void blob_transpose_u32_avx512(const uint32_t* src, size_t src_ld, uint32_t* dst, size_t dst_ld, size_t rows,
+                               size_t cols) {
+    const size_t rows_t = rows - rows % 16;
+    const size_t cols_t = cols - cols % 16;
+
+    if (rows < cols) {
+        for (size_t i = 0; i < rows_t; i += 16)
+            for (size_t j = 0; j < cols_t; j += 16)
+                transpose_16x16_u32(src + i * src_ld + j, src_ld, dst + j * dst_ld + i, dst_ld);
+    } else {
+        for (size_t j = 0; j < cols_t; j += 16)
+            for (size_t i = 0; i < rows_t; i += 16)
+                transpose_16x16_u32(src + i * src_ld + j, src_ld, dst + j * dst_ld + i, dst_ld);
+    }
+
+    // the partial tiles on the edges, including the narrow matrices of 4 channels
+    if (cols_t != cols)
+        transpose_edge(src + cols_t, src_ld, dst + cols_t * dst_ld, dst_ld, rows_t, cols - cols_t);
+    if (rows_t != rows)
+        transpose_edge(src + rows_t * src_ld, src_ld, dst + rows_t, dst_ld, rows - rows_t, cols);
+}
+
+}  // namespace InferenceEngine
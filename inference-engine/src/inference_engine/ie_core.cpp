@@ -295,6 +295,34 @@ class Core::Impl : public ICore {
         return execNetwork;
     }
 
+    // Moves the entry written under the key of the releases which hashed the serialized network
+    // to the current key, so the networks cached by them are not compiled once more
+    bool MigrateLegacyCacheEntry(const std::shared_ptr<ICacheManager>& cacheManager,
+                                 const std::string& blobId,
+                                 const CNNNetwork& network,
+                                 const std::string& deviceFamily,
+                                 const InferencePlugin& plugin,
+                                 const std::map<std::string, std::string>& config) {
+        OV_ITT_SCOPED_TASK(itt::domains::IE_LT, "Core::MigrateLegacyCacheEntry");
+        auto compileConfig = CreateCompileConfig(plugin, deviceFamily, config);
+        auto legacyBlobId = NetworkCompilationContext::computeLegacyHash(network, compileConfig);
+        auto lock = cacheGuard.getHashLock(legacyBlobId);
+        bool migrated = false;
+        try {
+            cacheManager->readCacheEntry(legacyBlobId, [&](std::istream& legacyStream) {
+                cacheManager->writeCacheEntry(blobId, [&](std::ostream& networkStream) {
+                    networkStream << legacyStream.rdbuf();
+                });
+                migrated = true;
+            });
+        } catch (...) {
+            cacheManager->removeCacheEntry(blobId);
+            migrated = false;
+        }
+        cacheManager->removeCacheEntry(legacyBlobId);
+        return migrated;
+    }
+
     std::map<std::string, std::string> CreateCompileConfig(const InferencePlugin& plugin,
                                                            const std::string& deviceFamily,
                                                            const std::map<std::string, std::string>& origConfig) const {
@@ -457,6 +485,10 @@ public:
             bool loadedFromCache = false;
             auto lock = cacheGuard.getHashLock(hash);
             res = LoadNetworkFromCache(cacheManager, hash, plugin, parsed._config, context, loadedFromCache);
+            if (!loadedFromCache &&
+                MigrateLegacyCacheEntry(cacheManager, hash, network, parsed._deviceName, plugin, parsed._config)) {
+                res = LoadNetworkFromCache(cacheManager, hash, plugin, parsed._config, context, loadedFromCache);
+            }
             if (!loadedFromCache) {
                 res = LoadNetworkImpl(network, plugin, parsed._config, context, hash);
             }
@@ -483,6 +515,10 @@ public:
             bool loadedFromCache = false;
             auto lock = cacheGuard.getHashLock(hash);
             res = LoadNetworkFromCache(cacheManager, hash, plugin, parsed._config, nullptr, loadedFromCache);
+            if (!loadedFromCache &&
+                MigrateLegacyCacheEntry(cacheManager, hash, network, parsed._deviceName, plugin, parsed._config)) {
+                res = LoadNetworkFromCache(cacheManager, hash, plugin, parsed._config, nullptr, loadedFromCache);
+            }
             if (!loadedFromCache) {
                 res = LoadNetworkImpl(network, plugin, parsed._config, nullptr, hash, {}, forceDisableCache);
             }
@@ -589,6 +625,10 @@ public:
         return copyParameterValue(GetCPPPluginByName(parsed._deviceName).GetMetric(name, parsed._config));
     }
 
+    bool IsModelCachingEnabled() const override {
+        return coreConfig.getCacheConfig()._cacheManager != nullptr;
+    }
+
     /**
      * @brief Returns reference to CPP plugin wrapper by a device name
      * @param deviceName A name of device
@@ -0,0 +1,133 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mmap_allocator.hpp"
+
+#include <file_utils.h>
+
+#ifdef _WIN32
+# ifndef NOMINMAX
+#  define NOMINMAX
+# endif
+# include <windows.h>
+#else
+# include <fcntl.h>
+# include <sys/mman.h>
+# include <sys/stat.h>
+# include <unistd.h>
+#endif
+
+namespace InferenceEngine {
+namespace details {
+
+namespace {
+
+/**
+ * @brief Allocator which owns a memory mapping of a file. The only allocation it can serve is the mapped region itself.
+ */
+class MmapAllocator final : public IAllocator {
+public:
+    explicit MmapAllocator(const std::string& path) {
+#ifdef _WIN32
+# if defined(ENABLE_UNICODE_PATH_SUPPORT)
+        std::wstring file_path = FileUtils::multiByteCharToWString(path.c_str());
+        _file = ::CreateFileW(file_path.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL,
+                              OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+# else
+        _file = ::CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL,
+                              OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+# endif
+        if (_file == INVALID_HANDLE_VALUE)
+            return;
+        LARGE_INTEGER fileSize;
+        if (!::GetFileSizeEx(_file, &fileSize) || fileSize.QuadPart == 0)
+            return;
+        _mapping = ::CreateFileMapping(_file, NULL, PAGE_WRITECOPY, 0, 0, NULL);
+        if (_mapping == NULL)
+            return;
+        void* data = ::MapViewOfFile(_mapping, FILE_MAP_COPY, 0, 0, 0);
+        if (data == NULL)
+            return;
+        _data = data;
+        _size = static_cast<size_t>(fileSize.QuadPart);
+#else
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd == -1)
+            return;
+        struct stat sb = {};
+        if (::fstat(fd, &sb) == 0 && sb.st_size > 0) {
+            // MAP_PRIVATE keeps the pages shared with the page cache until somebody writes to them
+            void* data = ::mmap(nullptr, sb.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+            if (data != MAP_FAILED) {
+                _data = data;
+                _size = static_cast<size_t>(sb.st_size);
+            }
+        }
+        // the mapping stays valid after the descriptor is closed
+        ::close(fd);
+#endif
+    }
+
+    ~MmapAllocator() {
+        if (_data != nullptr) {
+#ifdef _WIN32
+            ::UnmapViewOfFile(_data);
+#else
+            ::munmap(_data, _size);
+#endif
+        }
+#ifdef _WIN32
+        if (_mapping != NULL)
+            ::CloseHandle(_mapping);
+        if (_file != INVALID_HANDLE_VALUE)
+            ::CloseHandle(_file);
+#endif
+    }
+
+    size_t size() const noexcept {
+        return _size;
+    }
+
+    void* lock(void* handle, LockOp = LOCK_FOR_WRITE) noexcept override {
+        return handle;
+    }
+
+    void unlock(void*) noexcept override {}
+
+    void* alloc(size_t size) noexcept override {
+        if (_data == nullptr || size > _size)
+            return nullptr;
+        return _data;
+    }
+
+    bool free(void* handle) noexcept override {
+        // the mapping is released together with the allocator
+        return handle == _data;
+    }
+
+private:
+    void* _data = nullptr;
+    size_t _size = 0;
+#ifdef _WIN32
+    HANDLE _file = INVALID_HANDLE_VALUE;
+    HANDLE _mapping = NULL;
+#endif
+};
+
+}  // namespace
+
+Blob::Ptr make_mmap_blob(const std::string& path) {
+    auto allocator = std::make_shared<MmapAllocator>(path);
+    if (allocator->size() == 0)
+        return nullptr;
+
+    auto blob = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {allocator->size()}, Layout::C), allocator);
+    blob->allocate();
+    if (blob->buffer().as<uint8_t*>() == nullptr)
+        return nullptr;
+    return blob;
+}
+
+}  // namespace details
+}  // namespace InferenceEngine
@@ -0,0 +1,24 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <string>
+
+#include "ie_blob.h"
+
+namespace InferenceEngine {
+namespace details {
+
+/**
+ * @brief Creates U8 blob backed by a private (copy-on-write) memory mapping of the whole file.
+ * Pages are loaded lazily on first access and are shared with other processes mapping the same file
+ * until they are written to.
+ * @param path Path to a file to map
+ * @return A blob or nullptr if the file cannot be mapped
+ */
+Blob::Ptr make_mmap_blob(const std::string& path);
+
+}  // namespace details
+}  // namespace InferenceEngine
@@ -9,6 +9,7 @@
 #include <condition_variable>
 #include <thread>
 #include <queue>
+#include <deque>
 #include <atomic>
 #include <climits>
 #include <cassert>
@@ -56,7 +57,12 @@ struct CPUStreamsExecutor::Impl {
 #endif
         explicit Stream(Impl* impl) :
             _impl(impl) {
-            {
+            if (_workerQueue.first == _impl) {
+                // A worker thread keeps the index of its task queue, so the NUMA node and the pinning
+                // of the stream match the ones the queues use to order the stealing
+                _streamId = _workerQueue.second;
+                _isWorker = true;
+            } else {
                 std::lock_guard<std::mutex> lock{_impl->_streamIdMutex};
                 if (_impl->_streamIdQueue.empty()) {
                     _streamId = _impl->_streamId++;
@@ -64,6 +70,11 @@ struct CPUStreamsExecutor::Impl {
                     _streamId = _impl->_streamIdQueue.front();
                     _impl->_streamIdQueue.pop();
                 }
+                // Other threads, e.g. the ones calling a synchronous Infer(), share the ids of the streams,
+                // so plugins may index their per-stream resources with any stream id
+                if (_impl->_config._streams) {
+                    _streamId %= _impl->_config._streams;
+                }
             }
             _numaNodeId = _impl->_config._streams
                 ? _impl->_usedNumaNodes.at(
@@ -123,7 +134,7 @@ struct CPUStreamsExecutor::Impl {
 #endif
         }
         ~Stream() {
-            {
+            if (!_isWorker) {
                 std::lock_guard<std::mutex> lock{_impl->_streamIdMutex};
                 _impl->_streamIdQueue.push(_streamId);
             }
@@ -137,6 +148,7 @@ struct CPUStreamsExecutor::Impl {
         Impl* _impl     = nullptr;
         int _streamId   = 0;
         int _numaNodeId = 0;
+        bool _isWorker = false;
         bool _execute = false;
         std::queue<Task> _taskQueue;
 #if IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO
@@ -145,6 +157,20 @@ struct CPUStreamsExecutor::Impl {
 #endif
     };
 
+    // Task queue of a worker thread. Tasks submitted from outside are spread over the queues,
+    // so the threads don't contend on a single lock. An idle thread steals tasks from other
+    // queues preferring the threads of the same NUMA node.
+    struct WorkerQueue {
+        std::mutex                  _mutex;
+        std::condition_variable     _condVar;
+        std::deque<Task>            _tasks;
+        std::atomic<std::size_t>    _size{0};
+        std::atomic<bool>           _idle{false};
+        bool                        _wakeUp = false;
+        int                         _numaNodeId = 0;
+        std::vector<int>            _victims;  // queues to steal from, local NUMA node first
+    };
+
     explicit Impl(const Config& config) :
         _config{config},
         _streams([this] {
@@ -158,33 +184,143 @@ struct CPUStreamsExecutor::Impl {
         } else {
             _usedNumaNodes = numaNodes;
         }
+        _queues.reserve(_config._streams);
+        for (auto streamId = 0; streamId < _config._streams; ++streamId) {
+            _queues.emplace_back(new WorkerQueue);
+            // The same distribution of streams over NUMA nodes as in Stream
+            _queues.back()->_numaNodeId = _usedNumaNodes.at(
+                streamId / ((_config._streams + _usedNumaNodes.size() - 1) / _usedNumaNodes.size()));
+        }
+        for (auto streamId = 0; streamId < _config._streams; ++streamId) {
+            auto& victims = _queues[streamId]->_victims;
+            for (auto remote : {false, true}) {
+                for (auto i = 1; i < _config._streams; ++i) {
+                    auto victim = (streamId + i) % _config._streams;
+                    if ((_queues[victim]->_numaNodeId != _queues[streamId]->_numaNodeId) == remote)
+                        victims.push_back(victim);
+                }
+            }
+        }
         for (auto streamId = 0; streamId < _config._streams; ++streamId) {
             _threads.emplace_back([this, streamId] {
                 openvino::itt::threadName(_config._name + "_" + std::to_string(streamId));
-                for (bool stopped = false; !stopped;) {
-                    Task task;
-                    {
-                        std::unique_lock<std::mutex> lock(_mutex);
-                        _queueCondVar.wait(lock, [&] { return !_taskQueue.empty() || (stopped = _isStopped); });
-                        if (!_taskQueue.empty()) {
-                            task = std::move(_taskQueue.front());
-                            _taskQueue.pop();
-                        }
-                    }
-                    if (task) {
-                        Execute(task, *(_streams.local()));
-                    }
+                _workerQueue = {this, streamId};
+                for (Task task; Pop(streamId, task);) {
+                    Execute(task, *(_streams.local()));
+                    task = {};
                 }
             });
         }
     }
 
+    bool TryPop(WorkerQueue& queue, Task& task) {
+        if (queue._size.load() == 0)
+            return false;
+        std::lock_guard<std::mutex> lock(queue._mutex);
+        if (queue._tasks.empty())
+            return false;
+        task = std::move(queue._tasks.front());
+        queue._tasks.pop_front();
+        --queue._size;
+        return true;
+    }
+
+    bool TrySteal(int streamId, Task& task) {
+        auto& queue = *_queues[streamId];
+        for (auto victim : queue._victims) {
+            if (TryPop(*_queues[victim], task)) {
+                ++_stolenTasks;
+                if (_queues[victim]->_numaNodeId != queue._numaNodeId)
+                    ++_remoteStolenTasks;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // Blocks until a task is found, returns false if the executor is stopped and all queues are empty
+    bool Pop(int streamId, Task& task) {
+        auto& queue = *_queues[streamId];
+        while (true) {
+            if (TryPop(queue, task) || TrySteal(streamId, task)) {
+                ++_executedTasks;
+                return true;
+            }
+            // Announce that the thread is going to sleep and check the queues once again.
+            // Enqueue checks the flag after a task is pushed, so the task can't be missed.
+            queue._idle = true;
+            if (TryPop(queue, task) || TrySteal(streamId, task)) {
+                queue._idle = false;
+                ++_executedTasks;
+                return true;
+            }
+            {
+                std::unique_lock<std::mutex> lock(queue._mutex);
+                queue._condVar.wait(lock, [&] { return !queue._tasks.empty() || queue._wakeUp || _isStopped; });
+                queue._wakeUp = false;
+            }
+            queue._idle = false;
+            if (_isStopped && 0 == QueueDepth()) {
+                return false;
+            }
+        }
+    }
+
     void Enqueue(Task task) {
+        int target = 0;
+        if (_workerQueue.first == this) {
+            // Tasks submitted from a worker thread are kept in its own queue
+            target = _workerQueue.second;
+        } else {
+            target = static_cast<int>(_nextQueue++ % _queues.size());
+        }
         {
-            std::lock_guard<std::mutex> lock(_mutex);
-            _taskQueue.emplace(std::move(task));
+            auto& queue = *_queues[target];
+            std::lock_guard<std::mutex> lock(queue._mutex);
+            queue._tasks.emplace_back(std::move(task));
+            ++queue._size;
+        }
+        // Wake up the target thread or, if it's busy, any idle thread preferring the same NUMA node
+        auto wakeUp = [&] (int streamId) {
+            auto& queue = *_queues[streamId];
+            // claim the idle thread, so the next Enqueue wakes up another one
+            if (!queue._idle.exchange(false))
+                return false;
+            {
+                std::lock_guard<std::mutex> lock(queue._mutex);
+                queue._wakeUp = true;
+            }
+            queue._condVar.notify_one();
+            return true;
+        };
+        if (!wakeUp(target)) {
+            for (auto victim : _queues[target]->_victims) {
+                if (wakeUp(victim))
+                    break;
+            }
+        }
+    }
+
+    std::size_t QueueDepth() const {
+        std::size_t depth = 0;
+        for (auto& queue : _queues)
+            depth += queue->_size.load();
+        return depth;
+    }
+
+    void Stop() {
+        _isStopped = true;
+        for (auto& queue : _queues) {
+            {
+                std::lock_guard<std::mutex> lock(queue->_mutex);
+            }
+            queue->_condVar.notify_all();
+        }
+        for (auto& thread : _threads) {
+            if (thread.joinable()) {
+                thread.join();
+            }
         }
-        _queueCondVar.notify_one();
     }
 
     void Execute(const Task& task, Stream& stream) {
@@ -220,14 +356,19 @@ struct CPUStreamsExecutor::Impl {
     int                                     _streamId = 0;
     std::queue<int>                         _streamIdQueue;
     std::vector<std::thread>                _threads;
-    std::mutex                              _mutex;
-    std::condition_variable                 _queueCondVar;
-    std::queue<Task>                        _taskQueue;
-    bool                                    _isStopped = false;
+    std::vector<std::unique_ptr<WorkerQueue>> _queues;
+    std::atomic<std::size_t>                _nextQueue{0};
+    std::atomic<bool>                       _isStopped{false};
+    std::atomic<std::size_t>                _executedTasks{0};
+    std::atomic<std::size_t>                _stolenTasks{0};
+    std::atomic<std::size_t>                _remoteStolenTasks{0};
     std::vector<int>                        _usedNumaNodes;
     ThreadLocal<std::shared_ptr<Stream>>    _streams;
+    static thread_local std::pair<Impl*, int> _workerQueue;
 };
 
+thread_local std::pair<CPUStreamsExecutor::Impl*, int> CPUStreamsExecutor::Impl::_workerQueue = {nullptr, 0};
+
 
 int CPUStreamsExecutor::GetStreamId() {
     auto stream = _impl->_streams.local();
@@ -244,16 +385,16 @@ CPUStreamsExecutor::CPUStreamsExecutor(const IStreamsExecutor::Config& config) :
 }
 
 CPUStreamsExecutor::~CPUStreamsExecutor() {
-    {
-        std::lock_guard<std::mutex> lock(_impl->_mutex);
-        _impl->_isStopped = true;
-    }
-    _impl->_queueCondVar.notify_all();
-    for (auto& thread : _impl->_threads) {
-        if (thread.joinable()) {
-            thread.join();
-        }
-    }
+    _impl->Stop();
+}
+
+CPUStreamsExecutor::QueueStatistics CPUStreamsExecutor::GetQueueStatistics() const {
+    QueueStatistics statistics;
+    statistics.queueDepth = _impl->QueueDepth();
+    statistics.executedTasks = _impl->_executedTasks;
+    statistics.stolenTasks = _impl->_stolenTasks;
+    statistics.remoteStolenTasks = _impl->_remoteStolenTasks;
+    return statistics;
 }
 
 void CPUStreamsExecutor::Execute(Task task) {
@@ -89,6 +89,31 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
                 lpTransformsMode = LPTransformsMode::On;
             else
                 IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_LP_TRANSFORMS_MODE;
+        } else if (key == PluginConfigInternalParams::KEY_CPU_INTEROP_PARALLEL) {
+            if (val == PluginConfigParams::YES) interOpParallel = true;
+            else if (val == PluginConfigParams::NO) interOpParallel = false;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_INTEROP_PARALLEL
+                                   << ". Expected only YES/NO";
+        } else if (key == PluginConfigInternalParams::KEY_CPU_SHARED_WORKSPACE) {
+            if (val == PluginConfigParams::YES) sharedWorkspace = true;
+            else if (val == PluginConfigParams::NO) sharedWorkspace = false;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_SHARED_WORKSPACE
+                                   << ". Expected only YES/NO";
+        } else if (key == PluginConfigInternalParams::KEY_CPU_FUSED_PREPROCESSING) {
+            if (val == PluginConfigParams::YES) fusedPreprocessing = true;
+            else if (val == PluginConfigParams::NO) fusedPreprocessing = false;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_FUSED_PREPROCESSING
+                                   << ". Expected only YES/NO";
+        } else if (key == PluginConfigInternalParams::KEY_CPU_MEMORY_SOLVER) {
+            if (val == PluginConfigInternalParams::MEMORY_SOLVER_GREEDY) memorySolverStrategy = MemorySolver::Strategy::Greedy;
+            else if (val == PluginConfigInternalParams::MEMORY_SOLVER_BEST_FIT) memorySolverStrategy = MemorySolver::Strategy::BestFit;
+            else if (val == PluginConfigInternalParams::MEMORY_SOLVER_BEST) memorySolverStrategy = MemorySolver::Strategy::Best;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_MEMORY_SOLVER
+                                   << ". Expected only GREEDY/BEST_FIT/BEST";
         } else if (key.compare(PluginConfigParams::KEY_DUMP_QUANTIZED_GRAPH_AS_DOT) == 0) {
             dumpQuantizedGraphToDot = val;
         } else if (key.compare(PluginConfigParams::KEY_DUMP_QUANTIZED_GRAPH_AS_IR) == 0) {
@@ -7,6 +7,7 @@
 #include <string>
 #include <map>
 #include <threading/ie_istreams_executor.hpp>
+#include "mkldnn_memory_solver.hpp"
 
 namespace MKLDNNPlugin {
 
@@ -21,6 +22,10 @@ struct Config {
     bool collectPerfCounters = false;
     bool exclusiveAsyncRequests = false;
     bool enableDynamicBatch = false;
+    bool interOpParallel = false;
+    bool sharedWorkspace = false;
+    bool fusedPreprocessing = true;
+    MemorySolver::Strategy memorySolverStrategy = MemorySolver::Strategy::Greedy;
     std::string dumpToDot = "";
     std::string dumpQuantizedGraphToDot = "";
     std::string dumpQuantizedGraphToIr = "";
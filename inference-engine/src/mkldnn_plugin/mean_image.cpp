@@ -3,6 +3,7 @@
 //
 
 #include "mean_image.h"
+#include <algorithm>
 #include "ie_parallel.hpp"
 #include "nodes/common/cpu_memcpy.h"
 
@@ -28,10 +29,14 @@ void MeanImage::Load(const MKLDNNDims& inputDims, InputInfo::Ptr inputInfo) {
         case MEAN_VALUE: {
             // mean image common value per channel (1x1xC)
             meanValues.resize(inChannels);
+            scaleValues.resize(inChannels);
 
             for (unsigned channel = 0; channel < inChannels; channel++) {
                 meanValues[channel] = pp[channel]->meanValue;
+                scaleValues[channel] = pp[channel]->stdScale;
             }
+            if (std::all_of(scaleValues.begin(), scaleValues.end(), [](float scale) { return scale == 1.0f; }))
+                scaleValues.clear();
         }
         break;
         case MEAN_IMAGE: {
@@ -95,15 +100,31 @@ void MeanImage::Subtract(const MKLDNNDims &inputDims, float *input, InferenceEng
         int C = inputDims[1];
         srcSize /= inputDims[1];
 
-        if (layout == NCHW) {
-            parallel_for3d(MB, C, srcSize, [&](int mb, int c, int i) {
-                input[mb * C * srcSize + c * srcSize + i] -= meanValues[c];
-            });
-        } else if (layout == NHWC) {
-            parallel_for2d(MB, srcSize, [&](int mb, int i) {
-                for (int c = 0; c < C; c++)
-                    input[mb * srcSize * C + i * C + c] -= meanValues[c];
-            });
+        if (scaleValues.empty()) {
+            if (layout == NCHW) {
+                parallel_for3d(MB, C, srcSize, [&](int mb, int c, int i) {
+                    input[mb * C * srcSize + c * srcSize + i] -= meanValues[c];
+                });
+            } else if (layout == NHWC) {
+                parallel_for2d(MB, srcSize, [&](int mb, int i) {
+                    for (int c = 0; c < C; c++)
+                        input[mb * srcSize * C + i * C + c] -= meanValues[c];
+                });
+            }
+        } else {
+            if (layout == NCHW) {
+                parallel_for3d(MB, C, srcSize, [&](int mb, int c, int i) {
+                    auto& value = input[mb * C * srcSize + c * srcSize + i];
+                    value = (value - meanValues[c]) * scaleValues[c];
+                });
+            } else if (layout == NHWC) {
+                parallel_for2d(MB, srcSize, [&](int mb, int i) {
+                    for (int c = 0; c < C; c++) {
+                        auto& value = input[mb * srcSize * C + i * C + c];
+                        value = (value - meanValues[c]) * scaleValues[c];
+                    }
+                });
+            }
         }
     }
 }
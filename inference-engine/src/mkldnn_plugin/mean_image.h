@@ -21,6 +21,20 @@ public:
     void Load(const MKLDNNDims& inputDims, InferenceEngine::InputInfo::Ptr inputInfo);
     void Subtract(const MKLDNNDims &inputDims, float *input, InferenceEngine::Layout layout);
 
+    /**
+     * @brief Per-channel mean values, empty if the mean is given as an image
+     */
+    const std::vector<float>& getMeanValues() const {
+        return meanValues;
+    }
+
+    /**
+     * @brief Per-channel scales the data is multiplied by after the mean subtraction, empty if all of them are 1
+     */
+    const std::vector<float>& getScaleValues() const {
+        return scaleValues;
+    }
+
     template<typename T, typename std::enable_if<std::is_integral<T>::value>::type* = nullptr>
     void Subtract(const MKLDNNDims &inputDims, T *input, InferenceEngine::Layout layout) {
         IE_ASSERT(input != nullptr);
@@ -52,8 +66,7 @@ public:
 
             if (layout == InferenceEngine::NCHW) {
                 InferenceEngine::parallel_for3d(MB, C, srcSize, [&](int mb, int c, int i) {
-                    int buf = input[srcSize * mb * C + c * srcSize + i];
-                    buf -= meanValues[c];
+                    int buf = static_cast<int>((input[srcSize * mb * C + c * srcSize + i] - meanValues[c]) * scale(c));
                     if (buf < (std::numeric_limits<T>::min)()) buf = (std::numeric_limits<T>::min)();
                     if (buf > (std::numeric_limits<T>::max)()) buf = (std::numeric_limits<T>::max)();
                     input[srcSize * mb * C + c * srcSize + i] = buf;
@@ -61,8 +74,7 @@ public:
             } else if (layout == InferenceEngine::NHWC) {
                 InferenceEngine::parallel_for2d(MB, srcSize, [&](int mb, int i) {
                     for (int c = 0; c < C; c++) {
-                        int buf = input[mb * srcSize * C + i * C + c];
-                        buf -= meanValues[c];
+                        int buf = static_cast<int>((input[mb * srcSize * C + i * C + c] - meanValues[c]) * scale(c));
                         if (buf < (std::numeric_limits<T>::min)()) buf = (std::numeric_limits<T>::min)();
                         if (buf > (std::numeric_limits<T>::max)()) buf = (std::numeric_limits<T>::max)();
                         input[mb * srcSize * C + i * C + c] = buf;
@@ -73,7 +85,12 @@ public:
     }
 
 private:
+    float scale(int channel) const {
+        return scaleValues.empty() ? 1.0f : scaleValues[channel];
+    }
+
     std::vector<float> meanValues;
+    std::vector<float> scaleValues;
 
     InferenceEngine::TBlob<float>::Ptr meanBuffer;
 };
@@ -3,6 +3,7 @@
 //
 
 #include <ie_metric_helpers.hpp>
+#include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
 #include <precision_utils.h>
 #include <legacy/net_pass.h>
 #include "mkldnn_exec_network.h"
@@ -11,6 +12,7 @@
 #include "mkldnn_infer_request.h"
 #include "mkldnn_memory_state.h"
 #include "mkldnn_itt.h"
+#include "mkldnn_serialize.h"
 #include "nodes/mkldnn_memory_node.hpp"
 #include <legacy/ie_util_internal.hpp>
 #include <legacy/graph_tools.hpp>
@@ -38,9 +40,13 @@ MKLDNNExecNetwork::CreateInferRequestImpl(InferenceEngine::InputsDataMap network
 MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network,
                                      const Config &cfg,
                                      const MKLDNNExtensionManager::Ptr& extMgr,
-                                     NumaNodesWeights &numaNodesWeights) :
+                                     NumaNodesWeights &numaNodesWeights,
+                                     const InferenceEngine::CNNNetwork &exportedNetwork,
+                                     bool isExportedTransformed) :
     InferenceEngine::ExecutableNetworkThreadSafeDefault{nullptr, nullptr},
     extensionManager(extMgr),
+    _exportedNetwork{exportedNetwork},
+    _isExportedTransformed{isExportedTransformed},
     _cfg{cfg},
     _name{network.getName()},
     _numaNodesWeights(numaNodesWeights) {
@@ -359,6 +365,8 @@ InferenceEngine::Parameter MKLDNNExecNetwork::GetMetric(const std::string &name)
         metrics.push_back(METRIC_KEY(SUPPORTED_METRICS));
         metrics.push_back(METRIC_KEY(SUPPORTED_CONFIG_KEYS));
         metrics.push_back(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS));
+        metrics.push_back(METRIC_KEY(CPU_WORKSPACE_SIZE));
+        metrics.push_back(METRIC_KEY(CPU_WORKSPACE_LOWER_BOUND));
         IE_SET_METRIC_RETURN(SUPPORTED_METRICS, metrics);
     } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
         std::vector<std::string> configKeys;
@@ -373,11 +381,25 @@ InferenceEngine::Parameter MKLDNNExecNetwork::GetMetric(const std::string &name)
         auto streams = std::stoi(option->second);
         IE_SET_METRIC_RETURN(OPTIMAL_NUMBER_OF_INFER_REQUESTS, static_cast<unsigned int>(
             streams ? streams : 1));
+    } else if (name == METRIC_KEY(CPU_WORKSPACE_SIZE)) {
+        IE_SET_METRIC_RETURN(CPU_WORKSPACE_SIZE, const_cast<MKLDNNExecNetwork*>(this)->GetGraph()._graph.GetWorkspaceSize());
+    } else if (name == METRIC_KEY(CPU_WORKSPACE_LOWER_BOUND)) {
+        IE_SET_METRIC_RETURN(CPU_WORKSPACE_LOWER_BOUND, const_cast<MKLDNNExecNetwork*>(this)->GetGraph()._graph.GetWorkspaceLowerBound());
     } else {
         IE_THROW() << "Unsupported ExecutableNetwork metric: " << name;
     }
 }
 
+void MKLDNNExecNetwork::ExportImpl(std::ostream& modelStream) {
+    OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, "MKLDNNExecNetwork::ExportImpl");
+    if (!_exportedNetwork.getFunction())
+        IE_THROW(NotImplemented) << "Export is supported only for networks loaded from ngraph::Function "
+                                    "while the model cache is enabled";
+
+    CNNNetworkSerializer serializer(modelStream, extensionManager, _isExportedTransformed);
+    serializer << _exportedNetwork;
+}
+
 bool MKLDNNExecNetwork::CanProcessDynBatch(const InferenceEngine::CNNNetwork &network) const {
     InputsDataMap inputs = network.getInputsInfo();
 
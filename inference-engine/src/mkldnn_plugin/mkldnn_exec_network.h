@@ -30,7 +30,8 @@ public:
     InferenceEngine::IInferRequest::Ptr CreateInferRequest() override;
 
     MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network, const Config &cfg,
-                      const MKLDNNExtensionManager::Ptr &extMgr, NumaNodesWeights &weightsSharing);
+                      const MKLDNNExtensionManager::Ptr &extMgr, NumaNodesWeights &weightsSharing,
+                      const InferenceEngine::CNNNetwork &exportedNetwork = {}, bool isExportedTransformed = false);
 
     ~MKLDNNExecNetwork() override = default;
 
@@ -46,10 +47,15 @@ public:
     std::vector<InferenceEngine::IVariableStateInternal::Ptr> QueryState() override;
 
 protected:
+    void ExportImpl(std::ostream& modelStream) override;
+
     friend class MKLDNNInferRequest;
     MKLDNNExtensionManager::Ptr extensionManager;
     std::vector<InferenceEngine::IVariableStateInternal::Ptr> memoryStates;
     InferenceEngine::CNNNetwork                 _clonedNetwork;
+    // network used for export, it's kept only when the model cache is enabled
+    InferenceEngine::CNNNetwork                 _exportedNetwork;
+    bool                                        _isExportedTransformed = false;
     std::mutex                                  _cfgMutex;
     Config                                      _cfg;
     std::atomic_int                             _numRequests = {0};
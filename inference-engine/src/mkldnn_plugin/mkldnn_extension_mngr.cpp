@@ -15,6 +15,10 @@ void MKLDNNExtensionManager::AddExtension(IExtensionPtr extension) {
     _extensions.push_back(extension);
 }
 
+const std::vector<InferenceEngine::IExtensionPtr> & MKLDNNExtensionManager::Extensions() const {
+    return _extensions;
+}
+
 InferenceEngine::ILayerImpl::Ptr MKLDNNExtensionManager::CreateImplementation(const std::shared_ptr<ngraph::Node>& op) {
     if (!op)
         IE_THROW() << "Cannot get nGraph operation!";
@@ -20,6 +20,7 @@ public:
     InferenceEngine::ILayerImpl::Ptr CreateImplementation(const std::shared_ptr<ngraph::Node>& op);
     std::shared_ptr<InferenceEngine::ILayerImplFactory> CreateExtensionFactory(const InferenceEngine::CNNLayerPtr& Layer);
     void AddExtension(InferenceEngine::IExtensionPtr extension);
+    const std::vector<InferenceEngine::IExtensionPtr> & Extensions() const;
 
 private:
     std::vector<InferenceEngine::IExtensionPtr> _extensions;
@@ -20,11 +20,14 @@
 #include "mkldnn_extension_utils.h"
 #include "mkldnn_extension_mngr.h"
 #include "mkldnn_memory_solver.hpp"
+#include "mkldnn_workspace_pool.hpp"
 #include "mkldnn_itt.h"
 #include "mkldnn_infer_request.h"
 #include <nodes/mkldnn_input_node.h>
 #include <nodes/mkldnn_reorder_node.h>
 #include <nodes/mkldnn_convert_node.h>
+#include <nodes/mkldnn_concat_node.h>
+#include <nodes/mkldnn_split_node.h>
 
 #include <legacy/graph_tools.hpp>
 #include <ie_algorithm.hpp>
@@ -38,6 +41,7 @@
 
 #include "utils/blob_dump.h"
 #include "utils/general_utils.h"
+#include "utils/allocation_counter.h"
 
 /*****************************************************
  * Debug capability
@@ -45,12 +49,16 @@
  *    to dump intermediate blobs into it
  *  - PRINT_GRAPH_INFO : Define it to enable printing
  *    additional information to std output.
+ *  - COUNT_INFER_ALLOCATIONS : Define it to count heap
+ *    allocations of Infer calls (see AllocationCounter).
+ *    The test object library is built with it.
  *
  *****************************************************/
 // #define BLOB_DUMP_PATH "mkldnn_dump"
 // #define PRINT_GRAPH_INFO
 // #define DUMP_AS_TEXT
 // #define DUMP_INTERNAL_BLOBS
+// #define COUNT_INFER_ALLOCATIONS
 
 #ifdef BLOB_DUMP_PATH
 #   define DUMP_DIR        BLOB_DUMP_PATH
@@ -122,8 +130,8 @@ void MKLDNNGraph::Replicate(const TensorIterator::Body &subgraph, const MKLDNNEx
     std::unordered_map<Data*, std::pair<MKLDNNNodePtr, int>> data2node;
 
     // nodes which has no consumers (output or just unused). But doesn't marked as graph output.
-    // Will be stored as fake output separately.
-    std::unordered_set<DataPtr> unused_data;
+    // Will be stored as fake output separately. Kept in creation order to make the graph deterministic.
+    std::vector<DataPtr> unused_data;
 
     // Step 1. Replicate input nodes
     for (const auto &input : subgraph.inputs) {
@@ -142,7 +150,7 @@ void MKLDNNGraph::Replicate(const TensorIterator::Body &subgraph, const MKLDNNEx
         inputNodes[input->getName()] = node;
 
         if (getInputTo(input).empty()) {
-            unused_data.insert(input);
+            unused_data.push_back(input);
         }
     }
 
@@ -166,12 +174,13 @@ void MKLDNNGraph::Replicate(const TensorIterator::Body &subgraph, const MKLDNNEx
         for (auto &out_data : layer->outData) {
             data2node[out_data.get()] = {node, out_port_idx++};
             if (getInputTo(out_data).empty()) {
-                unused_data.insert(out_data);
+                unused_data.push_back(out_data);
             }
         }
     }
 
     // Step 3. Add output nodes and output stubs for unused data objects.
+    std::unordered_set<Data*> output_data;
     for (const auto &output : subgraph.outputs) {
         auto port_info = data2node[output.get()];
         auto parent_node = port_info.first;
@@ -188,11 +197,13 @@ void MKLDNNGraph::Replicate(const TensorIterator::Body &subgraph, const MKLDNNEx
         graphNodes.push_back(node);
         outputNodes.push_back(node);
 
-        unused_data.erase(output);
+        output_data.insert(output.get());
     }
 
     // Add stub output node for unused data
     for (auto to_stub_data : unused_data) {
+        if (output_data.count(to_stub_data.get())) continue;
+
         auto port_info = data2node[to_stub_data.get()];
         auto parent_node = port_info.first;
         auto parent_port_idx = port_info.second;
@@ -224,11 +235,11 @@ void MKLDNNGraph::Replicate(const CNNNetwork &network, const MKLDNNExtensionMana
     }
 
     std::unordered_map<CNNLayerPtr, MKLDNNNodePtr> layer2node;
-    std::unordered_set<DataPtr> unused_data;  // nodes which has no consumers (output or just unused)
+    std::vector<DataPtr> unused_data;  // nodes which has no consumers (output or just unused), in creation order
 
     auto _parent_port = [] (const DataPtr &data) -> int {
         auto parent = getCreatorLayer(data).lock();
-        for (int i = 0; parent->outData.size(); i++)
+        for (int i = 0; i < parent->outData.size(); i++)
             if (data == parent->outData[i])
                 return i;
         return -1;
@@ -266,12 +277,13 @@ void MKLDNNGraph::Replicate(const CNNNetwork &network, const MKLDNNExtensionMana
         }
         for (auto &out_data : layer->outData) {
             if (getInputTo(out_data).empty()) {
-                unused_data.insert(out_data);
+                unused_data.push_back(out_data);
             }
         }
     }
 
     OutputsDataMap outputs = network.getOutputsInfo();
+    std::unordered_set<Data*> output_data;
     for (const auto &output : outputs) {
         const auto data = output.second;
 
@@ -290,11 +302,13 @@ void MKLDNNGraph::Replicate(const CNNNetwork &network, const MKLDNNExtensionMana
         graphNodes.push_back(node);
         outputNodes.push_back(node);
 
-        unused_data.erase(data);
+        output_data.insert(data.get());
     }
 
     // Add stub output node for unused data
     for (auto to_stub_data : unused_data) {
+        if (output_data.count(to_stub_data.get())) continue;
+
         auto parent_layer = getCreatorLayer(to_stub_data).lock();
         auto parent_node = layer2node[parent_layer];
 
@@ -381,6 +395,8 @@ void MKLDNNGraph::InitGraph() {
 #endif
 
     ExecuteConstantNodesOnly();
+
+    CollectSharedWorkspaceMemory();
 }
 
 void MKLDNNGraph::SetOriginalLayerNames() {
@@ -615,9 +631,101 @@ static edge_clusters_t findEdgeClusters(const std::vector<MKLDNNEdgePtr> & graph
     return edge_clusters;
 }
 
+// Eltwise node may write the output over its first input if it's the last consumer of the input and
+// the data have the same layout. Returns pairs of the output and input cluster indices.
+static std::vector<std::pair<int, int>> findInPlaceClusters(const edge_clusters_t &edge_clusters,
+                                                            const std::vector<MemorySolver::Box> &boxes,
+                                                            const std::vector<int> &execSteps) {
+    std::unordered_map<MKLDNNEdgePtr, int> cluster_indices;
+    for (int i = 0; i < edge_clusters.size(); i++) {
+        for (auto &edge : edge_clusters[i])
+            cluster_indices[edge] = i;
+    }
+
+    std::vector<std::pair<int, int>> in_place;
+    for (int i = 0; i < edge_clusters.size(); i++) {
+        for (auto &edge : edge_clusters[i]) {
+            if (edge->getStatus() != MKLDNNEdge::Status::NeedAllocation)
+                continue;
+            auto node = edge->getParent();
+            if (node->getType() != Eltwise || node->getParentEdges().empty())
+                continue;
+
+            auto input = node->getParentEdgeAt(0);
+            auto producer = cluster_indices.find(input);
+            // The input must be the start of its memory, views with offsets would be overwritten
+            // before they are read. Inputs and concatenations are skipped as MKLDNNEltwiseNode::canBeInPlace does.
+            if (producer == cluster_indices.end() || producer->second == i ||
+                input->getStatus() != MKLDNNEdge::Status::NeedAllocation ||
+                input->getParent()->getType() == Input || input->getParent()->getType() == Concatenation ||
+                boxes[producer->second].finish != execSteps[node->execIndex] ||
+                !(input->getDesc() == edge->getDesc()))
+                continue;
+
+            bool otherInputsAreSeparate = true;
+            for (size_t port = 1; port < node->getParentEdges().size(); port++) {
+                auto other = cluster_indices.find(node->getParentEdgeAt(port));
+                otherInputsAreSeparate &= other == cluster_indices.end() || other->second != producer->second;
+            }
+            if (otherInputsAreSeparate)
+                in_place.emplace_back(i, producer->second);
+        }
+    }
+    return in_place;
+}
+
+// Dumps the boxes in the text format read by the memory solver benchmark:
+// "box <start> <finish> <size in bytes>" and "inplace <box index> <producer box index>" lines
+static void dumpMemoryBoxes(const std::string &file, const std::vector<MemorySolver::Box> &boxes,
+                            const std::vector<std::pair<int, int>> &in_place, int64_t alignment) {
+    std::ofstream out(file);
+    if (!out.is_open()) IE_THROW() << "CPU Plugin cannot create memory boxes file " << file << ".";
+
+    for (auto &box : boxes)
+        out << "box " << box.start << " " << box.finish << " " << box.size * alignment << "\n";
+    for (auto &pair : in_place)
+        out << "inplace " << pair.first << " " << pair.second << "\n";
+}
+
+// The nodes which take the data pointers from the edge memory on every execution, or bind the edge memory objects
+// to their primitives. The shared workspace can be rebased only under such nodes: the other ones may keep raw
+// pointers taken at createPrimitive time.
+static bool isWorkspaceRebaseSafe(Type type) {
+    switch (type) {
+        case Generic:
+        case Reorder:
+        case Input:
+        case Output:
+        case Convolution:
+        case Deconvolution:
+        case Activation:
+        case Depthwise:
+        case Lrn:
+        case Pooling:
+        case FullyConnected:
+        case SoftMax:
+        case Split:
+        case Concatenation:
+        case Eltwise:
+        case Gemm:
+        case Reshape:
+        case Flatten:
+        case Permute:
+        case Convert:
+            return true;
+        default:
+            return false;
+    }
+}
+
 void MKLDNNGraph::AllocateWithReuse() {
     edge_clusters_t edge_clusters = findEdgeClusters(graphEdges);
 
+    const bool useSharedWorkspace = config.sharedWorkspace &&
+        std::all_of(graphNodes.begin(), graphNodes.end(), [](const MKLDNNNodePtr &node) {
+            return isWorkspaceRebaseSafe(node->getType());
+        });
+
     size_t edge_clusters_count = edge_clusters.size();
 
     for (size_t i = 0; i < edge_clusters_count;) {
@@ -641,15 +749,27 @@ void MKLDNNGraph::AllocateWithReuse() {
 
     edge_clusters.resize(edge_clusters_count);
 
+    // Lifetime of the tensors is measured in execution steps. In case of inter-op parallel execution
+    // all nodes of a group are executed at the same step, so the tensors they use never share memory.
+    std::vector<int> execSteps(graphNodes.size());
+    for (auto &node : graphNodes)
+        execSteps[node->execIndex] = node->execIndex;
+    for (int i = 0; i < parallelExecGroups.size(); i++) {
+        for (auto &node : parallelExecGroups[i])
+            execSteps[node->execIndex] = i;
+    }
+
     const int64_t alignment = 32;  // 32 bytes
 
     std::vector<MemorySolver::Box> boxes(edge_clusters.size());
+    // Constant and input data must stay untouched between inferences, so they are never placed to the shared workspace
+    std::vector<bool> ownedByGraph(edge_clusters.size(), true);
     for (int i = 0; i < edge_clusters.size(); i++) {
         MemorySolver::Box &box = boxes[i];
         box = { std::numeric_limits<int>::max(), 0, 0, i };
         for (auto &edge : edge_clusters[i]) {
-            int e_start = edge->getParent()->execIndex;
-            int e_finish = edge->getChild()->execIndex;
+            int e_start = execSteps[edge->getParent()->execIndex];
+            int e_finish = execSteps[edge->getChild()->execIndex];
 
             const BlockingDesc block_desk = edge->getDesc().getBlockingDesc();
 
@@ -682,6 +802,7 @@ void MKLDNNGraph::AllocateWithReuse() {
             isOutput |= edge->getChild()->getType() == Output;
             isInput  |= edge->getParent()->getType() == Input;
         }
+        ownedByGraph[i] = isConst || isInput;
 
         if (reuse_io_tensors) {
             if (isInput | isConst) box.start = 0;
@@ -696,25 +817,64 @@ void MKLDNNGraph::AllocateWithReuse() {
         box.size = div_up(box.size, alignment);
     }
 
-    MemorySolver memSolver(boxes);
-    size_t total_size = static_cast<size_t>(memSolver.solve()) * alignment;
+    std::vector<MemorySolver::Box> ownBoxes, sharedBoxes;
+    for (auto &box : boxes) {
+        if (useSharedWorkspace && !ownedByGraph[box.id])
+            sharedBoxes.push_back(box);
+        else
+            ownBoxes.push_back(box);
+    }
+
+    MemorySolver memSolver(ownBoxes);
+    MemorySolver sharedMemSolver(sharedBoxes);
+
+    // Execution steps of concurrently executed nodes are the same, so the last consumer of a tensor
+    // is not defined in case of inter-op parallel execution
+    std::vector<std::pair<int, int>> in_place_clusters;
+    if (config.memorySolverStrategy != MemorySolver::Strategy::Greedy && parallelExecGroups.empty()) {
+        in_place_clusters = findInPlaceClusters(edge_clusters, boxes, execSteps);
+        for (auto &in_place : in_place_clusters) {
+            bool shared = useSharedWorkspace && !ownedByGraph[in_place.first];
+            if (shared != (useSharedWorkspace && !ownedByGraph[in_place.second]))
+                continue;
+            (shared ? sharedMemSolver : memSolver).allowInPlace(in_place.first, in_place.second);
+        }
+    }
+
+    size_t total_size = static_cast<size_t>(memSolver.solve(config.memorySolverStrategy)) * alignment;
 
     memWorkspace = std::make_shared<MKLDNNMemory>(eng);
     memWorkspace->Create(MKLDNNMemoryDesc(TensorDesc(Precision::I8, {total_size}, Layout::C)));
 
+    // The shared workspace is leased only to get the initial addresses, Infer leases it again and
+    // rebases the memory if another workspace is given, see LeaseWorkspace()
+    sharedWorkspaceSize = static_cast<size_t>(sharedMemSolver.solve(config.memorySolverStrategy)) * alignment;
+
+    workspaceSize = total_size + sharedWorkspaceSize;
+    workspaceLowerBound = static_cast<size_t>(memSolver.maxDepth() + sharedMemSolver.maxDepth()) * alignment;
+    if (!config.dumpToDot.empty())
+        dumpMemoryBoxes(config.dumpToDot + "_memory_boxes.txt", boxes, in_place_clusters, alignment);
+
+    MKLDNNWorkspacePool::Lease sharedWorkspace;
+    if (!sharedBoxes.empty())
+        sharedWorkspace = MKLDNNWorkspacePool::GetInstance().acquire(sharedWorkspaceSize);
+    sharedWorkspaceBase = sharedWorkspace.data();
+
     if (edge_clusters.empty())
         return;
 
     auto* workspace_ptr = static_cast<int8_t*>(memWorkspace->GetData());
+    auto* shared_workspace_ptr = static_cast<int8_t*>(sharedWorkspaceBase);
 
     for (int i = 0; i < edge_clusters.size(); i++) {
+        const bool isShared = useSharedWorkspace && !ownedByGraph[i];
         int count = 0;
         for (auto &edge : edge_clusters[i]) {
             if (edge->getStatus() == MKLDNNEdge::Status::NeedAllocation) {
-                int64_t offset = memSolver.getOffset(i);
+                int64_t offset = isShared ? sharedMemSolver.getOffset(i) : memSolver.getOffset(i);
                 // !! Fallback to individual memory allocation !!
                 // if you like to check infer without reuse just call this function without arguments.
-                edge->allocate(workspace_ptr + offset * alignment);  // alignment in byte
+                edge->allocate((isShared ? shared_workspace_ptr : workspace_ptr) + offset * alignment);  // alignment in byte
 
                 // TODO: WA for some test (like strided_slice_test) which use tensors with
                 //       shapes {0}. And it is implisitly converted into {1} tensor.
@@ -729,6 +889,103 @@ void MKLDNNGraph::AllocateWithReuse() {
     }
 }
 
+void MKLDNNGraph::CollectSharedWorkspaceMemory() {
+    sharedWorkspaceMemory.clear();
+    if (sharedWorkspaceBase == nullptr)
+        return;
+
+    // Views and in-place edges have their own memory objects pointing into the workspace, so all
+    // the edges are checked. The same memory object may be used by several edges.
+    auto base = reinterpret_cast<uintptr_t>(sharedWorkspaceBase);
+    std::unordered_set<dnnl_memory_t> collected;
+    for (auto &edge : graphEdges) {
+        if (edge->getStatus() == MKLDNNEdge::Status::Uninitialized)
+            continue;
+        auto memory = edge->getMemory().GetPrimitive();
+        auto ptr = reinterpret_cast<uintptr_t>(memory.get_data_handle());
+        if (ptr < base || ptr >= base + sharedWorkspaceSize || !collected.insert(memory.get()).second)
+            continue;
+        sharedWorkspaceMemory.emplace_back(memory, static_cast<size_t>(ptr - base));
+    }
+}
+
+MKLDNNWorkspacePool::Lease MKLDNNGraph::LeaseWorkspace() {
+    if (sharedWorkspaceBase == nullptr)
+        return {};
+
+    auto lease = MKLDNNWorkspacePool::GetInstance().acquire(sharedWorkspaceSize, sharedWorkspaceBase);
+    if (lease.data() != sharedWorkspaceBase) {
+        // The data handles are set to the workspace also for the memory redirected to the user blobs,
+        // the request redirects it again as the handle is changed
+        auto* base = static_cast<int8_t*>(lease.data());
+        for (auto &memory : sharedWorkspaceMemory)
+            memory.first.set_data_handle(base + memory.second);
+        sharedWorkspaceBase = lease.data();
+    }
+    return lease;
+}
+
+void MKLDNNGraph::InitParallelExecGroups() {
+    parallelExecGroups.clear();
+
+#if IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO
+    if (!config.interOpParallel)
+        return;
+
+    // Memory nodes pass data through the variable state instead of edges,
+    // so the graph topology doesn't define the order of their execution
+    for (auto &node : graphNodes) {
+        if (node->getType() == MemoryInput || node->getType() == MemoryOutput)
+            return;
+    }
+
+    edge_clusters_t edge_clusters = findEdgeClusters(graphEdges);
+    std::unordered_map<MKLDNNEdgePtr, size_t> edge_cluster_indices;
+    for (size_t i = 0; i < edge_clusters.size(); i++) {
+        for (auto &edge : edge_clusters[i])
+            edge_cluster_indices[edge] = i;
+    }
+
+    // The latest groups where the memory of a cluster was read or modified in-place.
+    // Accesses to the memory modified in-place keep the order of the sequential execution.
+    std::vector<int> lastRead(edge_clusters.size(), -1);
+    std::vector<int> lastInPlaceWrite(edge_clusters.size(), -1);
+
+    // graphNodes are sorted topologically, so all producers are visited before their consumers
+    std::vector<int> groups(graphNodes.size(), 0);
+    int groupsCount = 0;
+    for (auto &node : graphNodes) {
+        int &group = groups[node->execIndex];
+        for (size_t i = 0; i < node->getParentEdges().size(); i++) {
+            auto edge = node->getParentEdgeAt(i);
+            group = std::max(group, groups[edge->getParent()->execIndex] + 1);
+
+            size_t cluster = edge_cluster_indices[edge];
+            group = std::max(group, lastInPlaceWrite[cluster] + 1);
+            if (edge->inPlace(MKLDNNEdge::LOOK_DOWN))
+                group = std::max(group, lastRead[cluster] + 1);
+        }
+
+        for (size_t i = 0; i < node->getParentEdges().size(); i++) {
+            auto edge = node->getParentEdgeAt(i);
+            size_t cluster = edge_cluster_indices[edge];
+            lastRead[cluster] = std::max(lastRead[cluster], group);
+            if (edge->inPlace(MKLDNNEdge::LOOK_DOWN))
+                lastInPlaceWrite[cluster] = std::max(lastInPlaceWrite[cluster], group);
+        }
+        groupsCount = std::max(groupsCount, group + 1);
+    }
+
+    // Nothing to execute concurrently
+    if (groupsCount == graphNodes.size())
+        return;
+
+    parallelExecGroups.resize(groupsCount);
+    for (auto &node : graphNodes)
+        parallelExecGroups[groups[node->execIndex]].push_back(node);
+#endif
+}
+
 void MKLDNNGraph::Allocate() {
     OV_ITT_SCOPED_TASK(itt::domains::MKLDNN_LT, "MKLDNNGraph::Allocate");
 
@@ -737,6 +994,9 @@ void MKLDNNGraph::Allocate() {
     //   NotAllocated - view on other blob, peer or in-place
     for (auto& edge : graphEdges) edge->init();
 
+    // Execution groups define the lifetime of the tensors, so they are required for memory reuse
+    InitParallelExecGroups();
+
     // Allocate memory space for all edges marked with NeedAllocation
     AllocateWithReuse();
 
@@ -755,7 +1015,7 @@ void MKLDNNGraph::CreatePrimitives() {
     }
 }
 
-void MKLDNNGraph::PushInputData(const std::string& name, const InferenceEngine::Blob::Ptr &in) {
+void MKLDNNGraph::PushInputData(const std::string& name, const InferenceEngine::Blob::Ptr &in, bool subtractMean) {
     if (!IsReady()) IE_THROW()<< "Wrong state. Topology not ready.";
 
     auto input = inputNodes.find(name);
@@ -775,7 +1035,7 @@ void MKLDNNGraph::PushInputData(const std::string& name, const InferenceEngine::
         }
 
         // todo: make sure 'name' exists in this map...
-        if (_meanImages.find(name) != _meanImages.end()) {
+        if (subtractMean && _meanImages.find(name) != _meanImages.end()) {
             if (in->getTensorDesc().getPrecision() == InferenceEngine::Precision::FP32) {
                 _meanImages[name].Subtract(outDims, reinterpret_cast<float *>(inter_data_ptr), in->getTensorDesc().getLayout());
             } else {
@@ -794,8 +1054,8 @@ void MKLDNNGraph::PullOutputData(BlobMap &out) {
     for (MKLDNNNodePtr &node : outputNodes) {
         // remove out_ from node name
         std::string name = node->getName().substr(4);
-        const MKLDNNMemory& intr_blob = node->getParentEdgeAt(0)->getMemory();
         if (out.find(name) == out.end()) {
+            const MKLDNNMemory& intr_blob = node->getParentEdgeAt(0)->getMemory();
             // TODO: Create blob from MemoryDesc
             Blob::Ptr outBlob = make_shared_blob<float>({Precision::FP32, node->getParentEdgeAt(0)->getDims().ToSizeVector(),
                                                          TensorDesc::getLayoutByDims(node->getParentEdgeAt(0)->getDims().ToSizeVector())},
@@ -803,38 +1063,101 @@ void MKLDNNGraph::PullOutputData(BlobMap &out) {
             out[name] = outBlob;
         }
 
-        Blob::Ptr &ext_blob = out[name];
+        PullOutputData(node, out[name]);
+    }
+}
+
+void MKLDNNGraph::PullOutputData(const std::string& name, Blob::Ptr &out) {
+    if (!IsReady())
+        IE_THROW() << "Wrong state. Topology not ready.";
 
-        // TODO: Why we allow allocation of output memory inside Infer call??
-        // Suggestion is to disable this behaviour
-        if (ext_blob->buffer() == nullptr) {
-            ext_blob->allocate();
+    for (MKLDNNNodePtr &node : outputNodes) {
+        if (node->getName() == "out_" + name) {
+            PullOutputData(node, out);
+            return;
         }
+    }
+    IE_THROW() << "Output blob for infer '" << name << "' doesn't correspond to output in network";
+}
 
-        auto srcPrec = MKLDNNExtensionUtils::DataTypeToIEPrecision(intr_blob.GetDataType());
-        auto dstPrec = ext_blob->getTensorDesc().getPrecision();
-        if (srcPrec == dstPrec && ext_blob->byteSize() != intr_blob.GetSize())
-                IE_THROW() << "Output blob byte size is not equal network output byte size ("
-                                   << ext_blob->byteSize() << "!=" << intr_blob.GetSize() << ").";
-        if (ext_blob->size() != intr_blob.GetElementsCount())
-            IE_THROW() << "Output blob number of elements is not equal network output number of elements ("
-                               << ext_blob->size() << "!=" << intr_blob.GetElementsCount() << ").";
-
-        void *ext_blob_ptr = ext_blob->buffer();
-        void *intr_blob_ptr = intr_blob.GetData();
-
-        // That is the same memory. No need to copy
-        if (ext_blob_ptr == intr_blob_ptr) continue;
-
-        int MB = intr_blob.GetDims()[0];
-        int MB_to_process = node->batchToProcess();
-        // TODO: Should we support InferenceEngine::PluginConfigParams::KEY_DYN_BATCH_LIMIT???
-        if (config.batchLimit)
-            MB_to_process = std::min<int>(config.batchLimit, MB_to_process);
-        size_t size_to_copy = intr_blob.GetElementsCount() * MB_to_process / MB;
-
-        cpu_convert(intr_blob_ptr, ext_blob_ptr, srcPrec, dstPrec, size_to_copy);
+void MKLDNNGraph::PullOutputData(const MKLDNNNodePtr &node, Blob::Ptr &ext_blob) {
+    const MKLDNNMemory& intr_blob = node->getParentEdgeAt(0)->getMemory();
+
+    // TODO: Why we allow allocation of output memory inside Infer call??
+    // Suggestion is to disable this behaviour
+    if (ext_blob->buffer() == nullptr) {
+        ext_blob->allocate();
+    }
+
+    auto srcPrec = MKLDNNExtensionUtils::DataTypeToIEPrecision(intr_blob.GetDataType());
+    auto dstPrec = ext_blob->getTensorDesc().getPrecision();
+    if (srcPrec == dstPrec && ext_blob->byteSize() != intr_blob.GetSize())
+            IE_THROW() << "Output blob byte size is not equal network output byte size ("
+                               << ext_blob->byteSize() << "!=" << intr_blob.GetSize() << ").";
+    if (ext_blob->size() != intr_blob.GetElementsCount())
+        IE_THROW() << "Output blob number of elements is not equal network output number of elements ("
+                           << ext_blob->size() << "!=" << intr_blob.GetElementsCount() << ").";
+
+    void *ext_blob_ptr = ext_blob->buffer();
+    void *intr_blob_ptr = intr_blob.GetData();
+
+    // That is the same memory. No need to copy
+    if (ext_blob_ptr == intr_blob_ptr) return;
+
+    int MB = intr_blob.GetDims()[0];
+    int MB_to_process = node->batchToProcess();
+    // TODO: Should we support InferenceEngine::PluginConfigParams::KEY_DYN_BATCH_LIMIT???
+    if (config.batchLimit)
+        MB_to_process = std::min<int>(config.batchLimit, MB_to_process);
+    size_t size_to_copy = intr_blob.GetElementsCount() * MB_to_process / MB;
+
+    cpu_convert(intr_blob_ptr, ext_blob_ptr, srcPrec, dstPrec, size_to_copy);
+}
+
+bool MKLDNNGraph::CanChangeInputMemory(const MKLDNNNodePtr& input) {
+    // Input cannot be in-place with other primitives
+    for (size_t i = 0; i < input->getChildEdges().size(); i++) {
+        auto& child = input->getChildEdgeAt(i)->getChild();
+        if (child->isConstant())
+            return false;
+        auto* concat = dynamic_cast<MKLDNNConcatNode *>(child.get());
+        if (concat && concat->isOptimized())
+            return false;
+
+        // Cannot be in-place before split because split is using different ptrs without offsets
+        auto* split = dynamic_cast<MKLDNNSplitNode *>(child.get());
+        if (split)
+            return false;
+
+        if (child->isInplace())
+            return false;
+        for (size_t j = 0; j < child->getChildEdges().size(); j++) {
+            if (child->getChildEdgeAt(j)->getMemory().GetPrimitive().get_data_handle() ==
+                    input->getChildEdgeAt(i)->getMemory().GetPrimitive().get_data_handle())
+                return false;
+        }
     }
+    return true;
+}
+
+bool MKLDNNGraph::CanChangeOutputMemory(const MKLDNNNodePtr& output) {
+    void * defaultPtr = output->getParentEdgeAt(0)->getMemory().GetPrimitivePtr()->get_data_handle();
+    // Cannot be in-place after concat because concat is using different ptrs without offsets
+    auto parent = output->getParentEdgeAt(0)->getParent();
+    MKLDNNNodePtr previousParent;
+    do {
+        previousParent = parent;
+        if (parent->getChildEdges().size() != 1 || parent->isConstant() || parent->isInplace())
+            return false;
+
+        for (size_t i = 0; i < parent->getParentEdges().size(); i++) {
+            if (parent->getParentEdgeAt(i)->getMemory().GetPrimitivePtr()->get_data_handle() == defaultPtr) {
+                parent = parent->getParentEdgeAt(i)->getParent();
+                break;
+            }
+        }
+    } while (previousParent != parent);
+    return true;
 }
 
 void MKLDNNGraph::Infer(MKLDNNInferRequest* request, int batch) {
@@ -842,77 +1165,105 @@ void MKLDNNGraph::Infer(MKLDNNInferRequest* request, int batch) {
         IE_THROW() << "Wrong state. Topology is not ready.";
     }
 
-    mkldnn::stream stream(eng);
+#ifdef COUNT_INFER_ALLOCATIONS
+    AllocationCounter::Scope allocationScope;
+#endif
 
-    for (int i = 0; i < graphNodes.size(); i++) {
-        if (request != nullptr) {
-            request->ThrowIfCanceled();
+    if (!inferStream) {
+        inferStream = mkldnn::stream(eng);
+        for (auto &group : parallelExecGroups) {
+            while (groupStreams.size() < group.size())
+                groupStreams.emplace_back(eng);
         }
+    }
 
-        PERF(graphNodes[i]);
-
-        if (batch > 0)
-            graphNodes[i]->setDynamicBatchLim(batch);
+    if (parallelExecGroups.empty()) {
+        for (int i = 0; i < graphNodes.size(); i++) {
+            if (request != nullptr) {
+                request->ThrowIfCanceled();
+            }
 
-        ENABLE_DUMP(do_before(DUMP_DIR, graphNodes[i]));
+            ExecuteNode(graphNodes[i], inferStream, batch);
+        }
+    } else {
+        for (auto &group : parallelExecGroups) {
+            if (request != nullptr) {
+                request->ThrowIfCanceled();
+            }
 
-        if (!graphNodes[i]->isConstant()) {
-            OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, graphNodes[i]->profiling.execute);
-            graphNodes[i]->execute(stream);
+            if (group.size() == 1) {
+                ExecuteNode(group[0], inferStream, batch);
+            } else {
+                // Nodes run inside the arena of the current stream, their own parallel regions are nested into it
+                parallel_for(group.size(), [&](size_t i) {
+                    ExecuteNode(group[i], groupStreams[i], batch);
+                });
+            }
         }
-        ENABLE_DUMP(do_after(DUMP_DIR, graphNodes[i]));
     }
 
     if (infer_count != -1) infer_count++;
 }
 
-void MKLDNNGraph::VisitNode(MKLDNNNodePtr node, std::vector<MKLDNNNodePtr>& sortedNodes) {
-    if (node->temporary) {
-        return;
-    }
+void MKLDNNGraph::ExecuteNode(const MKLDNNNodePtr& node, mkldnn::stream& stream, int batch) {
+    PERF(node);
 
-    if (node->permanent) {
-        return;
-    }
+    if (batch > 0)
+        node->setDynamicBatchLim(batch);
 
-    node->temporary = true;
+    ENABLE_DUMP(do_before(DUMP_DIR, node));
 
-    for (size_t i = 0; i < node->getChildEdges().size(); i++) {
-        VisitNode(node->getChildEdgeAt(i)->getChild(), sortedNodes);
+    if (!node->isConstant()) {
+        OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, node->profiling.execute);
+        node->execute(stream);
     }
-
-    node->permanent = true;
-    node->temporary = false;
-
-    sortedNodes.insert(sortedNodes.begin(), node);
+    ENABLE_DUMP(do_after(DUMP_DIR, node));
 }
 
 void MKLDNNGraph::SortTopologically() {
     OV_ITT_SCOPED_TASK(itt::domains::MKLDNN_LT, "MKLDNNGraph::SortTopologically");
 
-    std::vector<MKLDNNNodePtr> unsorted;
+    // Depth-first search with an explicit stack: deep graphs (e.g. unrolled RNNs) must not overflow
+    // the call stack. Nodes are collected in post-order and reversed at the end, so the resulting
+    // order is the same as the one produced by prepending each finished node to the sorted list.
     std::vector<MKLDNNNodePtr> sorted;
+    sorted.reserve(graphNodes.size());
 
-    for (int i = 0; i < graphNodes.size(); i++) {
-        MKLDNNNodePtr node = graphNodes[i];
-
+    for (auto &node : graphNodes) {
         node->permanent = false;
         node->temporary = false;
-
-        unsorted.push_back(node);
     }
 
-    while (!unsorted.empty()) {
-        MKLDNNNodePtr node = unsorted.at(0);
-        unsorted.erase(unsorted.begin());
+    std::vector<std::pair<MKLDNNNodePtr, size_t>> stack;
+    for (auto &root : graphNodes) {
+        if (root->permanent)
+            continue;
+
+        root->temporary = true;
+        stack.emplace_back(root, 0);
+        while (!stack.empty()) {
+            auto &top = stack.back();
+            const auto node = top.first;
+            if (top.second < node->getChildEdges().size()) {
+                auto child = node->getChildEdgeAt(top.second++)->getChild();
+                if (!child->temporary && !child->permanent) {
+                    child->temporary = true;
+                    stack.emplace_back(child, 0);
+                }
+                continue;
+            }
 
-        VisitNode(node, sorted);
+            node->permanent = true;
+            node->temporary = false;
+            sorted.push_back(node);
+            stack.pop_back();
+        }
     }
+    std::reverse(sorted.begin(), sorted.end());
 
     for (int i = 0; i < sorted.size(); i++) sorted[i]->execIndex = i;
 
-    graphNodes.erase(graphNodes.begin(), graphNodes.end());
-    graphNodes.assign(sorted.begin(), sorted.end());
+    graphNodes.swap(sorted);
 
     // TODO: Sort in/out edges by port index because of backward compatibility
     //       A lot of plugin logic are build on top of assumption that index in
@@ -1137,29 +1488,17 @@ void MKLDNNGraph::DropDWConvNode(const MKLDNNNodePtr &node) {
 void MKLDNNGraph::RemoveDroppedNodes() {
     auto& nodes = this->GetNodes();
 
-    auto it = nodes.begin();
-
-    while (it != nodes.end()) {
-        if ((*it)->isDropped()) {
-            it = nodes.erase(it);
-        } else {
-            it++;
-        }
-    }
+    nodes.erase(std::remove_if(nodes.begin(), nodes.end(),
+                               [](const MKLDNNNodePtr& node) { return node->isDropped(); }),
+                nodes.end());
 }
 
 void MKLDNNGraph::RemoveDroppedEdges() {
     auto& edges = this->GetEdges();
 
-    auto it = edges.begin();
-
-    while (it != edges.end()) {
-        if ((*it)->isDropped()) {
-            it = edges.erase(it);
-        } else {
-            it++;
-        }
-    }
+    edges.erase(std::remove_if(edges.begin(), edges.end(),
+                               [](const MKLDNNEdgePtr& edge) { return edge->isDropped(); }),
+                edges.end());
 }
 
 MKLDNNNodePtr MKLDNNGraph::InsertReorder(MKLDNNEdgePtr edge, std::string layerName, const TensorDesc& inDesc, const TensorDesc& outDesc,
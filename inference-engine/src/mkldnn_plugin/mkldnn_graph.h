@@ -11,6 +11,7 @@
 #include "mean_image.h"
 #include "mkldnn_node.h"
 #include "mkldnn_edge.h"
+#include "mkldnn_workspace_pool.hpp"
 #include "threading/ie_thread_local.hpp"
 #include <map>
 #include <string>
@@ -56,8 +57,49 @@ public:
         return _meanImages.find(name) != _meanImages.end();
     }
 
-    void PushInputData(const std::string& name, const InferenceEngine::Blob::Ptr &in);
+    const std::vector<float>& getMeanValuesFor(const std::string& name) const {
+        static const std::vector<float> none;
+        auto mean = _meanImages.find(name);
+        return mean != _meanImages.end() ? mean->second.getMeanValues() : none;
+    }
+
+    const std::vector<float>& getScaleValuesFor(const std::string& name) const {
+        static const std::vector<float> none;
+        auto mean = _meanImages.find(name);
+        return mean != _meanImages.end() ? mean->second.getScaleValues() : none;
+    }
+
+    /**
+     * @param subtractMean false if the mean of the input has already been subtracted by the pre-processing
+     */
+    void PushInputData(const std::string& name, const InferenceEngine::Blob::Ptr &in, bool subtractMean = true);
     void PullOutputData(InferenceEngine::BlobMap &out);
+    void PullOutputData(const std::string& name, InferenceEngine::Blob::Ptr &out);
+
+    /**
+     * @brief Checks whether the memory of the input node child edges can be replaced with an external buffer,
+     * which is not possible if other nodes use this memory in-place
+     */
+    static bool CanChangeInputMemory(const MKLDNNNodePtr& input);
+
+    /**
+     * @brief Checks whether the memory of the output node parent edge can be replaced with an external buffer
+     */
+    static bool CanChangeOutputMemory(const MKLDNNNodePtr& output);
+
+    /**
+     * Leases the shared workspace for an inference and rebinds the graph memory to it if needed.
+     * Returns an empty lease if the graph owns all its memory
+     */
+    MKLDNNWorkspacePool::Lease LeaseWorkspace();
+
+    size_t GetWorkspaceSize() const {
+        return workspaceSize;
+    }
+
+    size_t GetWorkspaceLowerBound() const {
+        return workspaceLowerBound;
+    }
 
     void Infer(MKLDNNInferRequest* request = nullptr, int batch = -1);
 
@@ -160,17 +202,21 @@ public:
     void SortTopologically();
 
 protected:
-    void VisitNode(MKLDNNNodePtr node, std::vector<MKLDNNNodePtr>& sortedNodes);
 
     void ForgetGraphData() {
         status = NotReady;
         eng = mkldnn::engine(mkldnn::engine::kind::cpu, 0);
+        inferStream = mkldnn::stream();
+        groupStreams.clear();
 
         inputNodes.clear();
         outputNodes.clear();
         graphNodes.clear();
         graphEdges.clear();
         _meanImages.clear();
+        sharedWorkspaceSize = 0;
+        sharedWorkspaceBase = nullptr;
+        sharedWorkspaceMemory.clear();
     }
     Status status { NotReady };
     Config config;
@@ -182,6 +228,15 @@ protected:
     bool reuse_io_tensors = true;
 
     MKLDNNMemoryPtr memWorkspace;
+    // Size of the workspace planned by the memory solver and the lower bound of it for the given lifetimes
+    size_t workspaceSize = 0;
+    size_t workspaceLowerBound = 0;
+
+    // The part of the workspace leased from MKLDNNWorkspacePool if the shared workspace is enabled:
+    // the base it is currently bound to and the memory objects pointing into it with their offsets
+    size_t sharedWorkspaceSize = 0;
+    void* sharedWorkspaceBase = nullptr;
+    std::vector<std::pair<mkldnn::memory, size_t>> sharedWorkspaceMemory;
 
     std::map<std::string, MKLDNNNodePtr> inputNodes;
     std::vector<MKLDNNNodePtr> outputNodes;
@@ -191,8 +246,18 @@ protected:
     std::map<std::string, MeanImage> _meanImages;
     std::string _name;
 
+    // Nodes split into groups without data dependencies inside a group. Groups are executed
+    // one after another, nodes of the same group are executed concurrently.
+    // Empty if inter-op parallel execution is disabled or not applicable for the graph.
+    std::vector<std::vector<MKLDNNNodePtr>> parallelExecGroups;
+
     static mkldnn::engine eng;
 
+    // Streams are created by the first Infer call and reused by the next ones. Nodes of a parallel
+    // group are executed on their own streams, one per position in the group.
+    mkldnn::stream inferStream;
+    std::vector<mkldnn::stream> groupStreams;
+
     void Replicate(const InferenceEngine::CNNNetwork &network, const MKLDNNExtensionManager::Ptr& extMgr);
     void Replicate(const InferenceEngine::TensorIterator::Body &subgraph, const MKLDNNExtensionManager::Ptr& extMgr);
     void InitGraph();
@@ -200,10 +265,14 @@ protected:
     void InitDescriptors();
     void InitOptimalPrimitiveDescriptors();
     void InitEdges();
+    void InitParallelExecGroups();
     void Allocate();
     void AllocateWithReuse();
+    void CollectSharedWorkspaceMemory();
     void CreatePrimitives();
     void ExecuteConstantNodesOnly();
+    void ExecuteNode(const MKLDNNNodePtr& node, mkldnn::stream& stream, int batch);
+    void PullOutputData(const MKLDNNNodePtr &node, InferenceEngine::Blob::Ptr &out);
     void SetOriginalLayerNames();
 
     void do_before(const std::string &dir, const MKLDNNNodePtr &node);
@@ -7,9 +7,9 @@
 #include <vector>
 #include <string>
 #include <map>
+#include <set>
+#include <utility>
 #include <blob_factory.hpp>
-#include <nodes/mkldnn_concat_node.h>
-#include <nodes/mkldnn_split_node.h>
 #include <ie_compound_blob.h>
 #include <ie_common.h>
 #include "mkldnn_exec_network.h"
@@ -17,9 +17,27 @@
 #include "nodes/common/cpu_convert.h"
 #include "mkldnn_memory_state.h"
 #include "nodes/mkldnn_memory_node.hpp"
-#include "nodes/common/cpu_memcpy.h"
 #include "mkldnn_async_infer_request.h"
 
+namespace {
+// The reason of a copy for a compatible blob which can't be bound because its memory is used in-place by
+// other nodes, see changeDefaultPtr()
+const char inPlaceConflict[] = "memory is shared with other nodes";
+
+inline void changeEdgePtr(const MKLDNNPlugin::MKLDNNEdgePtr &edge, void *newPtr) {
+    edge->getMemory().GetPrimitivePtr()->set_data_handle(newPtr);
+}
+
+// Variable state name is the memory node id without the pair ID suffix, which is internal information
+std::string stateName(MKLDNNPlugin::MKLDNNMemoryInputNode& node) {
+    auto name = node.getId();
+    auto suffix_idx = name.find("/id=");
+    if (suffix_idx != std::string::npos)
+        name = name.substr(0, suffix_idx);
+    return name;
+}
+}  // namespace
+
 MKLDNNPlugin::MKLDNNInferRequest::MKLDNNInferRequest(InferenceEngine::InputsDataMap     networkInputs,
                                                      InferenceEngine::OutputsDataMap    networkOutputs,
                                                      MKLDNNExecNetwork::Ptr             execNetwork_)
@@ -31,6 +49,7 @@ MKLDNNPlugin::MKLDNNInferRequest::MKLDNNInferRequest(InferenceEngine::InputsData
     if (execNetwork->_graphs.size() == 0)
         IE_THROW() << "No graph was found";
     graph = &(execNetwork->GetGraph()._graph);
+    resolveGraphPorts();
     for (const auto& it : _networkInputs) {
         MKLDNNInferRequest::GetBlob(it.first);
     }
@@ -47,15 +66,7 @@ MKLDNNPlugin::MKLDNNInferRequest::MKLDNNInferRequest(InferenceEngine::InputsData
         for (auto &node : graph->GetNodes()) {
             if (node->getType() == MemoryInput) {
                 auto memoryNode = dynamic_cast<MKLDNNMemoryInputNode*>(node.get());
-                auto state_store = memoryNode->getStore();
-                auto state_name = memoryNode->getId();
-
-                // Remove suffix with pair ID. Internal information.
-                auto suffix_idx = state_name.find("/id=");
-                if (suffix_idx != std::string::npos)
-                    state_name = state_name.substr(0, suffix_idx);
-
-                memoryStates.emplace_back(new MKLDNNVariableState(state_name, state_store));
+                memoryStates.emplace_back(new MKLDNNVariableState(stateName(*memoryNode), memoryNode->getStore()));
            }
         }
     } else {
@@ -68,6 +79,19 @@ MKLDNNPlugin::MKLDNNInferRequest::~MKLDNNInferRequest() {
     --(execNetwork->_numRequests);
 }
 
+template <typename Transfer>
+void MKLDNNPlugin::MKLDNNInferRequest::transferData(const std::string& name, const void* blobData, bool isInput,
+                                                    const Transfer& transfer) {
+    if (blobData == graphMemory(name, isInput).GetData()) {
+        transfer();
+        return;
+    }
+    auto& copy = blobCopies[name];
+    copy.executed = true;
+    PerfHelper helper(copy.counter);
+    transfer();
+}
+
 void MKLDNNPlugin::MKLDNNInferRequest::pushInput(const std::string& inputName, InferenceEngine::Blob::Ptr& inputBlob, InferenceEngine::Precision inPrec) {
     bool needConvert = inPrec != inputBlob->getTensorDesc().getPrecision();
 
@@ -100,6 +124,19 @@ void MKLDNNPlugin::MKLDNNInferRequest::PushInputData() {
         if (!_networkInputs[input.first]) {
             IE_THROW() << "Input blobs map contains not registered during IInferencePlugin::LoadNetwork blob with name " << input.first;
         }
+
+        auto fused = fusedInputs.find(input.first);
+        if (fused != fusedInputs.end()) {
+            // the pre-processing has already subtracted the mean and converted the data to FP32
+            if (fused->second->cbuffer().as<const void*>() != graphMemory(input.first, true).GetData()) {
+                auto& copy = blobCopies[input.first];
+                copy.executed = true;
+                PerfHelper helper(copy.counter);
+                graph->PushInputData(input.first, fused->second, false);
+            }
+            continue;
+        }
+
         auto inPrec = input.second->getTensorDesc().getPrecision();
 
         switch (inPrec) {
@@ -136,45 +173,207 @@ void MKLDNNPlugin::MKLDNNInferRequest::PushInputData() {
             input.second->getTensorDesc().setLayout(_networkInputs[input.first]->getLayout());
         }
 
-        pushInput(input.first, input.second, inPrec);
+        transferData(input.first, input.second->cbuffer().as<const void*>(), true, [&] {
+            pushInput(input.first, input.second, inPrec);
+        });
     }
 }
 
-void MKLDNNPlugin::MKLDNNInferRequest::PushStates() {
+void MKLDNNPlugin::MKLDNNInferRequest::PullOutputData() {
+    for (auto& output : _outputs) {
+        transferData(output.first, output.second->buffer().as<const void*>(), false, [&] {
+            graph->PullOutputData(output.first, output.second);
+        });
+    }
+}
+
+void MKLDNNPlugin::MKLDNNInferRequest::resolveGraphPorts() {
+    auto found = graphPorts.find(graph);
+    if (found == graphPorts.end()) {
+        GraphPorts resolved;
+        for (const auto& input : graph->inputNodes)
+            resolved.inputs[input.first] = {input.second, &input.second->getChildEdgeAt(0)->getMemory()};
+        // output nodes are named after the network outputs with the "out_" prefix
+        for (const auto& output : graph->outputNodes)
+            resolved.outputs[output->getName().substr(4)] = {output, &output->getParentEdgeAt(0)->getMemory()};
+        found = graphPorts.emplace(graph, std::move(resolved)).first;
+    }
+    ports = &found->second;
+}
+
+const MKLDNNPlugin::MKLDNNMemory& MKLDNNPlugin::MKLDNNInferRequest::graphMemory(const std::string& name, bool isInput) const {
+    if (isInput) {
+        auto input = ports->inputs.find(name);
+        if (input == ports->inputs.end())
+            IE_THROW() << "Input blob for infer '" << name << "' doesn't correspond to input in network";
+        return *input->second.memory;
+    }
+    auto output = ports->outputs.find(name);
+    if (output == ports->outputs.end())
+        IE_THROW() << "Cannot find output blob: " << name;
+    return *output->second.memory;
+}
+
+std::string MKLDNNPlugin::MKLDNNInferRequest::bindingConflict(const std::string& name, const InferenceEngine::TensorDesc& desc,
+                                                              bool isInput) const {
+    if (isInput && graph->hasMeanImageFor(name))
+        return "mean image";
+    return memoryConflict(name, desc, isInput);
+}
+
+std::string MKLDNNPlugin::MKLDNNInferRequest::memoryConflict(const std::string& name, const InferenceEngine::TensorDesc& desc,
+                                                             bool isInput) const {
+    if (graph->getProperty().batchLimit)
+        return "dynamic batch";
+
+    const InferenceEngine::TensorDesc memoryDesc = graphMemory(name, isInput).GetDesc();
+    if (desc.getPrecision() != memoryDesc.getPrecision()) {
+        return std::string("precision conversion ") + (isInput ? desc : memoryDesc).getPrecision().name() + " -> " +
+               (isInput ? memoryDesc : desc).getPrecision().name();
+    }
+    if (desc.getLayout() != InferenceEngine::Layout::ANY && desc.getBlockingDesc() != memoryDesc.getBlockingDesc())
+        return "layout conversion";
+    return {};
+}
+
+void MKLDNNPlugin::MKLDNNInferRequest::bindBlob(const std::string& name, const InferenceEngine::Blob::Ptr& blob, bool isInput) {
+    auto& copy = blobCopies[name];
+    copy.reason = bindingConflict(name, blob->getTensorDesc(), isInput);
+    if (copy.reason.empty())
+        externalPtr[name] = blob->buffer();
+    else
+        externalPtr.erase(name);
+}
+
+InferenceEngine::BlobMap MKLDNNPlugin::MKLDNNInferRequest::preprocessingTargets() {
+    InferenceEngine::BlobMap targets = _inputs;
+    const bool fusionEnabled = graph->getProperty().fusedPreprocessing;
+    for (auto& preProcData : _preProcData) {
+        const auto& name = preProcData.first;
+        const auto& inputDesc = _networkInputs[name]->getTensorDesc();
+        const auto layout = inputDesc.getLayout();
+        const auto& mean = graph->getMeanValuesFor(name);
+        // Without mean values the pass still takes over the conversion to an FP32 graph input, the normalization
+        // with zero mean and unit scale is a plain conversion. Mean images aren't supported by G-API.
+        const bool convertOnly = mean.empty() && !graph->hasMeanImageFor(name) &&
+                                 inputDesc.getPrecision() != InferenceEngine::Precision::FP32 &&
+                                 graphMemory(name, true).GetDataType() == mkldnn::memory::data_type::f32;
+        // G-API produces planar or interleaved data only, blocked layouts are made by the graph reorders
+        if (!fusionEnabled || (mean.empty() && !convertOnly) ||
+            (layout != InferenceEngine::NCHW && layout != InferenceEngine::NHWC)) {
+            if (fusedInputs.erase(name))
+                bindBlob(name, _inputs[name], true);
+            preProcData.second->setNormalization({}, {});
+            continue;
+        }
+
+        const InferenceEngine::TensorDesc desc(InferenceEngine::Precision::FP32, inputDesc.getDims(), layout);
+        auto& fused = fusedInputs[name];
+        auto& reason = blobCopies[name].reason;
+        if (!fused)
+            reason = memoryConflict(name, desc, true);
+        if (reason.empty()) {
+            // the graph memory may be moved by the workspace lease, so the blob is rebound when needed
+            auto data = static_cast<float*>(graphMemory(name, true).GetData());
+            if (!fused || fused->buffer().as<float*>() != data)
+                fused = InferenceEngine::make_shared_blob<float>(desc, data);
+        } else if (!fused) {
+            fused = InferenceEngine::make_shared_blob<float>(desc);
+            fused->allocate();
+        }
+        if (convertOnly)
+            preProcData.second->setNormalization(std::vector<float>(inputDesc.getDims()[1], 0.0f), {});
+        else
+            preProcData.second->setNormalization(mean, graph->getScaleValuesFor(name));
+        targets[name] = fused;
+    }
+    return targets;
+}
+
+std::vector<MKLDNNPlugin::MKLDNNInferRequest::StateBinding>& MKLDNNPlugin::MKLDNNInferRequest::getStateBindings() {
+    auto found = stateBindings.find(graph);
+    if (found != stateBindings.end())
+        return found->second;
+
+    std::map<std::string, MKLDNNNodePtr> memoryOutputs;
     for (auto &node : graph->GetNodes()) {
-        if (node->getType() == MemoryInput) {
-            auto cur_node = dynamic_cast<MKLDNNMemoryInputNode*>(node.get());
-            auto cur_id = cur_node->getId();
-            for (const auto& state : memoryStates) {
-                if (state->GetName() == cur_id) {
-                    auto cur_state_mem = cur_node->getStore();
-                    auto data_ptr = state->GetState()->cbuffer().as<void*>();
-                    auto data_size = state->GetState()->byteSize();
-                    auto cur_state_mem_buf = static_cast<uint8_t*>(cur_state_mem->GetPtr());
-
-                    cpu_memcpy(cur_state_mem_buf, data_ptr, data_size);
-                }
+        if (node->getType() == MemoryOutput) {
+            memoryOutputs[dynamic_cast<MKLDNNMemoryOutputNode*>(node.get())->getId()] = node;
+        }
+    }
+
+    auto& bindings = stateBindings[graph];
+    std::set<InferenceEngine::IVariableStateInternal*> boundStates;
+    for (auto &node : graph->GetNodes()) {
+        if (node->getType() != MemoryInput)
+            continue;
+        auto memoryNode = std::dynamic_pointer_cast<MKLDNNMemoryInputNode>(node);
+        const auto name = stateName(*memoryNode);
+        for (const auto& state : memoryStates) {
+            if (state->GetName() != name || !boundStates.insert(state.get()).second)
+                continue;
+            StateBinding binding;
+            binding.state = std::dynamic_pointer_cast<MKLDNNVariableState>(state);
+            binding.input = memoryNode;
+            if (binding.state == nullptr)
+                IE_THROW() << "Unexpected implementation of the variable state " << name;
+
+            if (MKLDNNGraph::CanChangeInputMemory(node)) {
+                for (size_t i = 0; i < node->getChildEdges().size(); i++)
+                    binding.currentEdges.push_back(node->getChildEdgeAt(i));
             }
+            auto output = memoryOutputs.find(memoryNode->getId());
+            if (output != memoryOutputs.end() && MKLDNNGraph::CanChangeOutputMemory(output->second))
+                binding.nextEdges.push_back(output->second->getParentEdgeAt(0));
+            bindings.push_back(binding);
+            break;
+        }
+    }
+    return bindings;
+}
+
+void MKLDNNPlugin::MKLDNNInferRequest::PushStates() {
+    for (auto& binding : getStateBindings()) {
+        auto current = binding.state->GetState();
+        auto next = binding.state->GetNextState();
+        if (current->byteSize() != binding.input->getStore()->GetSize() || next->byteSize() != current->byteSize())
+            IE_THROW() << "Variable state " << binding.state->GetName() << " has unexpected size " << current->byteSize();
+
+        auto currentPtr = current->cbuffer().as<void*>();
+        auto nextPtr = next->buffer().as<void*>();
+        binding.input->bindState(currentPtr, nextPtr);
+        binding.graphData.clear();
+        for (const auto& edge : binding.currentEdges) {
+            binding.graphData.push_back(edge->getMemory().GetPrimitive().get_data_handle());
+            changeEdgePtr(edge, currentPtr);
+        }
+        for (const auto& edge : binding.nextEdges) {
+            binding.graphData.push_back(edge->getMemory().GetPrimitive().get_data_handle());
+            changeEdgePtr(edge, nextPtr);
         }
     }
 }
 
 void MKLDNNPlugin::MKLDNNInferRequest::PullStates() {
-    for (auto &node : graph->GetNodes()) {
-        if (node->getType() == MemoryInput) {
-            auto cur_node = dynamic_cast<MKLDNNMemoryInputNode*>(node.get());
-            auto cur_id = cur_node->getId();
-            for (const auto& state : memoryStates) {
-                if (state->GetName() == cur_id) {
-                    auto cur_state_mem = cur_node->getStore();
-                    auto data_ptr = state->GetState()->cbuffer().as<void*>();
-                    auto data_size = state->GetState()->byteSize();
-                    auto cur_state_mem_buf = static_cast<uint8_t*>(cur_state_mem->GetPtr());
-
-                    cpu_memcpy(data_ptr, cur_state_mem_buf, data_size);
-                }
-            }
+    for (const auto& binding : getStateBindings()) {
+        binding.state->SwapBuffers();
+    }
+    ReleaseStates();
+}
+
+void MKLDNNPlugin::MKLDNNInferRequest::ReleaseStates() {
+    for (auto& binding : getStateBindings()) {
+        binding.input->unbindState();
+        auto data = binding.graphData.begin();
+        for (const auto& edge : binding.currentEdges) {
+            if (data != binding.graphData.end())
+                changeEdgePtr(edge, *data++);
+        }
+        for (const auto& edge : binding.nextEdges) {
+            if (data != binding.graphData.end())
+                changeEdgePtr(edge, *data++);
         }
+        binding.graphData.clear();
     }
 }
 
@@ -184,30 +383,39 @@ void MKLDNNPlugin::MKLDNNInferRequest::InferImpl() {
     OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, profilingTask);
     auto graphLock = execNetwork->GetGraph();
     graph = &(graphLock._graph);
+    resolveGraphPorts();
 
     ThrowIfCanceled();
 
-    execDataPreprocessing(_inputs);
+    // Is held until the outputs are pulled, as they may be placed to the shared workspace as well
+    auto workspaceLease = graph->LeaseWorkspace();
 
     changeDefaultPtr();
 
+    // Is done after the lease, as the fused pre-processing may write to the graph memory directly
+    auto preprocessed = preprocessingTargets();
+    execDataPreprocessing(preprocessed);
+
     ThrowIfCanceled();
 
     PushInputData();
 
     if (memoryStates.size() != 0) {
-        PushStates();
-    }
-
-    graph->Infer(this, m_curBatch);
-
-    if (memoryStates.size() != 0) {
+        try {
+            PushStates();
+            graph->Infer(this, m_curBatch);
+        } catch (...) {
+            ReleaseStates();
+            throw;
+        }
         PullStates();
+    } else {
+        graph->Infer(this, m_curBatch);
     }
 
     ThrowIfCanceled();
 
-    graph->PullOutputData(_outputs);
+    PullOutputData();
 }
 
 std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> MKLDNNPlugin::MKLDNNInferRequest::GetPerformanceCounts() const {
@@ -215,6 +423,18 @@ std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> MKLDNNPlugin:
         IE_THROW() << "Graph is not ready!";
     std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> perfMap;
     graph->GetPerfData(perfMap);
+    for (const auto& copy : blobCopies) {
+        if (!copy.second.executed)
+            continue;
+        InferenceEngine::InferenceEngineProfileInfo &pc = perfMap[copy.first + "_copy"];
+        pc.execution_index = static_cast<unsigned>(perfMap.size() - 1);
+        PerfCount counter = copy.second.counter;
+        pc.cpu_uSec = pc.realTime_uSec = (long long) counter.avg();
+        pc.status = InferenceEngine::InferenceEngineProfileInfo::EXECUTED;
+        const std::string& reason = copy.second.reason.empty() ? inPlaceConflict : copy.second.reason;
+        reason.copy(pc.exec_type, sizeof(pc.exec_type) - 1, 0);
+        std::string("Copy").copy(pc.layer_type, sizeof(pc.layer_type) - 1, 0);
+    }
     return perfMap;
 }
 
@@ -244,7 +464,6 @@ InferenceEngine::Blob::Ptr MKLDNNPlugin::MKLDNNInferRequest::GetBlob(const std::
         }
 
         InferenceEngine::TensorDesc desc = blobs[name]->getTensorDesc();
-        InferenceEngine::Precision originPrecision = blobs[name]->getTensorDesc().getPrecision();
         if (_networkInputs.find(name) != _networkInputs.end()) {
             InferenceEngine::Layout l = _networkInputs[name]->getLayout();
             InferenceEngine::Precision p = _networkInputs[name]->getPrecision();
@@ -255,10 +474,7 @@ InferenceEngine::Blob::Ptr MKLDNNPlugin::MKLDNNInferRequest::GetBlob(const std::
 
         _inputs[name] = make_blob_with_precision(desc);
         _inputs[name]->allocate();
-        if (desc.getPrecision() == originPrecision &&
-                graph->_meanImages.find(name) == graph->_meanImages.end() && !graph->getProperty().batchLimit) {
-            externalPtr[name] = _inputs[name]->buffer();
-        }
+        bindBlob(name, _inputs[name], true);
         data = _inputs[name];
         checkBlob(data, name, true);
         return data;
@@ -283,9 +499,7 @@ InferenceEngine::Blob::Ptr MKLDNNPlugin::MKLDNNInferRequest::GetBlob(const std::
 
         _outputs[name] = make_blob_with_precision(desc);
         _outputs[name]->allocate();
-        if (desc.getPrecision() == InferenceEngine::Precision::FP32 && !graph->getProperty().batchLimit) {
-            externalPtr[name] = _outputs[name]->buffer();
-        }
+        bindBlob(name, _outputs[name], false);
         data = _outputs[name];
         checkBlob(data, name, false);
         return data;
@@ -349,12 +563,7 @@ void MKLDNNPlugin::MKLDNNInferRequest::SetBlob(const std::string& name, const In
                 IE_THROW(ParameterMismatch) << "Failed to set input blob. Blocking descriptor mismatch.";
             }
 
-            if (data->getTensorDesc().getPrecision() == InferenceEngine::Precision::FP32 &&
-                graph->_meanImages.find(name) == graph->_meanImages.end() && !graph->getProperty().batchLimit) {
-                externalPtr[name] = data->buffer();
-            } else if (externalPtr.find(name) != externalPtr.end()) {
-                externalPtr.erase(name);
-            }
+            bindBlob(name, data, true);
             _inputs[name] = data;
         }
     } else {
@@ -380,86 +589,33 @@ void MKLDNNPlugin::MKLDNNInferRequest::SetBlob(const std::string& name, const In
             foundOutput->getTensorDesc().getBlockingDesc() != data->getTensorDesc().getBlockingDesc()) {
                 IE_THROW(ParameterMismatch) << "Failed to set output blob. Blocking descriptor mismatch.";
         }
-        if (data->getTensorDesc().getPrecision() == InferenceEngine::Precision::FP32 &&
-                !graph->getProperty().batchLimit) {
-            externalPtr[name] = data->buffer();
-        } else if (externalPtr.find(name) != externalPtr.end()) {
-            externalPtr.erase(name);
-        }
+        bindBlob(name, data, false);
         _outputs[name] = data;
     }
 }
 
-static inline void changeEdgePtr(const MKLDNNPlugin::MKLDNNEdgePtr &edge, void *newPtr) {
-    edge->getMemory().GetPrimitivePtr()->set_data_handle(newPtr);
-}
-
 void MKLDNNPlugin::MKLDNNInferRequest::changeDefaultPtr() {
     for (auto& it : externalPtr) {
-        auto input = graph->inputNodes.find(it.first);
-        if (input != graph->inputNodes.end()) {
-            if (input->second->getChildEdgeAt(0)->getMemory().GetPrimitive().get_data_handle() == it.second)
+        auto input = ports->inputs.find(it.first);
+        if (input != ports->inputs.end()) {
+            if (input->second.memory->GetPrimitive().get_data_handle() == it.second)
                 continue;
-            // Input cannot be in-place with other primitives
-            bool canBeInPlace = true;
-            for (size_t i = 0; canBeInPlace && i < input->second->getChildEdges().size(); i++) {
-                auto& child = input->second->getChildEdgeAt(i)->getChild();
-                if (child->isConstant())
-                    canBeInPlace = false;
-                auto* concat = dynamic_cast<MKLDNNConcatNode *>(child.get());
-                if (canBeInPlace && concat && concat->isOptimized())
-                    canBeInPlace = false;
-
-                // Cannot be in-place before split because split is using different ptrs without offsets
-                auto* split = dynamic_cast<MKLDNNSplitNode *>(child.get());
-                if (canBeInPlace && split)
-                    canBeInPlace = false;
-
-                if (child->isInplace())
-                    canBeInPlace = false;
-                for (size_t j = 0; canBeInPlace && j < child->getChildEdges().size(); j++) {
-                    if (child->getChildEdgeAt(j)->getMemory().GetPrimitive().get_data_handle() ==
-                            input->second->getChildEdgeAt(i)->getMemory().GetPrimitive().get_data_handle())
-                        canBeInPlace = false;
+            const auto& node = input->second.node;
+            if (MKLDNNGraph::CanChangeInputMemory(node)) {
+                for (size_t i = 0; i < node->getChildEdges().size(); i++) {
+                    changeEdgePtr(node->getChildEdgeAt(i), it.second);
                 }
             }
-            for (size_t i = 0; canBeInPlace && i < input->second->getChildEdges().size(); i++) {
-                changeEdgePtr(input->second->getChildEdgeAt(i), it.second);
-            }
             continue;
         }
 
-        MKLDNNNodePtr output;
-        for (auto& out : graph->outputNodes) {
-            if (out->getName() == "out_" + it.first) {
-                output = out;
-                break;
-            }
-        }
-        if (output) {
-            if (output->getParentEdgeAt(0)->getMemory().GetPrimitive().get_data_handle() == it.second)
+        auto output = ports->outputs.find(it.first);
+        if (output != ports->outputs.end()) {
+            if (output->second.memory->GetPrimitive().get_data_handle() == it.second)
                 continue;
-            bool canBeInPlace = true;
-            void * defaultPtr = output->getParentEdgeAt(0)->getMemory().GetPrimitivePtr()->get_data_handle();
-            // Cannot be in-place after concat because concat is using different ptrs without offsets
-            auto parent = output->getParentEdgeAt(0)->getParent();
-            MKLDNNNodePtr previousParent;
-            do {
-                previousParent = parent;
-                if (parent->getChildEdges().size() != 1 || parent->isConstant() || parent->isInplace()) {
-                    canBeInPlace = false;
-                    break;
-                }
-
-                for (size_t i = 0; i < parent->getParentEdges().size(); i++) {
-                    if (parent->getParentEdgeAt(i)->getMemory().GetPrimitivePtr()->get_data_handle() == defaultPtr) {
-                        parent = parent->getParentEdgeAt(i)->getParent();
-                        break;
-                    }
-                }
-            } while (previousParent != parent);
-            if (canBeInPlace)
-                changeEdgePtr(output->getParentEdgeAt(0), it.second);
+            const auto& node = output->second.node;
+            if (MKLDNNGraph::CanChangeOutputMemory(node))
+                changeEdgePtr(node->getParentEdgeAt(0), it.second);
             continue;
         }
         IE_THROW() << "Cannot find input/output blob: " << it.first;
@@ -5,6 +5,7 @@
 #pragma once
 
 #include "mkldnn_graph.h"
+#include "perf_count.h"
 #include <memory>
 #include <string>
 #include <map>
@@ -14,6 +15,8 @@ namespace MKLDNNPlugin {
 
 class MKLDNNExecNetwork;
 class MKLDNNAsyncInferRequest;
+class MKLDNNVariableState;
+class MKLDNNMemoryInputNode;
 
 class MKLDNNInferRequest : public InferenceEngine::InferRequestInternal {
 public:
@@ -49,17 +52,111 @@ public:
 
 private:
     void PushInputData();
+    void PullOutputData();
     void PushStates();
     void PullStates();
+    void ReleaseStates();
 
     void pushInput(const std::string& inputName, InferenceEngine::Blob::Ptr& inputBlob, InferenceEngine::Precision dataType);
 
     void changeDefaultPtr();
+
+    /**
+     * @brief Network input or output node of a graph and the memory of its edge which holds the data
+     */
+    struct GraphPort {
+        MKLDNNNodePtr node;
+        const MKLDNNMemory* memory;
+    };
+
+    struct GraphPorts {
+        std::map<std::string, GraphPort> inputs;
+        std::map<std::string, GraphPort> outputs;
+    };
+
+    /**
+     * @brief Makes the ports of the current graph used by the request, they are resolved by names once per graph
+     */
+    void resolveGraphPorts();
+
+    /**
+     * @brief Returns the graph memory which holds data of the given network input or output
+     */
+    const MKLDNNMemory& graphMemory(const std::string& name, bool isInput) const;
+
+    /**
+     * @brief Moves data between the blob and the graph memory, which is measured as the blob copy
+     * if the blob isn't bound as the graph memory
+     */
+    template <typename Transfer>
+    void transferData(const std::string& name, const void* blobData, bool isInput, const Transfer& transfer);
+
+    /**
+     * @brief Checks whether a user blob with the given descriptor can be bound as the graph memory
+     * @return Empty string if the blob can be bound, otherwise the reason why its data has to be copied
+     */
+    std::string bindingConflict(const std::string& name, const InferenceEngine::TensorDesc& desc, bool isInput) const;
+
+    /**
+     * @brief Same as bindingConflict() but only checks the graph memory, so a mean image doesn't prevent binding
+     */
+    std::string memoryConflict(const std::string& name, const InferenceEngine::TensorDesc& desc, bool isInput) const;
+
+    /**
+     * @brief Binds the user blob as the graph memory if possible, otherwise records in blobCopies why its data is copied
+     */
+    void bindBlob(const std::string& name, const InferenceEngine::Blob::Ptr& blob, bool isInput);
+
+    /**
+     * @brief Returns blobs the inputs are pre-processed to. Inputs with mean values or an FP32 graph input of
+     * another precision are pre-processed by a single G-API pass which also normalizes and converts data to FP32,
+     * writing straight to the graph memory where it's possible, see fusedInputs.
+     */
+    InferenceEngine::BlobMap preprocessingTargets();
+
+    /**
+     * @brief Data copy between a user blob and the graph memory which is done instead of binding the blob.
+     * Reported in the performance counters as "<blob name>_copy" with the reason as the execution type.
+     */
+    struct BlobCopy {
+        PerfCount counter;
+        // computed when the blob is set, empty if the blob is bound but the memory is used in-place by other nodes
+        std::string reason;
+        bool executed = false;
+    };
+
+    /**
+     * @brief Variable state bound to the memory nodes of a graph. The state buffers are given to the nodes
+     * before inference and, where the edges aren't shared in-place, become the edge memory, so the nodes
+     * don't copy the state at all.
+     */
+    struct StateBinding {
+        std::shared_ptr<MKLDNNVariableState> state;
+        std::shared_ptr<MKLDNNMemoryInputNode> input;
+        // edges whose memory is replaced with the current and the next state buffers respectively
+        std::vector<MKLDNNEdgePtr> currentEdges;
+        std::vector<MKLDNNEdgePtr> nextEdges;
+        // graph memory of currentEdges and nextEdges, which is restored when the state buffers are released
+        std::vector<void*> graphData;
+    };
+
+    /**
+     * @brief Returns the state bindings for the current graph, they are built on the first inference with the graph
+     */
+    std::vector<StateBinding>& getStateBindings();
+
     std::shared_ptr<MKLDNNExecNetwork>  execNetwork;
     MKLDNNGraph*                        graph = nullptr;
+    std::map<const MKLDNNGraph*, GraphPorts> graphPorts;
+    // ports of the current graph
+    const GraphPorts*                   ports = nullptr;
     std::map<std::string, void*>        externalPtr;
+    std::map<std::string, BlobCopy>     blobCopies;
+    // FP32 blobs the inputs with fused normalization are pre-processed to, wrap the graph memory if possible
+    InferenceEngine::BlobMap            fusedInputs;
     openvino::itt::handle_t             profilingTask;
     std::vector<InferenceEngine::IVariableStateInternal::Ptr> memoryStates;
+    std::map<const MKLDNNGraph*, std::vector<StateBinding>> stateBindings;
     MKLDNNAsyncInferRequest*            _asyncRequest = nullptr;
 };
 }  // namespace MKLDNNPlugin
@@ -15,6 +15,7 @@
 #include <mkldnn_types.h>
 #include <dnnl_types.h>
 #include "mkldnn_memory.h"
+#include "mkldnn_reorder_cache.hpp"
 #include "mkldnn_extension_utils.h"
 #include "nodes/common/cpu_memcpy.h"
 #include "nodes/common/cpu_convert.h"
@@ -33,6 +34,30 @@ namespace {
             }
         }
     }
+
+    // Per thread state of MKLDNNMemory::reorderData, which lets the steady state reorders run without
+    // creating streams and allocating buffers
+    struct ReorderContext {
+        // owning handle, so another engine can't get the address of a released one
+        mkldnn::engine engine;
+        mkldnn::stream stream;
+        // scratch arena for the source converted by cpu_convert, grows up to maxScratchSize
+        std::vector<uint8_t> scratch;
+        mkldnn::memory converted;
+    };
+
+    // Larger converted tensors get a buffer of their own, so every thread doesn't keep the largest one
+    constexpr size_t maxScratchSize = 16 * 1024 * 1024;
+
+    ReorderContext& getReorderContext(const mkldnn::engine& eng) {
+        thread_local ReorderContext context;
+        if (context.engine.get(true) != eng.get()) {
+            context.engine = eng;
+            context.stream = mkldnn::stream(eng, stream::flags::default_order);
+            context.converted = mkldnn::memory();
+        }
+        return context;
+    }
 }   // namespace
 
 MKLDNNMemory::MKLDNNMemory(const mkldnn::engine& eng) : eng(eng) {}
@@ -99,38 +124,33 @@ void MKLDNNMemory::reorderData(const MKLDNNMemory &input, const MKLDNNMemory &ou
         auto copySize = size == 0 ? output.GetSize() : size;
         cpu_memcpy(dstPtr, srcPtr, copySize);
     } else {
-        std::unique_ptr<mkldnn::reorder> pReorder;
-        std::shared_ptr<memory> srcMemoryPtr;
-        std::vector<uint8_t> tmpBuff;
-
-        try {
-            pReorder = std::unique_ptr<mkldnn::reorder>(new mkldnn::reorder(input.GetPrimitive(), output.GetPrimitive()));
-            srcMemoryPtr = input.prim;
-        }
-        catch (const mkldnn::error& err) {
-            if (mkldnn_unimplemented == err.status && output.GetDataType() != input.GetDataType()) {
-                //we probably could not make the reorder because there is no one supporting this precision conversion
-                //lets try to convert data first using cpu_convert
-                auto data = static_cast<const uint8_t *>(input.GetPtr());
-                tmpBuff.resize(input.GetSize());
-
-                cpu_convert(data, tmpBuff.data(), MKLDNNExtensionUtils::DataTypeToIEPrecision(input.GetDataType()),
-                            MKLDNNExtensionUtils::DataTypeToIEPrecision(output.GetDataType()), input.GetElementsCount());
-
-                MKLDNNMemory tmpMem(output.eng);
-                tmpMem.Create(input.GetDims(), output.GetDataType(), input.GetDesc().getFormat(), tmpBuff.data());
-
-                pReorder = std::unique_ptr<mkldnn::reorder>(new mkldnn::reorder(tmpMem.GetPrimitive(), output.GetPrimitive()));
-                srcMemoryPtr = tmpMem.prim;
+        auto cached = MKLDNNReorderCache::GetInstance().get(input.GetDescriptor(), output.GetDescriptor(), output.eng);
+        auto& context = getReorderContext(output.eng);
+
+        if (cached.convertSource) {
+            auto data = static_cast<const uint8_t *>(input.GetPtr());
+            const size_t convertedSize = cached.convertedSource.get_size();
+            std::vector<uint8_t> ownBuffer;
+            uint8_t* convertedData;
+            if (convertedSize <= maxScratchSize) {
+                if (context.scratch.size() < convertedSize)
+                    context.scratch.resize(convertedSize);
+                convertedData = context.scratch.data();
             } else {
-                throw;
+                ownBuffer.resize(convertedSize);
+                convertedData = ownBuffer.data();
             }
-        }
-        if (pReorder) {
-            mkldnn::stream loc_stream(output.eng, stream::flags::default_order);
-            pReorder->execute(loc_stream, *srcMemoryPtr, *output.prim);
+
+            cpu_convert(data, convertedData, MKLDNNExtensionUtils::DataTypeToIEPrecision(input.GetDataType()),
+                        MKLDNNExtensionUtils::DataTypeToIEPrecision(output.GetDataType()), input.GetElementsCount());
+
+            if (!context.converted || context.converted.get_desc() != cached.convertedSource)
+                context.converted = memory(cached.convertedSource, output.eng, convertedData);
+            else
+                context.converted.set_data_handle(convertedData);
+            cached.primitive.execute(context.stream, context.converted, *output.prim);
         } else {
-            IE_THROW() << "Could not make mkldnn reorder.";
+            cached.primitive.execute(context.stream, *input.prim, *output.prim);
         }
     }
 }
@@ -8,6 +8,7 @@
 
 
 #include <algorithm>
+#include <limits>
 #include <vector>
 #include <map>
 
@@ -22,6 +23,7 @@ MemorySolver::MemorySolver(const std::vector<Box>& boxes) : _boxes(boxes) {
     // 4. Box.id == any unique value
     for (const Box &box : _boxes) max_ts = std::max(std::max(max_ts, box.start), box.finish);
     for (Box &box : _boxes) if (box.finish == -1) box.finish = max_ts;
+    for (const Box &box : _boxes) _lifetimes[box.id] = {box.start, box.finish};
 
     // sort by start and finish ts
     std::sort(_boxes.begin(), _boxes.end(), [](const Box& l, const Box& r) -> bool
@@ -57,19 +59,72 @@ inline bool popupTogetherWith(MemorySolver::Box &box_new, const MemorySolver::Bo
     }
 }
 
-int64_t MemorySolver::solve() {
+int64_t MemorySolver::solve(Strategy strategy) {
     maxTopDepth();  // at first make sure that we no need more for boxes sorted by box.start
+
+    if (strategy == Strategy::Greedy) {
+        _offsets.clear();
+        return solveGreedy(_offsets);
+    }
+
+    auto bySize = [](const Box& l, const Box& r) {
+        return l.size > r.size || (l.size == r.size && l.finish - l.start > r.finish - r.start);
+    };
+    auto byLifetime = [](const Box& l, const Box& r) {
+        return l.finish - l.start > r.finish - r.start || (l.finish - l.start == r.finish - r.start && l.size > r.size);
+    };
+    auto byArea = [](const Box& l, const Box& r) {
+        return l.size * (l.finish - l.start + 1) > r.size * (r.finish - r.start + 1);
+    };
+    auto byStart = [](const Box& l, const Box& r) {
+        return l.start < r.start || (l.start == r.start && l.size > r.size);
+    };
+
+    std::vector<Box> ordered = _boxes;
+    std::stable_sort(ordered.begin(), ordered.end(), bySize);
+    _offsets.clear();
+    int64_t best = solveBestFit(ordered, _offsets);
+    if (strategy == Strategy::BestFit)
+        return best;
+
+    // The result of each heuristic depends on the particular boxes, so all of them are tried.
+    // The lower bound can't be improved, so the search stops as soon as it is reached.
+    auto tryCandidate = [&](int64_t size, Offsets &offsets) {
+        if (size < best) {
+            best = size;
+            _offsets.swap(offsets);
+        }
+    };
+    for (auto order : std::vector<bool (*)(const Box&, const Box&)>{byLifetime, byArea, byStart}) {
+        if (best <= maxDepth() && _in_place.empty())
+            return best;
+        ordered = _boxes;
+        std::stable_sort(ordered.begin(), ordered.end(), order);
+        Offsets offsets;
+        auto size = solveBestFit(ordered, offsets);
+        tryCandidate(size, offsets);
+    }
+    if (best > maxDepth() || !_in_place.empty()) {
+        Offsets offsets;
+        auto size = solveGreedy(offsets);
+        tryCandidate(size, offsets);
+    }
+    return best;
+}
+
+int64_t MemorySolver::solveGreedy(Offsets &offsets) const {
+    std::vector<Box> boxes = _boxes;
     std::vector<std::vector<const Box*>> time_slots(_time_duration);
     for (auto & slot : time_slots) slot.reserve(_top_depth);  // 2D array [_time_duration][_top_depth]
 
     // Sort be box size. First is biggest
     // Comment this line to check other order of box putting
-    std::sort(_boxes.begin(), _boxes.end(), [](const Box& l, const Box& r)
+    std::sort(boxes.begin(), boxes.end(), [](const Box& l, const Box& r)
         { return l.size > r.size; });
 
     int64_t _min_required = 0;
 
-    for (Box& box : _boxes) {
+    for (Box& box : boxes) {
         // start from bottom and will lift it up if intersect with other present
         int64_t id = box.id;
         box.id = 0;  // id will be used as a temp offset storage
@@ -91,12 +146,92 @@ int64_t MemorySolver::solve() {
 
         // store the max top bound for each box
         _min_required = std::max(_min_required, box.id + box.size);
-        _offsets[id] = box.id;  // TODO: move to constructor (use .insert instead of [])
+        offsets[id] = box.id;  // TODO: move to constructor (use .insert instead of [])
     }
 
     return _min_required;
 }
 
+int64_t MemorySolver::solveBestFit(const std::vector<Box> &ordered, Offsets &offsets) const {
+    struct Placed {
+        const Box* box;
+        int64_t offset;
+    };
+    std::vector<Placed> placed;
+    placed.reserve(ordered.size());
+
+    // A consumer and its producer may share the offset if one is released at the start of the other
+    auto inPlacePair = [&](const Box& a, const Box& b) {
+        auto consumer = _in_place.find(a.id);
+        if (consumer != _in_place.end() && consumer->second == b.id)
+            return b.finish == a.start;
+        consumer = _in_place.find(b.id);
+        return consumer != _in_place.end() && consumer->second == a.id && a.finish == b.start;
+    };
+
+    int64_t min_required = 0;
+    std::vector<Placed> intersected;
+    for (const Box& box : ordered) {
+        intersected.clear();
+        int64_t in_place_offset = -1;
+        for (const auto& p : placed) {
+            if (p.box->start > box.finish || box.start > p.box->finish)
+                continue;
+            if (in_place_offset < 0 && inPlacePair(box, *p.box))
+                in_place_offset = p.offset;
+            intersected.push_back(p);
+        }
+        std::sort(intersected.begin(), intersected.end(), [](const Placed& l, const Placed& r)
+            { return l.offset < r.offset; });
+
+        auto fits = [&](int64_t offset) {
+            for (const auto& p : intersected) {
+                if (p.offset == offset && inPlacePair(box, *p.box))
+                    continue;
+                if (offset < p.offset + p.box->size && p.offset < offset + box.size)
+                    return false;
+            }
+            return true;
+        };
+
+        int64_t offset = -1;
+        if (in_place_offset >= 0 && fits(in_place_offset)) {
+            offset = in_place_offset;
+        } else {
+            // the smallest gap between the intersected boxes the box fits, or the top of them
+            int64_t best_gap = std::numeric_limits<int64_t>::max();
+            int64_t top = 0;
+            for (const auto& p : intersected) {
+                auto gap = p.offset - top;
+                if (gap >= box.size && gap < best_gap) {
+                    best_gap = gap;
+                    offset = top;
+                }
+                top = std::max(top, p.offset + p.box->size);
+            }
+            if (offset < 0)
+                offset = top;
+        }
+
+        placed.push_back({&box, offset});
+        offsets[box.id] = offset;
+        min_required = std::max(min_required, offset + box.size);
+    }
+
+    return min_required;
+}
+
+void MemorySolver::allowInPlace(int64_t id, int64_t producer_id) {
+    // Removal of unused timestamps may make the producer released at the start of the consumer,
+    // so the original lifetimes are checked
+    auto consumer = _lifetimes.find(id);
+    auto producer = _lifetimes.find(producer_id);
+    if (consumer == _lifetimes.end() || producer == _lifetimes.end() ||
+        producer->second.second != consumer->second.first)
+        return;
+    _in_place[id] = producer_id;
+}
+
 int64_t MemorySolver::maxDepth() {
     if (_depth == -1) calcDepth();
     return _depth;
@@ -119,6 +254,8 @@ void MemorySolver::calcDepth() {
     int64_t top_depth = 0;
     int64_t depth = 0;
     std::map<int64_t, std::vector<const Box*>> release_at;
+    _top_depth = 0;
+    _depth = 0;
 
     for (const Box& box : _boxes) {
         int64_t time = box.start;
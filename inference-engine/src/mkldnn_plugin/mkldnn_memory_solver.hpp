@@ -65,30 +65,56 @@ public:
         int64_t id;
     };
 
+    /** @brief Algorithm of the boxes placement */
+    enum class Strategy {
+        /** Boxes are placed from the biggest one, each is lifted up over the intersecting ones */
+        Greedy,
+        /** Each box is placed into the smallest gap it fits, boxes are ordered by size */
+        BestFit,
+        /** Greedy and BestFit with several orderings of boxes are tried, the smallest result is kept */
+        Best,
+    };
+
     explicit MemorySolver(const std::vector<Box>& boxes);
 
     /**
      * @brief Solve memory location with maximal reuse.
      * @return Size of common memory blob required for storing all
      */
-    int64_t solve();
+    int64_t solve(Strategy strategy = Strategy::Greedy);
+
+    /**
+     * @brief Allows the box to be placed at the same offset as the box of its producer, which is released
+     *        at the start of the consumer one. It means the consumer is computed in-place.
+     *        Is taken into account by the BestFit strategy only.
+     */
+    void allowInPlace(int64_t id, int64_t producer_id);
 
     /** Provides calculated offset for specified box id */
     int64_t getOffset(int id) const;
 
-    /** Additional info. Max sum of box sizes required for any time stamp. */
+    /**
+     * Additional info. Max sum of box sizes required for any time stamp.
+     * It's a lower bound of the solution if no box is placed in-place.
+     */
     int64_t maxDepth();
     /** Additional info. Max num of boxes required for any time stamp. */
     int64_t maxTopDepth();
 
 private:
+    using Offsets = std::map<int64_t, int64_t>;
+
     std::vector<Box> _boxes;
-    std::map<int64_t, int64_t> _offsets;
+    std::map<int64_t, int64_t> _in_place;  // consumer id -> producer id
+    std::map<int64_t, std::pair<int, int>> _lifetimes;  // box id -> start and finish before removal of unused timestamps
+    Offsets _offsets;
     int64_t _top_depth = -1;
     int64_t _depth = -1;
     int _time_duration = -1;
 
     void calcDepth();
+    int64_t solveGreedy(Offsets &offsets) const;
+    int64_t solveBestFit(const std::vector<Box> &ordered, Offsets &offsets) const;
 };
 
 }  // namespace MKLDNNPlugin
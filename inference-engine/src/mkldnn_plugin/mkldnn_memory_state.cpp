@@ -6,6 +6,8 @@
 #include "mkldnn_extension_utils.h"
 #include "blob_factory.hpp"
 
+#include <utility>
+
 using namespace InferenceEngine;
 
 namespace MKLDNNPlugin {
@@ -19,11 +21,23 @@ void  MKLDNNVariableState::Reset() {
 }
 
 void  MKLDNNVariableState::SetState(Blob::Ptr newState) {
-    storage = newState;
+    // the buffers are bound to the graph and swapped after inference, so a user blob can't replace them
+    if (newState->byteSize() != storage->byteSize())
+        IE_THROW() << "Cannot set state " << name << ": its size is " << storage->byteSize()
+                   << " bytes, the new state has " << newState->byteSize() << " bytes";
+    cpu_memcpy(storage->buffer(), newState->cbuffer(), storage->byteSize());
 }
 
 InferenceEngine::Blob::CPtr MKLDNNVariableState::GetState() const {
     return storage;
 }
 
+InferenceEngine::Blob::Ptr MKLDNNVariableState::GetNextState() const {
+    return next;
+}
+
+void MKLDNNVariableState::SwapBuffers() {
+    std::swap(storage, next);
+}
+
 }  // namespace MKLDNNPlugin
@@ -20,6 +20,8 @@ public:
         this->storage = make_blob_with_precision(MKLDNNMemoryDesc(storage->GetDescriptor()));
         this->storage->allocate();
         cpu_memcpy(this->storage->buffer(), storage->GetData(), storage->GetSize());
+        next = make_blob_with_precision(this->storage->getTensorDesc());
+        next->allocate();
     }
 
     std::string GetName() const override;
@@ -27,9 +29,21 @@ public:
     void SetState(InferenceEngine::Blob::Ptr newState) override;
     InferenceEngine::Blob::CPtr GetState() const override;
 
+    /**
+     * Buffer the graph writes the next value of the state to during inference
+     */
+    InferenceEngine::Blob::Ptr GetNextState() const;
+
+    /**
+     * Makes the next value the current one after inference, the buffer of the previous value
+     * receives the next value of the following inference
+     */
+    void SwapBuffers();
+
 private:
     std::string name;
     InferenceEngine::Blob::Ptr storage;
+    InferenceEngine::Blob::Ptr next;
 };
 
 }  // namespace MKLDNNPlugin
\ No newline at end of file
@@ -6,12 +6,15 @@
 #include "mkldnn_plugin.h"
 #include "mkldnn_extension_mngr.h"
 #include "mkldnn_weights_cache.hpp"
+#include "mkldnn_workspace_pool.hpp"
 #include "mkldnn_itt.h"
+#include "mkldnn_serialize.h"
 
 #include <legacy/net_pass.h>
 #include <threading/ie_executor_manager.hpp>
 #include <memory>
 #include <ie_plugin_config.hpp>
+#include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
 #include <vector>
 #include <tuple>
 #include <ie_system_conf.h>
@@ -111,9 +114,26 @@ Engine::~Engine() {
     ExecutorManager::getInstance()->clear("CPUCallbackExecutor");
 }
 
-static void Transformation(CNNNetwork& clonedNetwork, const Config& conf) {
-    auto nGraphFunc = clonedNetwork.getFunction();
+using PrecisionsToConvert = std::vector<std::pair<ngraph::element::Type, ngraph::element::Type>>;
+
+static const PrecisionsToConvert& ConvertPrecisionList() {
+    static const PrecisionsToConvert convert_precision_list{
+            {ngraph::element::i64,     ngraph::element::i32},
+            {ngraph::element::u64,     ngraph::element::i32},
+            {ngraph::element::i16,     ngraph::element::i32},
+            {ngraph::element::u16,     ngraph::element::i32},
+            {ngraph::element::u32,     ngraph::element::i32},
+            {ngraph::element::f64,     ngraph::element::f32},
+            {ngraph::element::f16,     ngraph::element::f32},
+            {ngraph::element::boolean, ngraph::element::u8},
+            {ngraph::element::i4, ngraph::element::i8},
+            {ngraph::element::u4, ngraph::element::u8},
+    };
+    return convert_precision_list;
+}
 
+// Common transformations, the result consists of the operations of the public opsets
+static void TransformationUpToCPUSpecificOpSet(std::shared_ptr<ngraph::Function> nGraphFunc, const Config& conf) {
     ngraph::pass::Manager manager;
     manager.register_pass<ngraph::pass::InitNodeInfo>();
 
@@ -141,20 +161,7 @@ static void Transformation(CNNNetwork& clonedNetwork, const Config& conf) {
     manager.register_pass<ngraph::pass::GRUCellDecomposition>();
     manager.register_pass<ngraph::pass::RNNCellDecomposition>();
 
-    std::vector<std::pair<ngraph::element::Type, ngraph::element::Type>> convert_precision_list{
-            {ngraph::element::i64,     ngraph::element::i32},
-            {ngraph::element::u64,     ngraph::element::i32},
-            {ngraph::element::i16,     ngraph::element::i32},
-            {ngraph::element::u16,     ngraph::element::i32},
-            {ngraph::element::u32,     ngraph::element::i32},
-            {ngraph::element::f64,     ngraph::element::f32},
-            {ngraph::element::f16,     ngraph::element::f32},
-            {ngraph::element::boolean, ngraph::element::u8},
-            {ngraph::element::i4, ngraph::element::i8},
-            {ngraph::element::u4, ngraph::element::u8},
-    };
-
-    for (auto &precision : convert_precision_list) {
+    for (auto &precision : ConvertPrecisionList()) {
         manager.register_pass<ngraph::pass::ConvertPrecision>(precision.first, precision.second);
     }
 
@@ -322,6 +329,13 @@ static void Transformation(CNNNetwork& clonedNetwork, const Config& conf) {
 
         transformer.transform(nGraphFunc);
     }
+}
+
+// Conversion to the legacy operations and to the CNNNetwork the MKLDNN graph is built from
+static void ConvertToCPUSpecificOpset(CNNNetwork& clonedNetwork) {
+    auto nGraphFunc = clonedNetwork.getFunction();
+
+    using const_node_ptr = const std::shared_ptr<const ngraph::Node>;
 
     bool has_fake_quantize = ::ngraph::op::util::has_op_with_type<ngraph::op::FakeQuantize>(nGraphFunc);
 
@@ -369,17 +383,27 @@ static void Transformation(CNNNetwork& clonedNetwork, const Config& conf) {
 
     // WA: after conversion to CNNNetwork user precision can redefine input/output precisions
     // so we need to apply additional precision conversion but only for inputs and outputs
-    for (auto & precision : convert_precision_list) {
+    for (auto & precision : ConvertPrecisionList()) {
         NetPass::ConvertIOPrecision(clonedNetwork,
             InferenceEngine::details::convertPrecision(precision.first),
             InferenceEngine::details::convertPrecision(precision.second));
     }
 }
 
+static void Transformation(CNNNetwork& clonedNetwork, const Config& conf) {
+    TransformationUpToCPUSpecificOpSet(clonedNetwork.getFunction(), conf);
+    ConvertToCPUSpecificOpset(clonedNetwork);
+}
+
 InferenceEngine::ExecutableNetworkInternal::Ptr
 Engine::LoadExeNetworkImpl(const InferenceEngine::CNNNetwork &network, const std::map<std::string, std::string> &config) {
     OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, "Engine::LoadExeNetworkImpl");
+    return LoadExeNetwork(network, config, false);
+}
 
+InferenceEngine::ExecutableNetworkInternal::Ptr
+Engine::LoadExeNetwork(const InferenceEngine::CNNNetwork &network, const std::map<std::string, std::string> &config,
+                       bool isTransformed) {
     // verification of supported input
     InferenceEngine::InputsDataMap _networkInputs = network.getInputsInfo();
     for (const auto &ii : _networkInputs) {
@@ -411,9 +435,26 @@ Engine::LoadExeNetworkImpl(const InferenceEngine::CNNNetwork &network, const std
 
     CNNNetwork clonedNetwork = InferenceEngine::cloneNetwork(network);
 
+    // The network for the export is kept only when the model cache is going to use it.
+    // It's the network after the common transformations if it can be read back, otherwise the one passed here.
+    // Constants share data with the original ones.
+    const bool keepExportedNetwork = clonedNetwork.getFunction() && GetCore() && GetCore()->IsModelCachingEnabled();
+    CNNNetwork exportedNetwork;
+    bool isExportedTransformed = isTransformed;
+
     bool is_transformed = false;
     if (clonedNetwork.getFunction()) {
-        Transformation(clonedNetwork, conf);
+        if (keepExportedNetwork) {
+            exportedNetwork = InferenceEngine::cloneNetwork(clonedNetwork);
+        }
+        if (!isTransformed) {
+            TransformationUpToCPUSpecificOpSet(clonedNetwork.getFunction(), conf);
+            if (keepExportedNetwork && CNNNetworkSerializer::isSerializable(clonedNetwork, extensionManager)) {
+                exportedNetwork = InferenceEngine::cloneNetwork(clonedNetwork);
+                isExportedTransformed = true;
+            }
+        }
+        ConvertToCPUSpecificOpset(clonedNetwork);
         is_transformed = true;
     }
     IE_SUPPRESS_DEPRECATED_START
@@ -438,7 +479,33 @@ Engine::LoadExeNetworkImpl(const InferenceEngine::CNNNetwork &network, const std
         }
     }
 
-    return std::make_shared<MKLDNNExecNetwork>(clonedNetwork, conf, extensionManager, weightsSharing);
+    return std::make_shared<MKLDNNExecNetwork>(clonedNetwork, conf, extensionManager, weightsSharing,
+                                               exportedNetwork, isExportedTransformed);
+}
+
+InferenceEngine::ExecutableNetworkInternal::Ptr
+Engine::ImportNetworkImpl(std::istream& networkModel, const std::map<std::string, std::string>& config) {
+    OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, "Engine::ImportNetworkImpl");
+
+    CNNNetworkDeserializer deserializer(networkModel,
+        [this](const std::string& model, const Blob::CPtr& weights) {
+            return GetCore()->ReadNetwork(model, weights);
+        });
+
+    CNNNetwork cnnnetwork;
+    deserializer >> cnnnetwork;
+
+    InputsDataMap networkInputs;
+    OutputsDataMap networkOutputs;
+    copyInputOutputInfo(cnnnetwork.getInputsInfo(), cnnnetwork.getOutputsInfo(), networkInputs, networkOutputs);
+
+    // The network exported after the common transformations is only converted to the CPU specific operations
+    auto execNetwork = LoadExeNetwork(cnnnetwork, config, deserializer.isTransformed());
+    execNetwork->setNetworkInputs(networkInputs);
+    execNetwork->setNetworkOutputs(networkOutputs);
+    execNetwork->SetPointerToPlugin(shared_from_this());
+
+    return execNetwork;
 }
 
 void Engine::SetConfig(const std::map<std::string, std::string> &config) {
@@ -481,6 +548,11 @@ Parameter Engine::GetMetric(const std::string& name, const std::map<std::string,
         metrics.push_back(METRIC_KEY(SUPPORTED_CONFIG_KEYS));
         metrics.push_back(METRIC_KEY(RANGE_FOR_ASYNC_INFER_REQUESTS));
         metrics.push_back(METRIC_KEY(RANGE_FOR_STREAMS));
+        metrics.push_back(METRIC_KEY(IMPORT_EXPORT_SUPPORT));
+        metrics.push_back(METRIC_KEY(CPU_SHARED_WORKSPACE_SIZE));
+        metrics.push_back(METRIC_KEY(CPU_SHARED_WORKSPACE_COUNT));
+        metrics.push_back(METRIC_KEY(CPU_SHARED_WORKSPACE_LEASES));
+        metrics.push_back(METRIC_KEY(CPU_SHARED_WORKSPACE_CONTENDED_LEASES));
         IE_SET_METRIC_RETURN(SUPPORTED_METRICS, metrics);
     } else if (name == METRIC_KEY(FULL_DEVICE_NAME)) {
         std::string brand_string;
@@ -527,6 +599,16 @@ Parameter Engine::GetMetric(const std::string& name, const std::map<std::string,
     } else if (name == METRIC_KEY(RANGE_FOR_STREAMS)) {
         std::tuple<unsigned int, unsigned int> range = std::make_tuple(1, parallel_get_max_threads());
         IE_SET_METRIC_RETURN(RANGE_FOR_STREAMS, range);
+    } else if (name == METRIC_KEY(IMPORT_EXPORT_SUPPORT)) {
+        IE_SET_METRIC_RETURN(IMPORT_EXPORT_SUPPORT, true);
+    } else if (name == METRIC_KEY(CPU_SHARED_WORKSPACE_SIZE)) {
+        IE_SET_METRIC_RETURN(CPU_SHARED_WORKSPACE_SIZE, MKLDNNWorkspacePool::GetInstance().statistics().size);
+    } else if (name == METRIC_KEY(CPU_SHARED_WORKSPACE_COUNT)) {
+        IE_SET_METRIC_RETURN(CPU_SHARED_WORKSPACE_COUNT, MKLDNNWorkspacePool::GetInstance().statistics().workspaces);
+    } else if (name == METRIC_KEY(CPU_SHARED_WORKSPACE_LEASES)) {
+        IE_SET_METRIC_RETURN(CPU_SHARED_WORKSPACE_LEASES, MKLDNNWorkspacePool::GetInstance().statistics().leases);
+    } else if (name == METRIC_KEY(CPU_SHARED_WORKSPACE_CONTENDED_LEASES)) {
+        IE_SET_METRIC_RETURN(CPU_SHARED_WORKSPACE_CONTENDED_LEASES, MKLDNNWorkspacePool::GetInstance().statistics().contendedLeases);
     } else {
         IE_THROW() << "Unsupported metric key " << name;
     }
@@ -36,7 +36,14 @@ public:
     InferenceEngine::QueryNetworkResult QueryNetwork(const InferenceEngine::CNNNetwork& network,
                                                      const std::map<std::string, std::string>& config) const override;
 
+    InferenceEngine::ExecutableNetworkInternal::Ptr ImportNetworkImpl(std::istream& networkModel,
+                                                                      const std::map<std::string, std::string>& config) override;
+
 private:
+    InferenceEngine::ExecutableNetworkInternal::Ptr
+    LoadExeNetwork(const InferenceEngine::CNNNetwork &network, const std::map<std::string, std::string> &config,
+                   bool isTransformed);
+
     Config engConfig;
     NumaNodesWeights weightsSharing;
     MKLDNNExtensionManager::Ptr extensionManager = std::make_shared<MKLDNNExtensionManager>();
@@ -0,0 +1,149 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_reorder_cache.hpp"
+#include "mkldnn_memory.h"
+
+#include <functional>
+
+using namespace mkldnn;
+
+namespace MKLDNNPlugin {
+
+namespace {
+
+template <typename T>
+inline void hashCombine(size_t& seed, const T& value) {
+    seed ^= std::hash<T>()(value) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+}
+
+size_t hashDesc(const memory::desc& desc) {
+    const auto& data = desc.data;
+    size_t seed = 0;
+    hashCombine(seed, data.ndims);
+    hashCombine(seed, static_cast<int>(data.data_type));
+    hashCombine(seed, static_cast<int>(data.format_kind));
+    hashCombine(seed, data.offset0);
+    for (int i = 0; i < data.ndims; i++) {
+        hashCombine(seed, data.dims[i]);
+        hashCombine(seed, data.padded_dims[i]);
+    }
+    if (data.format_kind == dnnl_blocked) {
+        const auto& blk = data.format_desc.blocking;
+        for (int i = 0; i < data.ndims; i++) {
+            hashCombine(seed, blk.strides[i]);
+        }
+        for (int i = 0; i < blk.inner_nblks; i++) {
+            hashCombine(seed, blk.inner_blks[i]);
+            hashCombine(seed, blk.inner_idxs[i]);
+        }
+    }
+    return seed;
+}
+
+}  // namespace
+
+constexpr size_t MKLDNNReorderCache::defaultCapacity;
+
+bool MKLDNNReorderCache::Key::operator==(const Key& other) const {
+    return engine.get() == other.engine.get() && src == other.src && dst == other.dst;
+}
+
+size_t MKLDNNReorderCache::KeyHash::operator()(const Key& key) const {
+    size_t seed = hashDesc(key.src);
+    hashCombine(seed, hashDesc(key.dst));
+    hashCombine(seed, key.engine.get());
+    return seed;
+}
+
+MKLDNNReorderCache::MKLDNNReorderCache(size_t capacity) : capacity(capacity) {}
+
+MKLDNNReorderCache& MKLDNNReorderCache::GetInstance() {
+    static MKLDNNReorderCache cache;
+    return cache;
+}
+
+MKLDNNReorderCache::Reorder MKLDNNReorderCache::get(const memory::desc& src, const memory::desc& dst, const engine& eng) {
+    Key key {src, dst, eng};
+    {
+        std::lock_guard<std::mutex> lock(guard);
+        auto found = index.find(key);
+        if (found != index.end()) {
+            hitCount++;
+            entries.splice(entries.begin(), entries, found->second);
+            return found->second->second;
+        }
+        missCount++;
+    }
+
+    // the primitive is created without the lock, so other threads are not blocked meanwhile
+    auto created = create(src, dst, eng);
+
+    std::lock_guard<std::mutex> lock(guard);
+    if (index.find(key) == index.end()) {
+        entries.emplace_front(key, created);
+        index.emplace(key, entries.begin());
+        evict();
+    }
+    return created;
+}
+
+MKLDNNReorderCache::Reorder MKLDNNReorderCache::create(const memory::desc& src, const memory::desc& dst, const engine& eng) {
+    Reorder result;
+    try {
+        result.primitive = reorder(reorder::primitive_desc(eng, src, eng, dst));
+    }
+    catch (const mkldnn::error& err) {
+        if (mkldnn_unimplemented == err.status && src.data.data_type != dst.data.data_type) {
+            //we probably could not make the reorder because there is no one supporting this precision conversion
+            //lets try to convert data first using cpu_convert
+            auto dims = memory::dims(src.data.dims, src.data.dims + src.data.ndims);
+            auto format = MKLDNNMemoryDesc(src).getFormat();
+            result.convertSource = true;
+            result.convertedSource = MKLDNNMemoryDesc(dims, static_cast<memory::data_type>(dst.data.data_type), format);
+            result.primitive = reorder(reorder::primitive_desc(eng, result.convertedSource, eng, dst));
+        } else {
+            throw;
+        }
+    }
+    return result;
+}
+
+void MKLDNNReorderCache::evict() {
+    while (entries.size() > capacity) {
+        index.erase(entries.back().first);
+        entries.pop_back();
+    }
+}
+
+size_t MKLDNNReorderCache::hits() const {
+    std::lock_guard<std::mutex> lock(guard);
+    return hitCount;
+}
+
+size_t MKLDNNReorderCache::misses() const {
+    std::lock_guard<std::mutex> lock(guard);
+    return missCount;
+}
+
+size_t MKLDNNReorderCache::size() const {
+    std::lock_guard<std::mutex> lock(guard);
+    return entries.size();
+}
+
+void MKLDNNReorderCache::setCapacity(size_t newCapacity) {
+    std::lock_guard<std::mutex> lock(guard);
+    capacity = newCapacity;
+    evict();
+}
+
+void MKLDNNReorderCache::clear() {
+    std::lock_guard<std::mutex> lock(guard);
+    entries.clear();
+    index.clear();
+    hitCount = 0;
+    missCount = 0;
+}
+
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,84 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <mkldnn.hpp>
+
+#include <cstddef>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+
+namespace MKLDNNPlugin {
+
+/**
+ * Bounded LRU cache of reorder primitives keyed by the source and destination memory descriptors.
+ * Reorder primitives take the memory at execution time, so a cached primitive serves any memory
+ * objects with the same descriptors. If there is no reorder for the pair of data types, the source
+ * is converted by cpu_convert first, which is recorded in the entry as well.
+ *
+ * Is a thread safe
+ */
+class MKLDNNReorderCache {
+public:
+    struct Reorder {
+        mkldnn::reorder primitive;
+        // The source has to be converted to the destination data type before the reorder,
+        // the reorder is created for the converted source descriptor
+        bool convertSource = false;
+        mkldnn::memory::desc convertedSource;
+    };
+
+    static constexpr size_t defaultCapacity = 256;
+
+    explicit MKLDNNReorderCache(size_t capacity = defaultCapacity);
+
+    /**
+     * Returns the cached reorder or creates a new one
+     * Throws mkldnn::error if there is no reorder between the descriptors
+     */
+    Reorder get(const mkldnn::memory::desc& src, const mkldnn::memory::desc& dst, const mkldnn::engine& eng);
+
+    size_t hits() const;
+    size_t misses() const;
+    size_t size() const;
+
+    void setCapacity(size_t capacity);
+    void clear();
+
+    /**
+     * The cache used by MKLDNNMemory::reorderData
+     */
+    static MKLDNNReorderCache& GetInstance();
+
+private:
+    struct Key {
+        mkldnn::memory::desc src;
+        mkldnn::memory::desc dst;
+        // owning handle, the engine can't be released and its address reused while the entry exists
+        mkldnn::engine engine;
+
+        bool operator==(const Key& other) const;
+    };
+
+    struct KeyHash {
+        size_t operator()(const Key& key) const;
+    };
+
+    using Entry = std::pair<Key, Reorder>;
+
+    static Reorder create(const mkldnn::memory::desc& src, const mkldnn::memory::desc& dst, const mkldnn::engine& eng);
+    void evict();
+
+    mutable std::mutex guard;
+    size_t capacity;
+    size_t hitCount = 0;
+    size_t missCount = 0;
+    // most recently used first
+    std::list<Entry> entries;
+    std::unordered_map<Key, std::list<Entry>::iterator, KeyHash> index;
+};
+
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,341 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_serialize.h"
+
+#include <array>
+#include <cstdint>
+#include <map>
+#include <sstream>
+#include <vector>
+
+#include <blob_factory.hpp>
+#include <ie_preprocess.hpp>
+#include <ngraph/opsets/opset.hpp>
+#include <ngraph/op/util/sub_graph_base.hpp>
+#include <transformations/serialize.hpp>
+#include <transformations/rt_info/dequantization_attribute.hpp>
+#include <transformations/utils/utils.hpp>
+
+using namespace InferenceEngine;
+
+namespace MKLDNNPlugin {
+
+namespace {
+
+using ExportMagic = std::array<char, 8>;
+constexpr ExportMagic cpuExportMagic = {{'M', 'K', 'L', 'D', 'N', 'N', 'I', 'R'}};
+constexpr std::uint32_t cpuExportVersion = 2;
+
+template <typename T>
+void writeValue(std::ostream & stream, const T & value) {
+    stream.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template <typename T>
+T readValue(std::istream & stream) {
+    T value {};
+    stream.read(reinterpret_cast<char*>(&value), sizeof(T));
+    if (!stream.good())
+        IE_THROW(NetworkNotRead) << "Unexpected end of the exported CPU network stream";
+    return value;
+}
+
+void writeString(std::ostream & stream, const std::string & str) {
+    writeValue(stream, static_cast<std::uint64_t>(str.size()));
+    stream.write(str.data(), str.size());
+}
+
+std::string readString(std::istream & stream) {
+    auto size = readValue<std::uint64_t>(stream);
+    std::string str(size, '\0');
+    if (size != 0)
+        stream.read(&str[0], size);
+    if (!stream.good())
+        IE_THROW(NetworkNotRead) << "Unexpected end of the exported CPU network stream";
+    return str;
+}
+
+void writePreProcess(std::ostream & stream, const PreProcessInfo & preProcess) {
+    writeValue(stream, static_cast<std::int32_t>(preProcess.getResizeAlgorithm()));
+    writeValue(stream, static_cast<std::int32_t>(preProcess.getColorFormat()));
+    writeValue(stream, static_cast<std::int32_t>(preProcess.getMeanVariant()));
+    writeValue(stream, static_cast<std::uint64_t>(preProcess.getNumberOfChannels()));
+    for (size_t c = 0; c < preProcess.getNumberOfChannels(); ++c) {
+        const auto & channel = preProcess[c];
+        writeValue(stream, channel->stdScale);
+        writeValue(stream, channel->meanValue);
+        const bool hasMeanData = preProcess.getMeanVariant() == MEAN_IMAGE && channel->meanData;
+        writeValue(stream, static_cast<std::uint8_t>(hasMeanData));
+        if (hasMeanData) {
+            const auto & desc = channel->meanData->getTensorDesc();
+            writeValue(stream, static_cast<std::int32_t>(desc.getPrecision()));
+            writeValue(stream, static_cast<std::uint64_t>(desc.getDims().size()));
+            for (auto dim : desc.getDims())
+                writeValue(stream, static_cast<std::uint64_t>(dim));
+            stream.write(channel->meanData->cbuffer().as<const char*>(), channel->meanData->byteSize());
+        }
+    }
+}
+
+void readPreProcess(std::istream & stream, PreProcessInfo & preProcess) {
+    preProcess.setResizeAlgorithm(static_cast<ResizeAlgorithm>(readValue<std::int32_t>(stream)));
+    preProcess.setColorFormat(static_cast<ColorFormat>(readValue<std::int32_t>(stream)));
+    auto meanVariant = static_cast<MeanVariant>(readValue<std::int32_t>(stream));
+    auto numberOfChannels = readValue<std::uint64_t>(stream);
+    if (numberOfChannels != 0)
+        preProcess.init(numberOfChannels);
+    for (size_t c = 0; c < numberOfChannels; ++c) {
+        auto & channel = preProcess[c];
+        channel->stdScale = readValue<float>(stream);
+        channel->meanValue = readValue<float>(stream);
+        if (readValue<std::uint8_t>(stream)) {
+            Precision precision = static_cast<Precision::ePrecision>(readValue<std::int32_t>(stream));
+            SizeVector dims(readValue<std::uint64_t>(stream));
+            for (auto & dim : dims)
+                dim = readValue<std::uint64_t>(stream);
+            auto meanData = make_blob_with_precision(TensorDesc(precision, dims, TensorDesc::getLayoutByDims(dims)));
+            meanData->allocate();
+            stream.read(meanData->buffer().as<char*>(), meanData->byteSize());
+            if (!stream.good())
+                IE_THROW(NetworkNotRead) << "Unexpected end of the exported CPU network stream";
+            preProcess.setMeanImageForChannel(meanData, c);
+        }
+    }
+    preProcess.setVariant(meanVariant);
+}
+
+std::map<std::string, ngraph::OpSet> getCustomOpSets(const MKLDNNExtensionManager::Ptr & extensionManager) {
+    std::map<std::string, ngraph::OpSet> custom_opsets;
+    if (extensionManager) {
+        for (const auto & extension : extensionManager->Extensions()) {
+            auto opset = extension->getOpSets();
+            custom_opsets.insert(std::begin(opset), std::end(opset));
+        }
+    }
+    return custom_opsets;
+}
+
+bool isReadableOp(const ngraph::Node * op, const std::map<std::string, ngraph::OpSet> & custom_opsets) {
+    for (const auto & opset : {&ngraph::get_opset1(), &ngraph::get_opset2(), &ngraph::get_opset3(), &ngraph::get_opset4(),
+                               &ngraph::get_opset5(), &ngraph::get_opset6(), &ngraph::get_opset7()}) {
+        if (opset->contains_op_type(op))
+            return true;
+    }
+    for (const auto & opset : custom_opsets) {
+        if (opset.second.contains_op_type(op))
+            return true;
+    }
+    return false;
+}
+
+bool isReadableFunction(const ngraph::Function & function, const std::map<std::string, ngraph::OpSet> & custom_opsets) {
+    for (const auto & op : function.get_ordered_ops()) {
+        if (!isReadableOp(op.get(), custom_opsets))
+            return false;
+        if (auto subGraph = std::dynamic_pointer_cast<ngraph::op::util::SubGraphOp>(op)) {
+            if (!isReadableFunction(*subGraph->get_function(), custom_opsets))
+                return false;
+        }
+    }
+    return true;
+}
+
+// Run time info is not a part of IR, but the conversion to the CPU specific operations depends on these keys
+enum class RtInfoKey : std::uint8_t {
+    Dequantization,
+    UnrollTensorIterator
+};
+
+void writeRtInfo(std::ostream & stream, const ngraph::Function & function) {
+    std::vector<std::pair<std::string, RtInfoKey>> entries;
+    for (const auto & op : function.get_ordered_ops()) {
+        const auto & rtInfo = op->get_rt_info();
+        if (rtInfo.count("DEQUANTIZATION"))
+            entries.emplace_back(op->get_friendly_name(), RtInfoKey::Dequantization);
+        if (rtInfo.count("UNROLL_TI"))
+            entries.emplace_back(op->get_friendly_name(), RtInfoKey::UnrollTensorIterator);
+    }
+    writeValue(stream, static_cast<std::uint64_t>(entries.size()));
+    for (const auto & entry : entries) {
+        writeString(stream, entry.first);
+        writeValue(stream, entry.second);
+    }
+}
+
+std::vector<std::pair<std::string, RtInfoKey>> readRtInfo(std::istream & stream) {
+    std::vector<std::pair<std::string, RtInfoKey>> entries(readValue<std::uint64_t>(stream));
+    for (auto & entry : entries) {
+        entry.first = readString(stream);
+        entry.second = readValue<RtInfoKey>(stream);
+    }
+    return entries;
+}
+
+void restoreRtInfo(ngraph::Function & function, const std::vector<std::pair<std::string, RtInfoKey>> & entries) {
+    if (entries.empty())
+        return;
+    std::map<std::string, std::shared_ptr<ngraph::Node>> ops;
+    for (const auto & op : function.get_ops())
+        ops.emplace(op->get_friendly_name(), op);
+    for (const auto & entry : entries) {
+        auto it = ops.find(entry.first);
+        if (it == ops.end())
+            IE_THROW(NetworkNotRead) << "Operation " << entry.first << " is not found in the exported CPU network";
+        auto & rtInfo = it->second->get_rt_info();
+        switch (entry.second) {
+        case RtInfoKey::Dequantization:
+            rtInfo["DEQUANTIZATION"] = std::make_shared<ngraph::VariantWrapper<ngraph::DequantizationAttr>>(ngraph::DequantizationAttr());
+            break;
+        case RtInfoKey::UnrollTensorIterator:
+            rtInfo["UNROLL_TI"] = std::make_shared<ngraph::VariantWrapper<int64_t>>(1);
+            break;
+        default:
+            IE_THROW(NetworkNotRead) << "Unknown run time info in the exported CPU network";
+        }
+    }
+}
+
+}  // namespace
+
+CNNNetworkSerializer::CNNNetworkSerializer(std::ostream & ostream, MKLDNNExtensionManager::Ptr extensionManager,
+                                           bool isTransformed)
+    : _ostream(ostream)
+    , _extensionManager(extensionManager)
+    , _isTransformed(isTransformed) {
+}
+
+bool CNNNetworkSerializer::isSerializable(const CNNNetwork & network, MKLDNNExtensionManager::Ptr extensionManager) {
+    auto function = network.getFunction();
+    if (!function || !isReadableFunction(*function, getCustomOpSets(extensionManager)))
+        return false;
+
+    // Inputs and outputs info of the network read back is found by the names the operations have
+    const auto inputs = network.getInputsInfo();
+    for (const auto & parameter : function->get_parameters()) {
+        if (!inputs.count(parameter->get_friendly_name()))
+            return false;
+    }
+    const auto outputs = network.getOutputsInfo();
+    for (const auto & result : function->get_results()) {
+        if (!outputs.count(ngraph::op::util::create_ie_output_name(result->input_value(0))))
+            return false;
+    }
+    return inputs.size() == function->get_parameters().size() && outputs.size() == function->get_results().size();
+}
+
+void CNNNetworkSerializer::operator << (const CNNNetwork & network) {
+    auto function = network.getFunction();
+    if (!function)
+        IE_THROW(NotImplemented) << "CPU plugin can export only networks represented by ngraph::Function";
+
+    std::stringstream xmlFile, binFile;
+    ngraph::pass::Serialize serializer(xmlFile, binFile,
+        ngraph::pass::Serialize::Version::IR_V10, getCustomOpSets(_extensionManager));
+    serializer.run_on_function(std::const_pointer_cast<ngraph::Function>(function));
+
+    _ostream.write(cpuExportMagic.data(), cpuExportMagic.size());
+    writeValue(_ostream, cpuExportVersion);
+    writeValue(_ostream, static_cast<std::uint8_t>(_isTransformed));
+
+    // Inputs and outputs info is kept outside of the IR since it's owned by CNNNetwork
+    const auto inputs = network.getInputsInfo();
+    writeValue(_ostream, static_cast<std::uint64_t>(inputs.size()));
+    for (const auto & in : inputs) {
+        writeString(_ostream, in.first);
+        writeValue(_ostream, static_cast<std::int32_t>(in.second->getPrecision()));
+        writeValue(_ostream, static_cast<std::int32_t>(in.second->getLayout()));
+        writePreProcess(_ostream, in.second->getPreProcess());
+    }
+
+    const auto outputs = network.getOutputsInfo();
+    writeValue(_ostream, static_cast<std::uint64_t>(outputs.size()));
+    for (const auto & out : outputs) {
+        writeString(_ostream, out.first);
+        writeValue(_ostream, static_cast<std::int32_t>(out.second->getPrecision()));
+        writeValue(_ostream, static_cast<std::int32_t>(out.second->getLayout()));
+    }
+
+    writeRtInfo(_ostream, *function);
+
+    writeString(_ostream, xmlFile.str());
+    writeString(_ostream, binFile.str());
+}
+
+CNNNetworkDeserializer::CNNNetworkDeserializer(std::istream & istream, cnn_network_builder fn)
+    : _istream(istream)
+    , _cnn_network_builder(fn) {
+}
+
+void CNNNetworkDeserializer::operator >> (CNNNetwork & network) {
+    ExportMagic magic = {};
+    _istream.read(magic.data(), magic.size());
+    if (!_istream.good() || magic != cpuExportMagic)
+        IE_THROW(NetworkNotRead) << "The stream doesn't contain a network exported by the CPU plugin";
+    auto version = readValue<std::uint32_t>(_istream);
+    if (version != cpuExportVersion)
+        IE_THROW(NetworkNotRead) << "Unsupported version of the exported CPU network: " << version;
+    _isTransformed = readValue<std::uint8_t>(_istream) != 0;
+
+    struct InputDesc {
+        Precision precision;
+        Layout layout;
+        PreProcessInfo preProcess;
+    };
+    std::map<std::string, InputDesc> inputs;
+    auto inputsCount = readValue<std::uint64_t>(_istream);
+    for (std::uint64_t i = 0; i < inputsCount; ++i) {
+        auto name = readString(_istream);
+        auto & desc = inputs[name];
+        desc.precision = static_cast<Precision::ePrecision>(readValue<std::int32_t>(_istream));
+        desc.layout = static_cast<Layout>(readValue<std::int32_t>(_istream));
+        readPreProcess(_istream, desc.preProcess);
+    }
+
+    std::map<std::string, std::pair<Precision, Layout>> outputs;
+    auto outputsCount = readValue<std::uint64_t>(_istream);
+    for (std::uint64_t i = 0; i < outputsCount; ++i) {
+        auto name = readString(_istream);
+        auto precision = static_cast<Precision::ePrecision>(readValue<std::int32_t>(_istream));
+        auto layout = static_cast<Layout>(readValue<std::int32_t>(_istream));
+        outputs[name] = {precision, layout};
+    }
+
+    auto rtInfo = readRtInfo(_istream);
+
+    auto xmlString = readString(_istream);
+
+    Blob::Ptr dataBlob;
+    auto dataSize = readValue<std::uint64_t>(_istream);
+    if (0 != dataSize) {
+        dataBlob = make_shared_blob<std::uint8_t>(
+            TensorDesc(Precision::U8, {static_cast<std::size_t>(dataSize)}, Layout::C));
+        dataBlob->allocate();
+        _istream.read(dataBlob->buffer(), dataSize);
+        if (!_istream.good())
+            IE_THROW(NetworkNotRead) << "Unexpected end of the exported CPU network stream";
+    }
+
+    network = _cnn_network_builder(xmlString, std::move(dataBlob));
+    restoreRtInfo(*network.getFunction(), rtInfo);
+
+    for (const auto & in : network.getInputsInfo()) {
+        auto it = inputs.find(in.first);
+        if (it == inputs.end())
+            IE_THROW(NetworkNotRead) << "Input " << in.first << " is not found in the exported CPU network";
+        in.second->setPrecision(it->second.precision);
+        in.second->setLayout(it->second.layout);
+        in.second->getPreProcess() = it->second.preProcess;
+    }
+
+    for (const auto & out : network.getOutputsInfo()) {
+        auto it = outputs.find(out.first);
+        if (it == outputs.end())
+            IE_THROW(NetworkNotRead) << "Output " << out.first << " is not found in the exported CPU network";
+        out.second->setPrecision(it->second.first);
+        out.second->setLayout(it->second.second);
+    }
+}
+
+}  // namespace MKLDNNPlugin
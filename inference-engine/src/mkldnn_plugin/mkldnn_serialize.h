@@ -0,0 +1,64 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <functional>
+#include <istream>
+#include <ostream>
+#include <string>
+
+#include <cpp/ie_cnn_network.h>
+#include "mkldnn_extension_mngr.h"
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief Writes the network in a form suitable for the CPU plugin Export/Import:
+ * inputs/outputs info (precisions, layouts, preprocessing), the run time info used by the legacy conversion
+ * and IR v10 xml and weights.
+ * The network is either the one passed to LoadNetwork or the result of the common transformations,
+ * so Import can skip them.
+ */
+class CNNNetworkSerializer {
+public:
+    CNNNetworkSerializer(std::ostream & ostream, MKLDNNExtensionManager::Ptr extensionManager, bool isTransformed);
+    void operator << (const InferenceEngine::CNNNetwork & network);
+
+    /**
+     * @brief Checks that the network read back from IR has the same operations and inputs/outputs names
+     */
+    static bool isSerializable(const InferenceEngine::CNNNetwork & network, MKLDNNExtensionManager::Ptr extensionManager);
+
+private:
+    std::ostream & _ostream;
+    MKLDNNExtensionManager::Ptr _extensionManager;
+    bool _isTransformed;
+};
+
+/**
+ * @brief Restores the network written by CNNNetworkSerializer.
+ * IR parsing is delegated to the callback (normally ICore::ReadNetwork) to reuse registered readers and extensions.
+ */
+class CNNNetworkDeserializer {
+public:
+    typedef std::function<
+        InferenceEngine::CNNNetwork(
+            const std::string&,
+            const InferenceEngine::Blob::CPtr&)> cnn_network_builder;
+    CNNNetworkDeserializer(std::istream & istream, cnn_network_builder fn);
+    void operator >> (InferenceEngine::CNNNetwork & network);
+
+    /**
+     * @brief Whether the read network has already passed the common transformations
+     */
+    bool isTransformed() const { return _isTransformed; }
+
+private:
+    std::istream & _istream;
+    cnn_network_builder _cnn_network_builder;
+    bool _isTransformed = false;
+};
+
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,94 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_workspace_pool.hpp"
+
+#include <utility>
+
+using namespace InferenceEngine;
+
+namespace MKLDNNPlugin {
+
+MKLDNNWorkspacePool::Lease::Lease(Lease&& other) noexcept : pool(other.pool), workspace(other.workspace) {
+    other.pool = nullptr;
+    other.workspace = nullptr;
+}
+
+MKLDNNWorkspacePool::Lease& MKLDNNWorkspacePool::Lease::operator=(Lease&& other) noexcept {
+    if (this != &other) {
+        release();
+        std::swap(pool, other.pool);
+        std::swap(workspace, other.workspace);
+    }
+    return *this;
+}
+
+MKLDNNWorkspacePool::Lease::~Lease() {
+    release();
+}
+
+void* MKLDNNWorkspacePool::Lease::data() const {
+    return workspace ? workspace->memory->GetData() : nullptr;
+}
+
+void MKLDNNWorkspacePool::Lease::release() {
+    if (pool != nullptr)
+        pool->release(workspace);
+    pool = nullptr;
+    workspace = nullptr;
+}
+
+MKLDNNWorkspacePool::Lease MKLDNNWorkspacePool::acquire(size_t size, const void* preferred) {
+    std::lock_guard<std::mutex> lock(guard);
+    stats.leases++;
+
+    Workspace* chosen = nullptr;
+    for (auto& workspace : workspaces) {
+        if (workspace.leased)
+            continue;
+        if (workspace.memory->GetData() == preferred && workspace.size >= size) {
+            chosen = &workspace;
+            break;
+        }
+        // otherwise the largest free one, so the least memory is reallocated
+        if (chosen == nullptr || workspace.size > chosen->size)
+            chosen = &workspace;
+    }
+
+    if (chosen == nullptr) {
+        if (!workspaces.empty())
+            stats.contendedLeases++;
+        workspaces.emplace_back();
+        chosen = &workspaces.back();
+    }
+
+    if (chosen->size < size) {
+        stats.size += size - chosen->size;
+        chosen->memory = std::make_shared<MKLDNNMemory>(eng);
+        chosen->memory->Create(MKLDNNMemoryDesc(TensorDesc(Precision::I8, {size}, Layout::C)));
+        chosen->size = size;
+    }
+
+    chosen->leased = true;
+    return Lease(this, chosen);
+}
+
+void MKLDNNWorkspacePool::release(Workspace* workspace) {
+    std::lock_guard<std::mutex> lock(guard);
+    workspace->leased = false;
+}
+
+MKLDNNWorkspacePool::Statistics MKLDNNWorkspacePool::statistics() const {
+    std::lock_guard<std::mutex> lock(guard);
+    auto result = stats;
+    result.workspaces = workspaces.size();
+    return result;
+}
+
+MKLDNNWorkspacePool& MKLDNNWorkspacePool::GetInstance() {
+    static MKLDNNWorkspacePool pool;
+    return pool;
+}
+
+}  // namespace MKLDNNPlugin
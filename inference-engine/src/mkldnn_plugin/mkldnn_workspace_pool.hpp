@@ -0,0 +1,79 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "mkldnn_memory.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <mutex>
+
+namespace MKLDNNPlugin {
+
+/**
+ * Plugin-wide pool of workspaces for the intermediate memory of graphs configured to share it.
+ * A graph leases a workspace for the time of a single inference, so the pool holds as many workspaces
+ * as there are inferences running at the same time, each one of the maximal size requested.
+ *
+ * Is a thread safe
+ */
+class MKLDNNWorkspacePool {
+    struct Workspace {
+        MKLDNNMemoryPtr memory;
+        size_t size = 0;
+        bool leased = false;
+    };
+
+public:
+    /**
+     * Leased workspace, returned to the pool on destruction
+     */
+    class Lease {
+    public:
+        Lease() = default;
+        Lease(Lease&& other) noexcept;
+        Lease& operator=(Lease&& other) noexcept;
+        ~Lease();
+
+        void* data() const;
+
+    private:
+        friend class MKLDNNWorkspacePool;
+        Lease(MKLDNNWorkspacePool* pool, Workspace* workspace) : pool(pool), workspace(workspace) {}
+        void release();
+
+        MKLDNNWorkspacePool* pool = nullptr;
+        Workspace* workspace = nullptr;
+    };
+
+    struct Statistics {
+        size_t size = 0;            // total size of the workspaces in bytes
+        size_t workspaces = 0;
+        uint64_t leases = 0;
+        uint64_t contendedLeases = 0;  // leases which found all the workspaces leased and added a new one
+    };
+
+    /**
+     * Leases a workspace of at least the given size. The workspace used by the caller before is preferred,
+     * so its memory doesn't have to be rebound.
+     */
+    Lease acquire(size_t size, const void* preferred = nullptr);
+
+    Statistics statistics() const;
+
+    static MKLDNNWorkspacePool& GetInstance();
+
+private:
+    void release(Workspace* workspace);
+
+    mutable std::mutex guard;
+    mkldnn::engine eng {mkldnn::engine::kind::cpu, 0};
+    // std::list keeps addresses of the workspaces stable
+    std::list<Workspace> workspaces;
+    Statistics stats;
+};
+
+}  // namespace MKLDNNPlugin
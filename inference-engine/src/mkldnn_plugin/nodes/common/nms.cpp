@@ -0,0 +1,202 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "nms.h"
+
+#include <algorithm>
+#include <cmath>
+
+using namespace MKLDNNPlugin;
+
+namespace {
+
+// The grid pays off if a lot of boxes may be selected out of a lot of candidates
+constexpr size_t gridMinSelected = 128;
+constexpr size_t gridMinCandidates = 1024;
+constexpr int gridMaxSize = 64;
+
+// The number of the selected boxes the overlap is computed for at once
+constexpr size_t overlapBlock = 16;
+
+inline float overlap(float cMin0, float cMin1, float cMax0, float cMax1, float cArea,
+                     float sMin0, float sMin1, float sMax0, float sMax1, float sArea, float coordinatesOffset) {
+    const float d0 = std::min(cMax0, sMax0) - std::max(cMin0, sMin0);
+    const float d1 = std::min(cMax1, sMax1) - std::max(cMin1, sMin1);
+    const float w0 = d0 + coordinatesOffset;
+    const float w1 = d1 + coordinatesOffset;
+    const bool intersects = cArea > 0.0f && sArea > 0.0f && d0 >= 0.0f && d1 >= 0.0f && w0 > 0.0f && w1 > 0.0f;
+    const float intersection = intersects ? w0 * w1 : 0.0f;
+    return intersects ? intersection / (cArea + sArea - intersection) : 0.0f;
+}
+
+}  // namespace
+
+NmsSelector::NmsSelector(float iouThreshold, bool suppressOnEqual, float coordinatesOffset)
+    : iouThreshold(iouThreshold), suppressOnEqual(suppressOnEqual), coordinatesOffset(coordinatesOffset) {}
+
+float NmsSelector::iou(const Box& candidate, const Box& selected, float coordinatesOffset) {
+    return overlap(candidate.min0, candidate.min1, candidate.max0, candidate.max1, candidate.area,
+                   selected.min0, selected.min1, selected.max0, selected.max1, selected.area, coordinatesOffset);
+}
+
+void NmsSelector::reset(const Box* candidates, size_t count, size_t maxSelected) {
+    maxSelected = std::min(maxSelected, count);
+    for (auto* v : {&min0, &min1, &max0, &max1, &area}) {
+        v->clear();
+        v->reserve(maxSelected);
+    }
+    indexes.clear();
+    indexes.reserve(maxSelected);
+
+    // Only boxes with positive overlap can be suppressed by the boxes from the other cells
+    const bool positiveOverlap = suppressOnEqual ? iouThreshold > 0.0f : iouThreshold >= 0.0f;
+    useGrid = positiveOverlap && maxSelected >= gridMinSelected && count >= gridMinCandidates;
+    if (!useGrid)
+        return;
+
+    float lo0 = INFINITY, lo1 = INFINITY, hi0 = -INFINITY, hi1 = -INFINITY;
+    double size0 = 0.0, size1 = 0.0;
+    size_t valid = 0;
+    for (size_t i = 0; i < count; i++) {
+        const Box& b = candidates[i];
+        if (!(b.area > 0.0f && b.min0 <= b.max0 && b.min1 <= b.max1))
+            continue;
+        lo0 = std::min(lo0, b.min0);
+        lo1 = std::min(lo1, b.min1);
+        hi0 = std::max(hi0, b.max0);
+        hi1 = std::max(hi1, b.max1);
+        size0 += b.max0 - b.min0;
+        size1 += b.max1 - b.min1;
+        valid++;
+    }
+    if (valid == 0 || !std::isfinite(hi0 - lo0) || !std::isfinite(hi1 - lo1)) {
+        useGrid = false;
+        return;
+    }
+
+    // A cell is about the size of an average box, so a box is put into a few cells only
+    auto gridSize = [&](float extent, double size) {
+        const double average = size / valid;
+        if (average <= 0.0)
+            return gridMaxSize;
+        return static_cast<int>(std::max(1.0, std::min(static_cast<double>(gridMaxSize), extent / average)));
+    };
+    gridSize0 = gridSize(hi0 - lo0, size0);
+    gridSize1 = gridSize(hi1 - lo1, size1);
+    gridOrigin0 = lo0;
+    gridOrigin1 = lo1;
+    cellScale0 = hi0 > lo0 ? gridSize0 / (hi0 - lo0) : 0.0f;
+    cellScale1 = hi1 > lo1 ? gridSize1 / (hi1 - lo1) : 0.0f;
+
+    cells.resize(static_cast<size_t>(gridSize0) * gridSize1);
+    for (auto& c : cells)
+        c.clear();
+    visited.assign(maxSelected, 0);
+    visitMark = 0;
+}
+
+int NmsSelector::cell(float coordinate, float origin, float scale, int size) const {
+    const float c = (coordinate - origin) * scale;
+    // NaN goes to the first cell as well
+    if (!(c > 0.0f))
+        return 0;
+    return c >= static_cast<float>(size - 1) ? size - 1 : static_cast<int>(c);
+}
+
+bool NmsSelector::suppressedBy(const Box& box, size_t begin, size_t end) const {
+    float ious[overlapBlock];
+    for (size_t i = begin; i < end; i += overlapBlock) {
+        const size_t n = std::min(overlapBlock, end - i);
+        const float* sMin0 = &min0[i];
+        const float* sMin1 = &min1[i];
+        const float* sMax0 = &max0[i];
+        const float* sMax1 = &max1[i];
+        const float* sArea = &area[i];
+        for (size_t j = 0; j < n; j++) {
+            ious[j] = overlap(box.min0, box.min1, box.max0, box.max1, box.area,
+                              sMin0[j], sMin1[j], sMax0[j], sMax1[j], sArea[j], coordinatesOffset);
+        }
+        bool suppressed = false;
+        if (suppressOnEqual) {
+            for (size_t j = 0; j < n; j++)
+                suppressed |= ious[j] >= iouThreshold;
+        } else {
+            for (size_t j = 0; j < n; j++)
+                suppressed |= ious[j] > iouThreshold;
+        }
+        if (suppressed)
+            return true;
+    }
+    return false;
+}
+
+bool NmsSelector::suppressedByCells(const Box& box) {
+    // The boxes which don't intersect anything can't be suppressed, the grid requires positive overlap
+    if (!(box.area > 0.0f && box.min0 <= box.max0 && box.min1 <= box.max1))
+        return false;
+
+    if (++visitMark == 0) {
+        std::fill(visited.begin(), visited.end(), 0);
+        visitMark = 1;
+    }
+
+    const int c0Begin = cell(box.min0, gridOrigin0, cellScale0, gridSize0);
+    const int c0End = cell(box.max0, gridOrigin0, cellScale0, gridSize0);
+    const int c1Begin = cell(box.min1, gridOrigin1, cellScale1, gridSize1);
+    const int c1End = cell(box.max1, gridOrigin1, cellScale1, gridSize1);
+    for (int c0 = c0Begin; c0 <= c0End; c0++) {
+        for (int c1 = c1Begin; c1 <= c1End; c1++) {
+            for (int s : cells[c0 * gridSize1 + c1]) {
+                if (visited[s] == visitMark)
+                    continue;
+                visited[s] = visitMark;
+                const float iou = overlap(box.min0, box.min1, box.max0, box.max1, box.area,
+                                          min0[s], min1[s], max0[s], max1[s], area[s], coordinatesOffset);
+                if (suppressOnEqual ? iou >= iouThreshold : iou > iouThreshold)
+                    return true;
+            }
+        }
+    }
+    return false;
+}
+
+bool NmsSelector::select(const Box& box, int index) {
+    const bool suppressed = useGrid ? suppressedByCells(box) : suppressedBy(box, 0, size());
+    if (suppressed)
+        return false;
+    add(box, index);
+    return true;
+}
+
+void NmsSelector::add(const Box& box, int index) {
+    const int position = static_cast<int>(size());
+    min0.push_back(box.min0);
+    min1.push_back(box.min1);
+    max0.push_back(box.max0);
+    max1.push_back(box.max1);
+    area.push_back(box.area);
+    indexes.push_back(index);
+
+    if (!useGrid || !(box.area > 0.0f && box.min0 <= box.max0 && box.min1 <= box.max1))
+        return;
+    if (visited.size() <= static_cast<size_t>(position))
+        visited.resize(position + 1, 0);
+    const int c0Begin = cell(box.min0, gridOrigin0, cellScale0, gridSize0);
+    const int c0End = cell(box.max0, gridOrigin0, cellScale0, gridSize0);
+    const int c1Begin = cell(box.min1, gridOrigin1, cellScale1, gridSize1);
+    const int c1End = cell(box.max1, gridOrigin1, cellScale1, gridSize1);
+    for (int c0 = c0Begin; c0 <= c0End; c0++) {
+        for (int c1 = c1Begin; c1 <= c1End; c1++) {
+            cells[c0 * gridSize1 + c1].push_back(position);
+        }
+    }
+}
+
+void NmsSelector::overlaps(const Box& box, size_t begin, float* ious) const {
+    const size_t end = size();
+    for (size_t i = begin; i < end; i++) {
+        ious[i - begin] = overlap(box.min0, box.min1, box.max0, box.max1, box.area,
+                                  min0[i], min1[i], max0[i], max1[i], area[i], coordinatesOffset);
+    }
+}
@@ -0,0 +1,93 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief Greedy non max suppression over boxes coming in the order of decreasing score.
+ *
+ * The selected boxes are stored as structure of arrays, so the overlap of a candidate with all of them
+ * is computed by a vectorizable loop. If the overlap has to be positive to suppress a box and a lot of
+ * boxes may be selected, the selected boxes are also put into a uniform grid and a candidate is compared
+ * only with the boxes from the cells it covers.
+ *
+ * A box is given by the coordinates of two corners along the axes d0 and d1 and its area. The overlap is
+ * computed as intersection over union with the intersection of d0 * d1 and the same floating point
+ * operations as the reference implementations of NonMaxSuppression and DetectionOutput use.
+ */
+class NmsSelector {
+public:
+    struct Box {
+        float min0, min1, max0, max1, area;
+    };
+
+    /**
+     * @param iouThreshold boxes with greater overlap with a selected one are suppressed
+     * @param suppressOnEqual suppress boxes with overlap equal to the threshold as well
+     * @param coordinatesOffset is added to the intersection sizes (1 for boxes in pixel coordinates)
+     */
+    NmsSelector(float iouThreshold, bool suppressOnEqual, float coordinatesOffset = 0.0f);
+
+    /**
+     * @brief Drops the selected boxes and prepares for a new problem.
+     * @param candidates the boxes which are going to be checked, used to lay the grid out
+     * @param count the number of candidates
+     * @param maxSelected the max number of boxes which can be selected
+     */
+    void reset(const Box* candidates, size_t count, size_t maxSelected);
+
+    /**
+     * @brief Selects the box if it's not suppressed by one of the selected boxes.
+     * @return true if the box is selected
+     */
+    bool select(const Box& box, int index);
+
+    /**
+     * @brief Adds the box to the selected ones without checking the overlap.
+     */
+    void add(const Box& box, int index);
+
+    /**
+     * @brief Computes the overlap of the box with the selected boxes [begin, size()).
+     */
+    void overlaps(const Box& box, size_t begin, float* ious) const;
+
+    size_t size() const {
+        return indexes.size();
+    }
+
+    const std::vector<int>& selected() const {
+        return indexes;
+    }
+
+    static float iou(const Box& candidate, const Box& selected, float coordinatesOffset);
+
+private:
+    bool suppressedBy(const Box& box, size_t begin, size_t end) const;
+    bool suppressedByCells(const Box& box);
+    int cell(float coordinate, float origin, float scale, int size) const;
+
+    const float iouThreshold;
+    const bool suppressOnEqual;
+    const float coordinatesOffset;
+
+    std::vector<float> min0, min1, max0, max1, area;
+    std::vector<int> indexes;
+
+    // The grid over the candidates with the list of the selected boxes for every cell
+    bool useGrid = false;
+    int gridSize0 = 0, gridSize1 = 0;
+    float gridOrigin0 = 0.0f, gridOrigin1 = 0.0f;
+    float cellScale0 = 0.0f, cellScale1 = 0.0f;
+    std::vector<std::vector<int>> cells;
+    std::vector<int> visited;
+    int visitMark = 0;
+};
+
+}  // namespace MKLDNNPlugin
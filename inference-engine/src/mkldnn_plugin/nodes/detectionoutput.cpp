@@ -11,11 +11,14 @@
 #include <utility>
 #include <algorithm>
 #include "ie_parallel.hpp"
+#include "common/nms.h"
 
 namespace InferenceEngine {
 namespace Extensions {
 namespace Cpu {
 
+using MKLDNNPlugin::NmsSelector;
+
 template <typename T>
 static bool SortScorePairDescend(const std::pair<float, T>& pair1,
                                  const std::pair<float, T>& pair2) {
@@ -417,41 +420,11 @@ struct ConfidenceComparator {
     const float* _conf_data;
 };
 
-static inline float JaccardOverlap(const float *decoded_bbox,
-                                   const float *bbox_sizes,
-                                   const int idx1,
-                                   const int idx2) {
-    float xmin1 = decoded_bbox[idx1*4 + 0];
-    float ymin1 = decoded_bbox[idx1*4 + 1];
-    float xmax1 = decoded_bbox[idx1*4 + 2];
-    float ymax1 = decoded_bbox[idx1*4 + 3];
-
-    float xmin2 = decoded_bbox[idx2*4 + 0];
-    float ymin2 = decoded_bbox[idx2*4 + 1];
-    float xmax2 = decoded_bbox[idx2*4 + 2];
-    float ymax2 = decoded_bbox[idx2*4 + 3];
-
-    if (xmin2 > xmax1 || xmax2 < xmin1 || ymin2 > ymax1 || ymax2 < ymin1) {
-        return 0.0f;
-    }
-
-    float intersect_xmin = (std::max)(xmin1, xmin2);
-    float intersect_ymin = (std::max)(ymin1, ymin2);
-    float intersect_xmax = (std::min)(xmax1, xmax2);
-    float intersect_ymax = (std::min)(ymax1, ymax2);
-
-    float intersect_width  = intersect_xmax - intersect_xmin;
-    float intersect_height = intersect_ymax - intersect_ymin;
-
-    if (intersect_width <= 0 || intersect_height <= 0) {
-        return 0.0f;
-    }
-
-    float intersect_size = intersect_width * intersect_height;
-    float bbox1_size = bbox_sizes[idx1];
-    float bbox2_size = bbox_sizes[idx2];
-
-    return intersect_size / (bbox1_size + bbox2_size - intersect_size);
+static inline NmsSelector::Box decodedBox(const float *decoded_bbox,
+                                          const float *bbox_sizes,
+                                          const int idx) {
+    return {decoded_bbox[idx*4 + 0], decoded_bbox[idx*4 + 1], decoded_bbox[idx*4 + 2], decoded_bbox[idx*4 + 3],
+            bbox_sizes[idx]};
 }
 
 void DetectionOutputImpl::decodeBBoxes(const float *prior_data,
@@ -577,20 +550,16 @@ void DetectionOutputImpl::nms_cf(const float* conf_data,
                            buffer, buffer + num_output_scores,
                            ConfidenceComparator(conf_data));
 
+    std::vector<NmsSelector::Box> candidates(num_output_scores);
     for (int i = 0; i < num_output_scores; ++i) {
-        const int idx = buffer[i];
+        candidates[i] = decodedBox(bboxes, sizes, buffer[i]);
+    }
 
-        bool keep = true;
-        for (int k = 0; k < detections; ++k) {
-            const int kept_idx = indices[k];
-            float overlap = JaccardOverlap(bboxes, sizes, idx, kept_idx);
-            if (overlap > _nms_threshold) {
-                keep = false;
-                break;
-            }
-        }
-        if (keep) {
-            indices[detections] = idx;
+    NmsSelector selector(_nms_threshold, false);
+    selector.reset(candidates.data(), candidates.size(), candidates.size());
+    for (int i = 0; i < num_output_scores; ++i) {
+        if (selector.select(candidates[i], buffer[i])) {
+            indices[detections] = buffer[i];
             detections++;
         }
     }
@@ -626,6 +595,9 @@ void DetectionOutputImpl::nms_mx(const float* conf_data,
                            buffer, buffer + num_output_scores,
                            ConfidenceComparator(conf_data));
 
+    // The classes are suppressed separately, the candidates of all of them come mixed in the order of the score
+    std::vector<NmsSelector> selectors(_num_classes, NmsSelector(_nms_threshold, false));
+
     for (int i = 0; i < num_output_scores; ++i) {
         const int idx = buffer[i];
         const int cls = idx/_num_priors;
@@ -634,21 +606,9 @@ void DetectionOutputImpl::nms_mx(const float* conf_data,
         int &ndetection = detections[cls];
         int *pindices = indices + cls*_num_priors;
 
-        bool keep = true;
-        for (int k = 0; k < ndetection; ++k) {
-            const int kept_idx = pindices[k];
-            float overlap = 0.0f;
-            if (_share_location) {
-                overlap = JaccardOverlap(bboxes, sizes, prior, kept_idx);
-            } else {
-                overlap = JaccardOverlap(bboxes, sizes, cls*_num_priors + prior, cls*_num_priors + kept_idx);
-            }
-            if (overlap > _nms_threshold) {
-                keep = false;
-                break;
-            }
-        }
-        if (keep) {
+        const NmsSelector::Box box = _share_location ? decodedBox(bboxes, sizes, prior)
+                                                     : decodedBox(bboxes, sizes, cls*_num_priors + prior);
+        if (selectors[cls].select(box, prior)) {
             pindices[ndetection++] = prior;
         }
     }
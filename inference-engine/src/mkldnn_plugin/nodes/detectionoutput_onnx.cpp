@@ -12,6 +12,7 @@
 #include <utility>
 #include <algorithm>
 #include "ie_parallel.hpp"
+#include "common/nms.h"
 
 
 namespace {
@@ -44,6 +45,8 @@ namespace InferenceEngine {
 namespace Extensions {
 namespace Cpu {
 
+using MKLDNNPlugin::NmsSelector;
+
 static
 void refine_boxes(const float* boxes, const float* deltas, const float* weights, const float* scores,
                   float* refined_boxes, float* refined_boxes_areas, float* refined_scores,
@@ -136,45 +139,13 @@ struct ConfidenceComparator {
     const float* _conf_data;
 };
 
-static inline float JaccardOverlap(const float *decoded_bbox,
-                                   const float *bbox_sizes,
-                                   const int idx1,
-                                   const int idx2,
-                                   const float coordinates_offset = 1) {
-    float xmin1 = decoded_bbox[idx1 * 4 + 0];
-    float ymin1 = decoded_bbox[idx1 * 4 + 1];
-    float xmax1 = decoded_bbox[idx1 * 4 + 2];
-    float ymax1 = decoded_bbox[idx1 * 4 + 3];
-
-    float xmin2 = decoded_bbox[idx2 * 4 + 0];
-    float ymin2 = decoded_bbox[idx2 * 4 + 1];
-    float ymax2 = decoded_bbox[idx2 * 4 + 3];
-    float xmax2 = decoded_bbox[idx2 * 4 + 2];
-
-    if (xmin2 > xmax1 || xmax2 < xmin1 || ymin2 > ymax1 || ymax2 < ymin1) {
-        return 0.0f;
-    }
-
-    float intersect_xmin = (std::max)(xmin1, xmin2);
-    float intersect_ymin = (std::max)(ymin1, ymin2);
-    float intersect_xmax = (std::min)(xmax1, xmax2);
-    float intersect_ymax = (std::min)(ymax1, ymax2);
-
-    float intersect_width  = intersect_xmax - intersect_xmin + coordinates_offset;
-    float intersect_height = intersect_ymax - intersect_ymin + coordinates_offset;
-
-    if (intersect_width <= 0 || intersect_height <= 0) {
-        return 0.0f;
-    }
-
-    float intersect_size = intersect_width * intersect_height;
-    float bbox1_size = bbox_sizes[idx1];
-    float bbox2_size = bbox_sizes[idx2];
-
-    return intersect_size / (bbox1_size + bbox2_size - intersect_size);
+static inline NmsSelector::Box decodedBox(const float *decoded_bbox,
+                                          const float *bbox_sizes,
+                                          const int idx) {
+    return {decoded_bbox[idx * 4 + 0], decoded_bbox[idx * 4 + 1], decoded_bbox[idx * 4 + 2], decoded_bbox[idx * 4 + 3],
+            bbox_sizes[idx]};
 }
 
-
 static void nms_cf(const float* conf_data,
                           const float* bboxes,
                           const float* sizes,
@@ -200,21 +171,18 @@ static void nms_cf(const float* conf_data,
                            buffer, buffer + num_output_scores,
                            ConfidenceComparator(conf_data));
 
+    std::vector<NmsSelector::Box> candidates(num_output_scores);
+    for (int i = 0; i < num_output_scores; ++i) {
+        candidates[i] = decodedBox(bboxes, sizes, buffer[i]);
+    }
+
+    // The boxes are in pixels, so the sizes of the intersection include the border pixels
+    NmsSelector selector(nms_threshold, false, 1.0f);
+    selector.reset(candidates.data(), candidates.size(), candidates.size());
     detections = 0;
     for (int i = 0; i < num_output_scores; ++i) {
-        const int idx = buffer[i];
-
-        bool keep = true;
-        for (int k = 0; k < detections; ++k) {
-            const int kept_idx = indices[k];
-            float overlap = JaccardOverlap(bboxes, sizes, idx, kept_idx);
-            if (overlap > nms_threshold) {
-                keep = false;
-                break;
-            }
-        }
-        if (keep) {
-            indices[detections] = idx;
+        if (selector.select(candidates[i], buffer[i])) {
+            indices[detections] = buffer[i];
             detections++;
         }
     }
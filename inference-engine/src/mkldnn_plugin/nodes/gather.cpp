@@ -118,22 +118,63 @@ private:
         uint8_t *dst_data = output->cbuffer().as<uint8_t*>() + output->getTensorDesc().getBlockingDesc().getOffsetPadding();
         size_t len = dataLength * dictionary->getTensorDesc().getPrecision().size();
 
-        parallel_for(src_indexSize, [&](size_t i) {
-            unsigned int idx = Conversion()(src_index[i]);
-
-            //  Index clipping
-            if (idx < indexRange) {
-                //  Copying data to destination from Dictionary
-                for (size_t j = 0; j < numDictionaries; j++) {
-                    cpu_memcpy_s(&dst_data[len * (i + j * src_indexSize)],
-                                output->byteSize() - (len * (i + j * src_indexSize)),
-                                &src_dataDict[len * (idx + j * indexRange)],
-                                len);
+        // Single elements (axis is the innermost dimension) are copied as typed values instead of going
+        // through memcpy for every index
+        switch (len) {
+            case 1: gatherElements<index_t, Conversion, uint8_t>(src_index, src_indexSize, src_dataDict, dst_data); return;
+            case 2: gatherElements<index_t, Conversion, uint16_t>(src_index, src_indexSize, src_dataDict, dst_data); return;
+            case 4: gatherElements<index_t, Conversion, uint32_t>(src_index, src_indexSize, src_dataDict, dst_data); return;
+            case 8: gatherElements<index_t, Conversion, uint64_t>(src_index, src_indexSize, src_dataDict, dst_data); return;
+            default: break;
+        }
+
+        // The work is split over both the dictionaries and the indexes so that a gather with a few indexes from
+        // a large number of dictionaries is parallel as well
+        parallel_nt(0, [&](const int ithr, const int nthr) {
+            size_t start = 0, end = 0;
+            splitter(numDictionaries * src_indexSize, nthr, ithr, start, end);
+            if (start >= end)
+                return;
+
+            size_t j = start / src_indexSize;
+            size_t i = start % src_indexSize;
+            for (size_t iwork = start; iwork < end; iwork++) {
+                unsigned int idx = Conversion()(src_index[i]);
+                uint8_t *dst = &dst_data[len * iwork];
+
+                //  Index clipping
+                if (idx < indexRange)
+                    cpu_memcpy(dst, &src_dataDict[len * (idx + j * indexRange)], len);
+                else
+                    memset(dst, 0, len);
+
+                if (++i == src_indexSize) {
+                    i = 0;
+                    j++;
                 }
-            } else {
-                for (size_t j = 0; j < numDictionaries; j++) {
-                    memset(&dst_data[len * (i + j * src_indexSize)], 0, len);
+            }
+        });
+    }
+
+    template <typename index_t, class Conversion, typename data_t>
+    void gatherElements(const index_t *src_index, size_t src_indexSize, const uint8_t *src_dataDict, uint8_t *dst_data) {
+        const data_t *dict = reinterpret_cast<const data_t *>(src_dataDict);
+        data_t *dst = reinterpret_cast<data_t *>(dst_data);
+
+        parallel_nt(0, [&](const int ithr, const int nthr) {
+            size_t start = 0, end = 0;
+            splitter(numDictionaries * src_indexSize, nthr, ithr, start, end);
+            while (start < end) {
+                const size_t j = start / src_indexSize;
+                const size_t i = start % src_indexSize;
+                const size_t count = std::min(src_indexSize - i, end - start);
+                const data_t *dictionary = dict + j * indexRange;
+                data_t *out = dst + start;
+                for (size_t k = 0; k < count; k++) {
+                    unsigned int idx = Conversion()(src_index[i + k]);
+                    out[k] = idx < indexRange ? dictionary[idx] : data_t(0);
                 }
+                start += count;
             }
         });
     }
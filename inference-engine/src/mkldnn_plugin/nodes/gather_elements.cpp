@@ -4,6 +4,7 @@
 
 #include "base.hpp"
 
+#include <algorithm>
 #include <string>
 #include <vector>
 #include "ie_parallel.hpp"
@@ -115,16 +116,21 @@ protected:
             int dstAxIdx = (start / strideAxDst_) % dstAxDim_;
             int dstShift0 = (start / strideAxDst_ / dstAxDim_) * strideAx1Diff_;
 
-            for (size_t o = start; o < end; o++, axStrideIt++) {
-                if (axStrideIt == strideAxDst_) {
-                    axStrideIt = 0;
-                    dstAxIdx++;
-                    if (dstAxIdx == dstAxDim_) {
-                        dstAxIdx = 0;
-                        dstShift0 += strideAx1Diff_;
-                    }
+            // The inner loop walks a contiguous run of the output with a fixed source shift, so it has no
+            // branches and can be vectorized by the compiler
+            for (int o = start; o < end;) {
+                const int runLength = std::min(end - o, strideAxDst_ - axStrideIt);
+                const int shift = dstShift0 - dstAxIdx * strideAxDst_;
+                for (int i = o; i < o + runLength; i++) {
+                    dstData[i] = srcData[i + shift + indices[i] * strideAxDst_];
+                }
+                o += runLength;
+                axStrideIt = 0;
+                dstAxIdx++;
+                if (dstAxIdx == dstAxDim_) {
+                    dstAxIdx = 0;
+                    dstShift0 += strideAx1Diff_;
                 }
-                dstData[o] = srcData[o + dstShift0 + (indices[o] - dstAxIdx) * strideAxDst_];
             }
         };
         parallel_nt(0, threadBody);
@@ -7,7 +7,6 @@
 #include "mkldnn_generic_node.h"
 #include <vector>
 #include <string>
-#include <blob_factory.hpp>
 
 using namespace mkldnn;
 using namespace MKLDNNPlugin;
@@ -65,6 +64,7 @@ void MKLDNNGenericNode::initSupportedPrimitiveDescriptors() {
 
 void MKLDNNGenericNode::createPrimitive() {
     if (extFactory || !impls.empty()) {
+        prepareBlobs();
         return;
     }
     if (getSelectedPrimitiveDescriptor() == nullptr)
@@ -107,51 +107,50 @@ void MKLDNNGenericNode::cleanup() {
     extFactory.reset();
 }
 
-void MKLDNNGenericNode::execLayer() {
-    bool isDynBatch = dynBatchLim > 0;
-    std::vector<InferenceEngine::Blob::Ptr> inputs;
-    std::vector<InferenceEngine::Blob::CPtr> constInputs;
-    std::vector<InferenceEngine::TensorDesc> inputDescs;
-    std::vector<InferenceEngine::SizeVector> outputShapes;
+void MKLDNNGenericNode::prepareBlobs() {
+    inputBlobs.clear();
+    outputBlobs.clear();
+    blobEdges.clear();
+    blobData.clear();
+    blobDescs.clear();
+
     for (size_t i = 0; i < getParentEdges().size(); i++) {
-        auto inputBlob = getParentEdgeAt(i)->getBlob();
-        inputs.push_back(inputBlob);
-        constInputs.push_back(inputBlob);
-        if (isDynBatch && dynBatchLim >= inputs[inputs.size() - 1]->getTensorDesc().getDims()[0]) {
-            isDynBatch = false;
-        } else {
-            // TODO: Ask the right dims using getShape() from previous node
-            inputDescs.push_back(inputs[inputs.size() - 1]->getTensorDesc());
-            if (inputDescs[inputDescs.size() - 1].getDims().size() > 0)
-                inputDescs[inputDescs.size() - 1].getDims()[0] = static_cast<size_t>(batchToProcess());
-        }
+        blobEdges.push_back(getParentEdgeAt(i));
     }
-
-    if (isDynBatch) {
-        // TODO: use ngraph-based extension mechnism if needed to recompute shape
-        isDynBatch = false;
+    for (size_t i = 0; i < outDims.size(); i++) {
+        blobEdges.push_back(getChildEdgesAtPort(i)[0]);
     }
-
-    if (isDynBatch) {
-        for (size_t i = 0; i < inputs.size(); i++) {
-            auto td = inputs[i]->getTensorDesc();
-            td.setDims(inputDescs[i].getDims());
-            inputs[i] = make_blob_with_precision(td, getParentEdgeAt(i)->getMemory().GetData());
-        }
+    for (size_t i = 0; i < blobEdges.size(); i++) {
+        auto blob = blobEdges[i]->getBlob();
+        blobData.push_back(blobEdges[i]->getMemory().GetData());
+        blobDescs.push_back(blobEdges[i]->getMemory().GetDesc());
+        if (i < getParentEdges().size())
+            inputBlobs.push_back(blob);
+        else
+            outputBlobs.push_back(blob);
     }
-    std::vector<InferenceEngine::Blob::Ptr> outputs;
-    for (size_t i = 0; i < outDims.size(); i++) {
-        if (isDynBatch) {
-            auto out_edge = getChildEdgesAtPort(i)[0];
-            auto td = out_edge->getBlob()->getTensorDesc();
-            td.setDims(outputShapes[i]);
-            outputs.push_back(make_blob_with_precision(td, out_edge->getMemory().GetData()));
-        } else {
-            outputs.push_back(getChildEdgesAtPort(i)[0]->getBlob());
-        }
+}
+
+bool MKLDNNGenericNode::blobsArePrepared() const {
+    if (blobEdges.empty())
+        return false;
+    for (size_t i = 0; i < blobEdges.size(); i++) {
+        const auto& memory = blobEdges[i]->getMemory();
+        if (memory.GetData() != blobData[i] || memory.GetDesc() != blobDescs[i])
+            return false;
     }
+    return true;
+}
+
+void MKLDNNGenericNode::execLayer() {
+    // Dynamic batch isn't propagated to extensions: the implementation gets blobs of the full
+    // edge shapes, so the prepared blobs don't depend on the batch to process.
+    // TODO: use ngraph-based extension mechnism if needed to recompute shape
+    if (!blobsArePrepared())
+        prepareBlobs();
+
     InferenceEngine::ResponseDesc resp;
-    InferenceEngine::StatusCode rc = impls[0]->execute(inputs, outputs, &resp);
+    InferenceEngine::StatusCode rc = impls[0]->execute(inputBlobs, outputBlobs, &resp);
     if (rc != InferenceEngine::OK) {
         IE_THROW() << this->getTypeStr() << ":" << this->getName() << ": " << resp.msg;
     }
@@ -36,10 +36,22 @@ public:
 
 
 protected:
+    void prepareBlobs();
+    bool blobsArePrepared() const;
+
     InferenceEngine::ILayerImplFactory::Ptr extFactory;
     std::vector<InferenceEngine::ILayerExecImpl::Ptr> impls;
     std::map<std::string, std::string> params;
     std::map<std::string, InferenceEngine::Blob::Ptr> blobs;
+
+    // Blobs passed to the implementation are wrappers over the edge memory. They are created once
+    // and rebuilt only if an edge memory is rebound to another buffer (e.g. to a user blob) or
+    // recreated with another descriptor.
+    std::vector<InferenceEngine::Blob::Ptr> inputBlobs;
+    std::vector<InferenceEngine::Blob::Ptr> outputBlobs;
+    std::vector<MKLDNNEdgePtr> blobEdges;
+    std::vector<const void*> blobData;
+    std::vector<MKLDNNMemoryDesc> blobDescs;
 };
 
 }  // namespace MKLDNNPlugin
@@ -82,6 +82,10 @@ static void simple_copy(MKLDNNMemory& dst, const MKLDNNMemory& src) {
 
     IE_ASSERT(srcSizeInByte == dstSizeInByte) << "Memory objects are not compatible. Has different sizes.";
 
+    // the edge memory may be bound to the state buffer itself
+    if (srcPtr == dstPtr)
+        return;
+
     cpu_memcpy(dstPtr, srcPtr, srcSizeInByte);
 }
 
@@ -97,7 +101,24 @@ void MKLDNNMemoryInputNode::storeState(const MKLDNNMemory &new_state) {
     // TODO: Should be next one call:
     //           dataStore.SetData(new_state, false);
     //       But because of performance reason we use simple manual copy
-    simple_copy(*dataStore, new_state);
+    simple_copy(stateBound ? *boundNextStore : *dataStore, new_state);
+}
+
+void MKLDNNMemoryInputNode::bindState(void* current, void* next) {
+    if (!boundStore) {
+        boundStore.reset(new MKLDNNMemory{getEngine()});
+        boundStore->Create(dataStore->GetDescriptor(), current);
+        boundNextStore.reset(new MKLDNNMemory{getEngine()});
+        boundNextStore->Create(dataStore->GetDescriptor(), next);
+    } else {
+        boundStore->GetPrimitivePtr()->set_data_handle(current);
+        boundNextStore->GetPrimitivePtr()->set_data_handle(next);
+    }
+    stateBound = true;
+}
+
+void MKLDNNMemoryInputNode::unbindState() {
+    stateBound = false;
 }
 
 void MKLDNNMemoryInputNode::execute(mkldnn::stream strm) {
@@ -105,7 +126,7 @@ void MKLDNNMemoryInputNode::execute(mkldnn::stream strm) {
     // TODO: Should be simple call of:
     //           dst_mem.SetData(dataStore, false);
     //       But because of performance reason we use simple manual copy
-    simple_copy(dst_mem, *dataStore);
+    simple_copy(dst_mem, stateBound ? *boundStore : *dataStore);
 }
 
 MKLDNNMemoryNodeVirtualEdge::Holder* MKLDNNMemoryNodeVirtualEdge::registerInput(MKLDNNMemoryInputNode * node) {
@@ -98,8 +98,27 @@ public:
     void setInputNode(MKLDNNNode* node) override {}
     void storeState(const MKLDNNMemory& mem);
     MKLDNNMemoryPtr getStore();
+
+    /**
+     * Binds state buffers owned by an infer request: the current value is read from `current`
+     * and the paired MemoryOutput node writes the next value to `next`. The buffers are swapped
+     * between inferences by the request, so the state isn't copied in and out of the graph.
+     */
+    void bindState(void* current, void* next);
+
+    /**
+     * Makes the node use its own state memory again. The graph is shared by infer requests, so it
+     * mustn't keep pointers to the buffers of a request after its inference.
+     */
+    void unbindState();
+
  private:
+    // Memory the node owns, it holds the state while no request buffers are bound
     MKLDNNMemoryPtr dataStore;
+    // Wrappers of the current and the next state buffers of the request being inferred
+    MKLDNNMemoryPtr boundStore;
+    MKLDNNMemoryPtr boundNextStore;
+    bool stateBound = false;
     MKLDNNMemoryNodeVirtualEdge::Holder* holder = nullptr;
 };
 
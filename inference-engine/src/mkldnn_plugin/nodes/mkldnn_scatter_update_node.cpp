@@ -18,6 +18,22 @@ using namespace mkldnn;
 using namespace MKLDNNPlugin;
 using namespace InferenceEngine;
 
+namespace {
+
+// Scatters with one-element blocks (update along the innermost axis and ScatterElementsUpdate) store
+// the elements directly instead of calling memcpy for every one of them
+inline void copyBlock(uint8_t *dst, const uint8_t *src, size_t size) {
+    switch (size) {
+        case 1: *dst = *src; break;
+        case 2: *reinterpret_cast<uint16_t*>(dst) = *reinterpret_cast<const uint16_t*>(src); break;
+        case 4: *reinterpret_cast<uint32_t*>(dst) = *reinterpret_cast<const uint32_t*>(src); break;
+        case 8: *reinterpret_cast<uint64_t*>(dst) = *reinterpret_cast<const uint64_t*>(src); break;
+        default: cpu_memcpy(dst, src, size);
+    }
+}
+
+}  // namespace
+
 MKLDNNScatterUpdateNode::MKLDNNScatterUpdateNode(const InferenceEngine::CNNLayerPtr& layer, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache)
         : MKLDNNNode(layer, eng, cache), dataSize(0lu), indicesSize(0lu), axisSize(0lu),
         dataPrec(Precision::UNSPECIFIED), indicesPrec(Precision::UNSPECIFIED), axisPrec(Precision::UNSPECIFIED) {}
@@ -392,7 +408,7 @@ void MKLDNNScatterUpdateNode::scatterUpdate(uint8_t *indices, uint8_t *update, i
         int64_t idxValue = getIndicesValue(indices, idx);
         uint8_t *dstEntry = dstData + (b * srcBlockND[axis] + idxValue * blockToUpdate) * dataSize;
         uint8_t *updateEntry = update + (b * updateBlockND[axis] + idx * blockToUpdate) * dataSize;
-        cpu_memcpy(dstEntry, updateEntry, blockToUpdateSize);
+        copyBlock(dstEntry, updateEntry, blockToUpdateSize);
     });
 }
 
@@ -422,7 +438,7 @@ void MKLDNNScatterUpdateNode::scatterNDUpdate(uint8_t *indices, uint8_t *update,
         }
         dstOffset *= dataSize;
         size_t updateOffset = tupleIdx * sizeToUpdate;
-        cpu_memcpy(dstData + dstOffset, update + updateOffset, sizeToUpdate);
+        copyBlock(dstData + dstOffset, update + updateOffset, sizeToUpdate);
     });
 }
 
@@ -456,8 +472,8 @@ void MKLDNNScatterUpdateNode::scatterElementsUpdate(uint8_t *indices, uint8_t *u
         for (size_t iwork = start; iwork < end; iwork++) {
             int64_t idxValue = getIndicesValue(indices, iwork);
             if (idxValue < srcDataDim[axis])
-                cpu_memcpy(dstData + dataSize * (dst_idx + idxValue * srcBlockND[axis + 1]),
-                            update + iwork * dataSize, dataSize);
+                copyBlock(dstData + dataSize * (dst_idx + idxValue * srcBlockND[axis + 1]),
+                          update + iwork * dataSize, dataSize);
 
             for (j = updateRank - 1; j >= 0; j--) {
                 tensorItr[j]++;
@@ -114,6 +114,81 @@ private:
     int iter_count;
 };
 
+/**
+ * Binds the body port memory to the current chunk of the full tensor instead of copying the chunk.
+ * Applicable only if chunks are dense and have the same layout as the port memory, see is_dense_chunk().
+ */
+class PortSliceBindHelper : public PortMapHelper {
+public:
+    PortSliceBindHelper(const MKLDNNMemoryPtr &full, const std::vector<MKLDNNMemoryPtr> &part_mems,
+                        const InferenceEngine::TensorIterator::PortMap &slice_rule)
+                        : part_mems(part_mems) {
+        auto axis = slice_rule.axis;
+        auto abs_stride = std::abs(slice_rule.stride);
+        auto sign_of_stride = slice_rule.stride < 0 ? -1 : 1;
+        auto full_dims = full->GetDims();
+
+        iter_count = full_dims[axis] / abs_stride;
+
+        full_mem = full->GetPrimitive();
+        chunk_stride_in_byte = static_cast<ptrdiff_t>(full->GetSize() / full_dims[axis] * abs_stride);
+        chunk_offset_in_byte = sign_of_stride < 0 ? (iter_count - 1) * chunk_stride_in_byte : 0;
+        chunk_stride_in_byte *= sign_of_stride;
+
+        full_dims[axis] = abs_stride;
+        IE_ASSERT(full_dims == part_mems[0]->GetDims()) << "Shape mismatch for tensor iterator port";
+    }
+
+    void execute(mkldnn::stream strm, int iter) override {
+        IE_ASSERT(iter >= 0 && iter < iter_count);
+
+        auto chunk_ptr = static_cast<uint8_t *>(full_mem.get_data_handle()) + chunk_offset_in_byte + chunk_stride_in_byte * iter;
+        for (auto &mem : part_mems)
+            mem->GetPrimitivePtr()->set_data_handle(chunk_ptr);
+    }
+
+private:
+    ptrdiff_t chunk_stride_in_byte = 0;
+    ptrdiff_t chunk_offset_in_byte = 0;
+
+    std::vector<MKLDNNMemoryPtr> part_mems;
+    mkldnn::memory full_mem;
+
+    int iter_count;
+};
+
+/**
+ * Implements a back edge by swapping two buffers between the body output and input ports instead of
+ * copying the output to the input before each iteration. Negative iteration index resets the buffers
+ * to the initial binding, so the helper is applied once before loop as well.
+ */
+class BackEdgeSwapHelper : public PortMapHelper {
+public:
+    BackEdgeSwapHelper(const std::vector<MKLDNNMemoryPtr> &from_mems, const std::vector<MKLDNNMemoryPtr> &to_mems,
+                       const mkldnn::engine& eng) : from_mems(from_mems), to_mems(to_mems) {
+        for (auto &buffer : buffers) {
+            buffer.reset(new MKLDNNMemory(eng));
+            buffer->Create(to_mems[0]->GetDescriptor());
+        }
+    }
+
+    void execute(mkldnn::stream strm, int iter) override {
+        if (iter == 0)
+            return;
+        current = iter < 0 ? 0 : current ^ 1;
+
+        for (auto &mem : to_mems)
+            mem->GetPrimitivePtr()->set_data_handle(buffers[current]->GetData());
+        for (auto &mem : from_mems)
+            mem->GetPrimitivePtr()->set_data_handle(buffers[current ^ 1]->GetData());
+    }
+
+private:
+    std::vector<MKLDNNMemoryPtr> from_mems, to_mems;
+    MKLDNNMemoryPtr buffers[2];
+    int current = 0;
+};
+
 class BackEdgePortHelper : public PortMapHelper {
 public:
     BackEdgePortHelper(const MKLDNNMemoryPtr &from, const MKLDNNMemoryPtr &to, const mkldnn::engine& eng) {
@@ -184,6 +259,33 @@ private:
     int value;
 };
 
+/**
+ * Chunks of a plain tensor sliced along the axis are dense if all the dimensions before the axis are 1.
+ * Such a chunk can be bound as the port memory if the port memory is plain as well.
+ */
+static bool is_dense_chunk(const MKLDNNMemoryPtr &full, const MKLDNNMemoryPtr &part, int axis) {
+    auto is_plain = [](const MKLDNNMemoryPtr &mem) {
+        auto dims = mem->GetDims();
+        return MKLDNNMemoryDesc(mem->GetDescriptor()) == MKLDNNMemoryDesc(dims, mem->GetDataType(), MKLDNNMemory::GetPlainFormat(dims));
+    };
+    if (full->GetDataType() != part->GetDataType() || !is_plain(full) || !is_plain(part))
+        return false;
+
+    auto full_dims = full->GetDims();
+    for (int i = 0; i < axis; i++) {
+        if (full_dims[i] != 1)
+            return false;
+    }
+    return true;
+}
+
+static std::vector<MKLDNNMemoryPtr> child_memories(const MKLDNNNodePtr &node) {
+    std::vector<MKLDNNMemoryPtr> mems;
+    for (size_t i = 0; i < node->getChildEdges().size(); i++)
+        mems.push_back(node->getChildEdgeAt(i)->getMemoryPtr());
+    return mems;
+}
+
 }  // namespace MKLDNNPlugin
 
 MKLDNNTensorIteratorNode::MKLDNNTensorIteratorNode(InferenceEngine::CNNLayerPtr layer, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache) :
@@ -205,6 +307,7 @@ void MKLDNNTensorIteratorNode::getSupportedDescriptors() {
         auto &in_node = in_map.at(in_data->getName());
         auto in_mem = in_node->getChildEdgeAt(0)->getMemoryPtr();
         input_mem.push_back(in_mem);
+        input_nodes.push_back(in_node);
     }
 
     // Assume that order of outputs in original TI and produces sub_graph is same
@@ -212,6 +315,7 @@ void MKLDNNTensorIteratorNode::getSupportedDescriptors() {
     for (size_t i = 0; i < out_vec.size(); i++) {
         auto out_mem = out_vec[i]->getParentEdgeAt(0)->getMemoryPtr();
         output_mem.push_back(out_mem);
+        output_nodes.push_back(out_vec[i]);
     }
 }
 
@@ -231,31 +335,62 @@ void MKLDNNTensorIteratorNode::createPrimitive() {
 
     const auto &eng = getEngine();
 
+    // Body ports whose memory is bound to external buffers instead of copying data, which is possible
+    // if the body doesn't use the port memory in-place. Each port can be bound by a single rule.
+    std::vector<bool> input_bound(input_mem.size(), false), output_bound(output_mem.size(), false);
+    auto can_bind_input = [&](int idx) {
+        return !input_bound[idx] && MKLDNNGraph::CanChangeInputMemory(input_nodes[idx]);
+    };
+    auto can_bind_output = [&](int idx) {
+        return !output_bound[idx] && MKLDNNGraph::CanChangeOutputMemory(output_nodes[idx]);
+    };
+    // Applied at the end of before_mappers: back edges copy the output of the previous iteration
+    // before the output is bound to another buffer
+    std::vector<std::shared_ptr<PortMapHelper>> bind_mappers;
+
     for (auto map_rule : ti->input_port_map) {
         auto &from_mem = getParentEdgesAtPort(map_rule.from)[0]->getMemoryPtr();
         auto &to_mem = input_mem[map_rule.to];
 
-        if (map_rule.axis == -1)
+        if (map_rule.axis == -1) {
             first_mappers.emplace_back(new BackEdgePortHelper(from_mem, to_mem, eng));
-        else
+        } else if (is_dense_chunk(from_mem, to_mem, map_rule.axis) && can_bind_input(map_rule.to)) {
+            input_bound[map_rule.to] = true;
+            before_mappers.emplace_back(new PortSliceBindHelper(from_mem, child_memories(input_nodes[map_rule.to]), map_rule));
+        } else {
             before_mappers.emplace_back(new PortIteratorHelper(from_mem, to_mem, true, map_rule, eng));
+        }
     }
 
     for (auto map_rule : ti->output_port_map) {
         auto &to_mem = getChildEdgesAtPort(map_rule.from)[0]->getMemoryPtr();
         auto &from_mem = output_mem[map_rule.to];
 
-        if (map_rule.axis == -1)
+        if (map_rule.axis == -1) {
             last_mappers.emplace_back(new BackEdgePortHelper(from_mem, to_mem, eng));
-        else
+        } else if (is_dense_chunk(to_mem, from_mem, map_rule.axis) && can_bind_output(map_rule.to)) {
+            output_bound[map_rule.to] = true;
+            bind_mappers.emplace_back(new PortSliceBindHelper(to_mem, {from_mem}, map_rule));
+        } else {
             after_mappers.emplace_back(new PortIteratorHelper(from_mem, to_mem, false, map_rule, eng));
+        }
     }
 
     for (auto map_rule : ti->back_edges) {
         auto from_mem = output_mem[map_rule.from];
         auto to_mem = input_mem[map_rule.to];
 
-        before_mappers.emplace_back(new BackEdgePortHelper(from_mem, to_mem, eng));
+        if (MKLDNNMemoryDesc(from_mem->GetDescriptor()) == MKLDNNMemoryDesc(to_mem->GetDescriptor()) &&
+                from_mem->GetData() != to_mem->GetData() && can_bind_input(map_rule.to) && can_bind_output(map_rule.from)) {
+            input_bound[map_rule.to] = true;
+            output_bound[map_rule.from] = true;
+            std::shared_ptr<PortMapHelper> swap(new BackEdgeSwapHelper({from_mem}, child_memories(input_nodes[map_rule.to]), eng));
+            // initial binding has to be done before the initial value is copied to the input
+            first_mappers.insert(first_mappers.begin(), swap);
+            bind_mappers.insert(bind_mappers.begin(), swap);
+        } else {
+            before_mappers.emplace_back(new BackEdgePortHelper(from_mem, to_mem, eng));
+        }
     }
 
     // special purpose ports
@@ -270,6 +405,8 @@ void MKLDNNTensorIteratorNode::createPrimitive() {
         before_mappers.emplace_back(new IterCountPortHelper(to_mem, eng));
     }
 
+    before_mappers.insert(before_mappers.end(), bind_mappers.begin(), bind_mappers.end());
+
     auto condition_port_idx = ti->GetParamAsInt(key_cond_port, -1);
     if (condition_port_idx == -1) {
         continue_cond_check.reset(new staticValueCheck(true)); // always true
@@ -11,12 +11,16 @@
 #include <algorithm>
 #include <utility>
 #include <queue>
+#include <atomic>
 #include "ie_parallel.hpp"
+#include "common/nms.h"
 
 namespace InferenceEngine {
 namespace Extensions {
 namespace Cpu {
 
+using MKLDNNPlugin::NmsSelector;
+
 class NonMaxSuppressionImpl: public ExtLayerBase {
 public:
     explicit NonMaxSuppressionImpl(const CNNLayer* layer) {
@@ -143,39 +147,28 @@ public:
         }
     }
 
-    float intersectionOverUnion(const float *boxesI, const float *boxesJ) {
-        float yminI, xminI, ymaxI, xmaxI, yminJ, xminJ, ymaxJ, xmaxJ;
-        if (boxEncodingType == boxEncoding::CENTER) {
-            //  box format: x_center, y_center, width, height
-            yminI = boxesI[1] - boxesI[3] / 2.f;
-            xminI = boxesI[0] - boxesI[2] / 2.f;
-            ymaxI = boxesI[1] + boxesI[3] / 2.f;
-            xmaxI = boxesI[0] + boxesI[2] / 2.f;
-            yminJ = boxesJ[1] - boxesJ[3] / 2.f;
-            xminJ = boxesJ[0] - boxesJ[2] / 2.f;
-            ymaxJ = boxesJ[1] + boxesJ[3] / 2.f;
-            xmaxJ = boxesJ[0] + boxesJ[2] / 2.f;
-        } else {
-            //  box format: y1, x1, y2, x2
-            yminI = (std::min)(boxesI[0], boxesI[2]);
-            xminI = (std::min)(boxesI[1], boxesI[3]);
-            ymaxI = (std::max)(boxesI[0], boxesI[2]);
-            xmaxI = (std::max)(boxesI[1], boxesI[3]);
-            yminJ = (std::min)(boxesJ[0], boxesJ[2]);
-            xminJ = (std::min)(boxesJ[1], boxesJ[3]);
-            ymaxJ = (std::max)(boxesJ[0], boxesJ[2]);
-            xmaxJ = (std::max)(boxesJ[1], boxesJ[3]);
-        }
-
-        float areaI = (ymaxI - yminI) * (xmaxI - xminI);
-        float areaJ = (ymaxJ - yminJ) * (xmaxJ - xminJ);
-        if (areaI <= 0.f || areaJ <= 0.f)
-            return 0.f;
-
-        float intersection_area =
-            (std::max)((std::min)(ymaxI, ymaxJ) - (std::max)(yminI, yminJ), 0.f) *
-            (std::max)((std::min)(xmaxI, xmaxJ) - (std::max)(xminI, xminJ), 0.f);
-        return intersection_area / (areaI + areaJ - intersection_area);
+    // Boxes are converted once for all the classes, the first axis of the selector is y as the overlap
+    // is computed as (y intersection) * (x intersection)
+    void prepareBoxes(const float *boxes, const SizeVector &boxesStrides) {
+        preparedBoxes.resize(num_batches * num_boxes);
+        parallel_for2d(num_batches, num_boxes, [&](int batch_idx, int box_idx) {
+            const float *box = boxes + batch_idx * boxesStrides[0] + box_idx * 4;
+            NmsSelector::Box &b = preparedBoxes[batch_idx * num_boxes + box_idx];
+            if (boxEncodingType == boxEncoding::CENTER) {
+                //  box format: x_center, y_center, width, height
+                b.min0 = box[1] - box[3] / 2.f;
+                b.min1 = box[0] - box[2] / 2.f;
+                b.max0 = box[1] + box[3] / 2.f;
+                b.max1 = box[0] + box[2] / 2.f;
+            } else {
+                //  box format: y1, x1, y2, x2
+                b.min0 = (std::min)(box[0], box[2]);
+                b.min1 = (std::min)(box[1], box[3]);
+                b.max0 = (std::max)(box[0], box[2]);
+                b.max1 = (std::max)(box[1], box[3]);
+            }
+            b.area = (b.max0 - b.min0) * (b.max1 - b.min1);
+        });
     }
 
     struct filteredBoxes {
@@ -194,8 +187,21 @@ public:
         int suppress_begin_index;
     };
 
-    void nmsWithSoftSigma(const float *boxes, const float *scores, const SizeVector &boxesStrides, const SizeVector &scoresStrides,
-                          std::vector<filteredBoxes> &filtBoxes) {
+    // The (batch, class) pairs take very different time depending on the number of boxes passing the score
+    // threshold, so the threads take them one by one instead of getting equal ranges
+    template <typename F>
+    void forEachBatchClass(const F &func) {
+        const size_t work_amount = num_batches * num_classes;
+        std::atomic<size_t> next_work{0};
+        parallel_nt(0, [&](const int ithr, const int nthr) {
+            NmsSelector selector(iou_threshold, true);
+            for (size_t work = next_work++; work < work_amount; work = next_work++) {
+                func(static_cast<int>(work / num_classes), static_cast<int>(work % num_classes), selector);
+            }
+        });
+    }
+
+    void nmsWithSoftSigma(const float *scores, const SizeVector &scoresStrides, std::vector<filteredBoxes> &filtBoxes) {
         auto less = [](const boxInfo& l, const boxInfo& r) {
             return l.score < r.score || ((l.score == r.score) && (l.idx > r.idx));
         };
@@ -205,9 +211,9 @@ public:
             return iou <= iou_threshold ? weight : 0.0f;
         };
 
-        parallel_for2d(num_batches, num_classes, [&](int batch_idx, int class_idx) {
+        forEachBatchClass([&](int batch_idx, int class_idx, NmsSelector &selector) {
             std::vector<filteredBoxes> fb;
-            const float *boxesPtr = boxes + batch_idx * boxesStrides[0];
+            const NmsSelector::Box *boxesPtr = &preparedBoxes[batch_idx * num_boxes];
             const float *scoresPtr = scores + batch_idx * scoresStrides[0] + class_idx * scoresStrides[1];
 
             std::priority_queue<boxInfo, std::vector<boxInfo>, decltype(less)> sorted_boxes(less);
@@ -216,6 +222,9 @@ public:
                     sorted_boxes.emplace(boxInfo({scoresPtr[box_idx], box_idx, 0}));
             }
 
+            // The scores are decayed by all the overlaps, so the selector is used without the grid
+            selector.reset(nullptr, 0, 0);
+            std::vector<float> ious;
             fb.reserve(sorted_boxes.size());
             if (sorted_boxes.size() > 0) {
                 while (fb.size() < max_output_boxes_per_class && !sorted_boxes.empty()) {
@@ -223,9 +232,12 @@ public:
                     float origScore = currBox.score;
                     sorted_boxes.pop();
 
+                    ious.resize(fb.size());
+                    selector.overlaps(boxesPtr[currBox.idx], currBox.suppress_begin_index, ious.data());
+
                     bool box_is_selected = true;
                     for (int idx = static_cast<int>(fb.size()) - 1; idx >= currBox.suppress_begin_index; idx--) {
-                        float iou = intersectionOverUnion(&boxesPtr[currBox.idx * 4], &boxesPtr[fb[idx].box_index * 4]);
+                        float iou = ious[idx - currBox.suppress_begin_index];
                         currBox.score *= coeff(iou);
                         if (iou >= iou_threshold) {
                             box_is_selected = false;
@@ -239,6 +251,7 @@ public:
                     if (box_is_selected) {
                         if (currBox.score == origScore) {
                             fb.push_back({ currBox.score, batch_idx, class_idx, currBox.idx });
+                            selector.add(boxesPtr[currBox.idx], currBox.idx);
                             continue;
                         }
                         if (currBox.score > score_threshold) {
@@ -255,11 +268,13 @@ public:
         });
     }
 
-    void nmsWithoutSoftSigma(const float *boxes, const float *scores, const SizeVector &boxesStrides, const SizeVector &scoresStrides,
-                             std::vector<filteredBoxes> &filtBoxes) {
-        int max_out_box = static_cast<int>(max_output_boxes_per_class);
-        parallel_for2d(num_batches, num_classes, [&](int batch_idx, int class_idx) {
-            const float *boxesPtr = boxes + batch_idx * boxesStrides[0];
+    void nmsWithoutSoftSigma(const float *scores, const SizeVector &scoresStrides, std::vector<filteredBoxes> &filtBoxes) {
+        auto greater = [](const std::pair<float, int>& l, const std::pair<float, int>& r) {
+            return (l.first > r.first || ((l.first == r.first) && (l.second < r.second)));
+        };
+
+        forEachBatchClass([&](int batch_idx, int class_idx, NmsSelector &selector) {
+            const NmsSelector::Box *boxesPtr = &preparedBoxes[batch_idx * num_boxes];
             const float *scoresPtr = scores + batch_idx * scoresStrides[0] + class_idx * scoresStrides[1];
 
             std::vector<std::pair<float, int>> sorted_boxes;
@@ -268,32 +283,30 @@ public:
                     sorted_boxes.emplace_back(std::make_pair(scoresPtr[box_idx], box_idx));
             }
 
-            int io_selection_size = 0;
-            if (sorted_boxes.size() > 0) {
-                parallel_sort(sorted_boxes.begin(), sorted_boxes.end(),
-                              [](const std::pair<float, int>& l, const std::pair<float, int>& r) {
-                                    return (l.first > r.first || ((l.first == r.first) && (l.second < r.second)));
-                                });
-                int offset = batch_idx*num_classes*max_output_boxes_per_class + class_idx*max_output_boxes_per_class;
-                filtBoxes[offset + 0] = filteredBoxes(sorted_boxes[0].first, batch_idx, class_idx, sorted_boxes[0].second);
-                io_selection_size++;
-                for (size_t box_idx = 1; (box_idx < sorted_boxes.size()) && (io_selection_size < max_out_box); box_idx++) {
-                    bool box_is_selected = true;
-                    for (int idx = io_selection_size - 1; idx >= 0; idx--) {
-                        float iou = intersectionOverUnion(&boxesPtr[sorted_boxes[box_idx].second * 4], &boxesPtr[filtBoxes[offset + idx].box_index * 4]);
-                        if (iou >= iou_threshold) {
-                            box_is_selected = false;
-                            break;
-                        }
-                    }
-
-                    if (box_is_selected) {
-                        filtBoxes[offset + io_selection_size] = filteredBoxes(sorted_boxes[box_idx].first, batch_idx, class_idx, sorted_boxes[box_idx].second);
-                        io_selection_size++;
-                    }
+            selector.reset(boxesPtr, num_boxes, std::min(max_output_boxes_per_class, sorted_boxes.size()));
+
+            // Usually only a small part of the candidates is looked through before max_output_boxes_per_class
+            // boxes are selected, so the candidates are sorted by chunks of growing size when they are needed
+            size_t sorted_end = 0;
+            size_t chunk = std::max<size_t>(4 * max_output_boxes_per_class, 64);
+            for (size_t box_idx = 0; box_idx < sorted_boxes.size() && selector.size() < max_output_boxes_per_class; box_idx++) {
+                if (box_idx == sorted_end) {
+                    sorted_end = std::min(sorted_boxes.size(), sorted_end + chunk);
+                    if (sorted_end < sorted_boxes.size())
+                        std::nth_element(sorted_boxes.begin() + box_idx, sorted_boxes.begin() + sorted_end, sorted_boxes.end(), greater);
+                    std::sort(sorted_boxes.begin() + box_idx, sorted_boxes.begin() + sorted_end, greater);
+                    chunk *= 2;
                 }
+                selector.select(boxesPtr[sorted_boxes[box_idx].second], box_idx);
+            }
+
+            const std::vector<int> &selected = selector.selected();
+            size_t offset = batch_idx*num_classes*max_output_boxes_per_class + class_idx*max_output_boxes_per_class;
+            for (size_t i = 0; i < selected.size(); i++) {
+                const std::pair<float, int> &box = sorted_boxes[selected[i]];
+                filtBoxes[offset + i] = filteredBoxes(box.first, batch_idx, class_idx, box.second);
             }
-            numFiltBox[batch_idx][class_idx] = io_selection_size;
+            numFiltBox[batch_idx][class_idx] = selected.size();
         });
     }
 
@@ -347,10 +360,11 @@ public:
 
         std::vector<filteredBoxes> filtBoxes(max_output_boxes_per_class * num_batches * num_classes);
 
+        prepareBoxes(boxes, boxesStrides);
         if (soft_nms_sigma == 0.0f) {
-            nmsWithoutSoftSigma(boxes, scores, boxesStrides, scoresStrides, filtBoxes);
+            nmsWithoutSoftSigma(scores, scoresStrides, filtBoxes);
         } else {
-            nmsWithSoftSigma(boxes, scores, boxesStrides, scoresStrides, filtBoxes);
+            nmsWithSoftSigma(scores, scoresStrides, filtBoxes);
         }
 
         size_t startOffset = numFiltBox[0][0];
@@ -440,6 +454,7 @@ private:
     float scale = 1.f;
 
     std::vector<std::vector<size_t>> numFiltBox;
+    std::vector<NmsSelector::Box> preparedBoxes;
     const std::string inType = "input", outType = "output";
     std::string logPrefix;
 
@@ -0,0 +1,451 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "topk_imp.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <utility>
+#include <vector>
+#include <ie_parallel.hpp>
+#if defined(HAVE_SSE42) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+#include <immintrin.h>
+#include "nodes/common/uni_simd.h"
+#endif
+
+namespace InferenceEngine {
+namespace Extensions {
+namespace Cpu {
+namespace XARCH {
+
+using Shape = std::vector<size_t>;
+
+#if defined(HAVE_AVX512F)
+constexpr int block_size = 16;
+constexpr int count_vec = 32;
+typedef __m512 vec_type_f;
+typedef __m512i vec_type_i;
+typedef __mmask16 vmask_type;
+#elif defined(HAVE_AVX2)
+constexpr int block_size = 8;
+constexpr int count_vec = 16;
+typedef __m256 vec_type_f;
+typedef __m256i vec_type_i;
+typedef __m256 vmask_type;
+#elif defined(HAVE_SSE42)
+constexpr int block_size = 4;
+constexpr int count_vec = 16;
+typedef __m128 vec_type_f;
+typedef __m128i vec_type_i;
+typedef __m128 vmask_type;
+#endif
+
+inline int count(const Shape& dims, size_t start_ind, size_t end_ind) {
+    size_t count = 1;
+    for (size_t i = start_ind; i < end_ind; i++)
+        count *= dims[i];
+    return static_cast<int>(count);
+}
+
+#if defined(HAVE_SSE42) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+struct cmpgt_ps {
+    static inline vmask_type cmp_ps(const vec_type_f _Left, const vec_type_f _Right) {
+        return _mm_uni_cmpgt_ps(_Left, _Right);
+    }
+};
+
+struct cmplt_ps {
+    static inline vmask_type cmp_ps(const vec_type_f _Left, const vec_type_f _Right) {
+        return _mm_uni_cmpgt_ps(_Right, _Left);
+    }
+};
+
+inline bool any(vmask_type vmask) {
+#if defined(HAVE_AVX512F)
+    return vmask != 0;
+#else
+    return _mm_uni_movemask_ps(vmask) != 0;
+#endif
+}
+
+inline vec_type_i blend_indexes(vec_type_i vindexes, vec_type_i vnew_indexes, vmask_type vmask) {
+#if defined(HAVE_AVX512F)
+    return _mm512_mask_blend_epi32(vmask, vindexes, vnew_indexes);
+#else
+    return _mm_uni_blendv_epi8(vindexes, vnew_indexes, _mm_uni_castps_si(vmask));
+#endif
+}
+#else
+struct cmpgt_ps {};
+struct cmplt_ps {};
+#endif
+
+template <class Compare1, template <typename> class Compare2>
+void top1_axis(const float* src_data, float* dst_data, int* dst_idx, const Shape& in_dims, const topk_conf& conf) {
+    const int dim = static_cast<int>(in_dims[conf.axis]);
+    const int before_num = count(in_dims, 0, conf.axis);
+    int after_num = count(in_dims, conf.axis + 1, in_dims.size());
+    int first_index = 0;
+
+#if defined(HAVE_SSE42) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+    parallel_for2d(before_num, after_num / block_size, [&](int i0, int ib1) {
+        int s_index = i0 * dim * after_num + ib1 * block_size;
+        vec_type_f vmax_val = _mm_uni_loadu_ps(src_data + s_index);
+        vec_type_i vindex_max_val = _mm_uni_setzero_si();
+        for (int i2 = 1; i2 < dim; i2++) {
+            s_index += after_num;
+            vec_type_f vsrc = _mm_uni_loadu_ps(src_data + s_index);
+            vmask_type vmask = Compare1::cmp_ps(vsrc, vmax_val);
+            vmax_val = _mm_uni_blendv_ps(vmax_val, vsrc, vmask);
+
+            vec_type_i vindex_cur_val = _mm_uni_set1_epi32(i2);
+#if defined(HAVE_AVX512F)
+            vindex_max_val = _mm512_mask_blend_epi32(vmask, vindex_max_val, vindex_cur_val);
+#else
+            vindex_max_val = _mm_uni_blendv_epi8(vindex_max_val, vindex_cur_val, _mm_uni_castps_si(vmask));
+#endif
+        }
+        if (dst_data)
+            _mm_uni_storeu_ps(dst_data + i0 * after_num + ib1 * block_size, vmax_val);
+        if (dst_idx)
+            _mm_uni_storeu_si(reinterpret_cast<vec_type_i*>(dst_idx + i0 * after_num + ib1 * block_size), vindex_max_val);
+    });
+    first_index = after_num / block_size * block_size;
+#endif
+    int rest = after_num - first_index;
+    parallel_for2d(before_num, rest, [&](int i0, int i1) {
+        int index_max_val = 0;
+        int s_index = i0 * dim * after_num + first_index + i1;
+        float max_val = src_data[s_index];
+        for (int i2 = 1; i2 < dim; i2++) {
+            s_index += after_num;
+            if (Compare2<float>()(src_data[s_index], max_val)) {
+                max_val = src_data[s_index];
+                index_max_val = i2;
+            }
+        }
+        if (dst_data)
+            dst_data[i0 * after_num + first_index + i1] = max_val;
+        if (dst_idx)
+            dst_idx[i0 * after_num + first_index + i1] = index_max_val;
+    });
+}
+
+// Top1 along the innermost dimension: every lane keeps the first maximum of its elements,
+// the lanes are reduced at the end, so the first maximum of the row is found as by the scalar loop
+template <class Compare1, template <typename> class Compare2>
+void top1(const float* src_data, float* dst_data, int* dst_idx, const Shape& in_dims, const topk_conf& conf) {
+    const int dim = static_cast<int>(in_dims[conf.axis]);
+    const int before_num = count(in_dims, 0, conf.axis);
+    parallel_for(before_num, [&](int i0) {
+        const float* row = src_data + static_cast<size_t>(i0) * dim;
+        int index_max_val = 0;
+        float max_val = row[0];
+        int first_index = 1;
+#if defined(HAVE_SSE42) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+        if (dim >= 2 * block_size) {
+            float lanes[block_size];
+            for (int i = 0; i < block_size; i++)
+                lanes[i] = static_cast<float>(i);
+            vec_type_i vindex_cur_val = _mm_uni_cvtps_epi32(_mm_uni_loadu_ps(lanes));
+            const vec_type_i vindex_step = _mm_uni_set1_epi32(block_size);
+
+            vec_type_f vmax_val = _mm_uni_loadu_ps(row);
+            vec_type_i vindex_max_val = vindex_cur_val;
+            int i1 = block_size;
+            for (; i1 + block_size <= dim; i1 += block_size) {
+                vindex_cur_val = _mm_uni_add_epi32(vindex_cur_val, vindex_step);
+                vec_type_f vsrc = _mm_uni_loadu_ps(row + i1);
+                vmask_type vmask = Compare1::cmp_ps(vsrc, vmax_val);
+                vmax_val = _mm_uni_blendv_ps(vmax_val, vsrc, vmask);
+                vindex_max_val = blend_indexes(vindex_max_val, vindex_cur_val, vmask);
+            }
+
+            int indexes[block_size];
+            _mm_uni_storeu_ps(lanes, vmax_val);
+            _mm_uni_storeu_si(reinterpret_cast<vec_type_i*>(indexes), vindex_max_val);
+            max_val = lanes[0];
+            index_max_val = indexes[0];
+            for (int i = 1; i < block_size; i++) {
+                if (Compare2<float>()(lanes[i], max_val) || (lanes[i] == max_val && indexes[i] < index_max_val)) {
+                    max_val = lanes[i];
+                    index_max_val = indexes[i];
+                }
+            }
+            first_index = i1;
+        }
+#endif
+        for (int i1 = first_index; i1 < dim; i1++) {
+            if (Compare2<float>()(row[i1], max_val)) {
+                max_val = row[i1];
+                index_max_val = i1;
+            }
+        }
+        if (dst_data)
+            dst_data[i0] = max_val;
+        if (dst_idx)
+            dst_idx[i0] = index_max_val;
+    });
+}
+
+// TopK along the innermost dimension. The selected elements are kept in a heap with the worst one on top,
+// which gives the threshold for the rest of the row. Whole vectors are compared with the threshold, so
+// only the few elements passing it are inserted into the heap. That makes the search over large rows
+// (like vocabularies in beam search) close to a single pass over the data.
+template <class Compare1, template <typename> class Compare2>
+void topk(const float* src_data, float* dst_data, int* dst_idx, const Shape& in_dims, const topk_conf& conf) {
+    const int dim = static_cast<int>(in_dims[conf.axis]);
+    const int before_num = count(in_dims, 0, conf.axis);
+    const int src_k = conf.k;
+
+    using Element = std::pair<float, int>;
+    // Of the equal values the element with lower index is selected, as the insertion sort did before
+    auto better = [](const Element& l, const Element& r) {
+        return Compare2<float>()(l.first, r.first) || (l.first == r.first && l.second < r.second);
+    };
+
+    parallel_for(before_num, [&](int i0) {
+        const float* row = src_data + static_cast<size_t>(i0) * dim;
+        std::vector<Element> heap(src_k);
+        for (int i = 0; i < src_k; i++)
+            heap[i] = {row[i], i};
+        std::make_heap(heap.begin(), heap.end(), better);
+
+        auto insert = [&](int i) {
+            if (Compare2<float>()(row[i], heap.front().first)) {
+                std::pop_heap(heap.begin(), heap.end(), better);
+                heap.back() = {row[i], i};
+                std::push_heap(heap.begin(), heap.end(), better);
+            }
+        };
+
+        int i1 = src_k;
+#if defined(HAVE_SSE42) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+        for (; i1 + block_size <= dim; i1 += block_size) {
+            vec_type_f vsrc = _mm_uni_loadu_ps(row + i1);
+            if (!any(Compare1::cmp_ps(vsrc, _mm_uni_set1_ps(heap.front().first))))
+                continue;
+            for (int i = i1; i < i1 + block_size; i++)
+                insert(i);
+        }
+#endif
+        for (; i1 < dim; i1++)
+            insert(i1);
+
+        if (conf.sort_value) {
+            std::sort_heap(heap.begin(), heap.end(), better);
+        } else {
+            std::sort(heap.begin(), heap.end(), [](const Element& l, const Element& r) { return l.second < r.second; });
+        }
+        for (int i2 = 0; i2 < src_k; i2++) {
+            if (dst_data)
+                dst_data[i0 * src_k + i2] = heap[i2].first;
+            if (dst_idx)
+                dst_idx[i0 * src_k + i2] = heap[i2].second;
+        }
+    });
+}
+
+template <class Compare1, template <typename> class Compare2>
+void topk_axis(const float* src_data, float* dst_data, int* dst_idx, const Shape& in_dims, const topk_conf& conf) {
+    const int dim = static_cast<int>(in_dims[conf.axis]);
+    const int before_num = count(in_dims, 0, conf.axis);
+    const int src_k = conf.k;
+    const bool sort_value = conf.sort_value;
+    int after_num = count(in_dims, conf.axis + 1, in_dims.size());
+    int first_index = 0;
+
+#if defined(HAVE_SSE42) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+    if (src_k < count_vec) {
+        parallel_for2d(before_num, after_num / block_size, [&](int i0, int ib1) {
+#if defined(HAVE_AVX512F)
+            const int N = 32;
+            vec_type_f vmax_values[N];
+            vec_type_i vmax_indexes[N];
+#else
+            const int N = 16;
+            vec_type_f vmax_values[N];
+            vec_type_i vmax_indexes[N];
+#endif
+            vec_type_f vtmp;
+            vec_type_i vtmp_indexes;
+            vmask_type vmask;
+            int s_index = i0 * dim * after_num + ib1 * block_size;
+
+            auto vswap_func = [&](int index1, int index2) {
+                vtmp = vmax_values[index1];
+                vmax_values[index1] = _mm_uni_blendv_ps(vmax_values[index1], vmax_values[index2], vmask);
+                vmax_values[index2] = _mm_uni_blendv_ps(vmax_values[index2], vtmp, vmask);
+
+                vtmp_indexes = vmax_indexes[index1];
+#if defined(HAVE_AVX512F)
+                vmax_indexes[index1] = _mm512_mask_blend_epi32(vmask, vmax_indexes[index1], vmax_indexes[index2]);
+                vmax_indexes[index2] = _mm512_mask_blend_epi32(vmask, vmax_indexes[index2], vtmp_indexes);
+#else
+                vmax_indexes[index1] = _mm_uni_blendv_epi8(vmax_indexes[index1], vmax_indexes[index2], _mm_uni_castps_si(vmask));
+                vmax_indexes[index2] = _mm_uni_blendv_epi8(vmax_indexes[index2], vtmp_indexes, _mm_uni_castps_si(vmask));
+#endif
+            };
+
+            for (int i2 = 0; i2 < src_k; i2++) {
+                vmax_values[i2] = _mm_uni_loadu_ps(src_data + s_index);
+                vmax_indexes[i2] = _mm_uni_set1_epi32(i2);
+                s_index += after_num;
+            }
+            for (int i2 = 0; i2 < src_k - 1; i2++) {
+                for (int i3 = src_k - 1; i3 > i2; i3--) {
+                    vmask = Compare1::cmp_ps(vmax_values[i3], vmax_values[i3 - 1]);
+#if defined(HAVE_AVX512F)
+                    if (vmask)
+                        vswap_func(i3, i3 - 1);
+#else
+                    int swap = _mm_uni_movemask_ps(vmask);
+                    if (swap)
+                        vswap_func(i3, i3 - 1);
+#endif
+                }
+            }
+            for (int i2 = src_k; i2 < dim; i2++) {
+                vmax_values[src_k] = _mm_uni_loadu_ps(src_data + s_index);
+                vmax_indexes[src_k] = _mm_uni_set1_epi32(i2);
+                for (int i3 = src_k; i3 > 0; i3--) {
+                    vmask = Compare1::cmp_ps(vmax_values[i3], vmax_values[i3 - 1]);
+#if defined(HAVE_AVX512F)
+                    if (vmask)
+                        vswap_func(i3, i3 - 1);
+                    else
+                        break;
+#else
+                    int swap = _mm_uni_movemask_ps(vmask);
+                    if (swap)
+                        vswap_func(i3, i3 - 1);
+                    else
+                        break;
+#endif
+                }
+                s_index += after_num;
+            }
+            if (!sort_value) {
+                for (int i2 = 0; i2 < src_k - 1; i2++) {
+                    for (int i3 = src_k - 1; i3 > i2; i3--) {
+                        vmask = _mm_uni_cmpgt_i32(vmax_indexes[i3 - 1], vmax_indexes[i3]);
+#if defined(HAVE_AVX512F)
+                        if (vmask)
+                            vswap_func(i3, i3 - 1);
+#else
+                        int swap = _mm_uni_movemask_ps(vmask);
+                        if (swap)
+                            vswap_func(i3, i3 - 1);
+#endif
+                    }
+                }
+            }
+            if (dst_data) {
+                for (int i2 = 0; i2 < src_k; i2++)
+                    _mm_uni_storeu_ps(dst_data + (i0 * src_k + i2) * after_num + ib1 * block_size, vmax_values[i2]);
+            }
+            if (dst_idx) {
+                for (int i2 = 0; i2 < src_k; i2++)
+                    _mm_uni_storeu_si(reinterpret_cast<vec_type_i*>(dst_idx + (i0 * src_k + i2) * after_num + ib1 * block_size), vmax_indexes[i2]);
+            }
+        });
+        first_index = after_num / block_size * block_size;
+    }
+#endif
+    int rest = after_num - first_index;
+    parallel_for2d(before_num, rest, [&](int i0, int i1) {
+        std::vector<float> max_values(src_k + 1);
+        std::vector<int> max_indexes(src_k + 1);
+        float tmp_value;
+        int tmp_index;
+        int s_index = i0 * dim * after_num + first_index + i1;
+
+        auto swap_func = [&](int index1, int index2) {
+            tmp_value = max_values[index1];
+            max_values[index1] = max_values[index2];
+            max_values[index2] = tmp_value;
+
+            tmp_index = max_indexes[index1];
+            max_indexes[index1] = max_indexes[index2];
+            max_indexes[index2] = tmp_index;
+        };
+
+        for (int i2 = 0; i2 < src_k; i2++) {
+            max_values[i2] = src_data[s_index];
+            max_indexes[i2] = i2;
+            s_index += after_num;
+        }
+        for (int i2 = 0; i2 < src_k - 1; i2++) {
+            for (int i3 = src_k - 1; i3 > i2; i3--) {
+                if (Compare2<float>()(max_values[i3], max_values[i3 - 1])) {
+                    swap_func(i3, i3 - 1);
+                }
+            }
+        }
+        for (int i2 = src_k; i2 < dim; i2++) {
+            max_values[src_k] = src_data[s_index];
+            max_indexes[src_k] = i2;
+            for (int i3 = src_k; i3 > 0; i3--) {
+                if (Compare2<float>()(max_values[i3], max_values[i3 - 1]))
+                    swap_func(i3, i3 - 1);
+                else
+                    break;
+            }
+            s_index += after_num;
+        }
+        if (!sort_value) {
+            for (int i2 = 0; i2 < src_k - 1; i2++) {
+                for (int i3 = src_k - 1; i3 > i2; i3--) {
+                    if (std::greater<int>()(max_indexes[i3 - 1], max_indexes[i3])) {
+                        swap_func(i3, i3 - 1);
+                    }
+                }
+            }
+        }
+        if (dst_data) {
+            for (int i2 = 0; i2 < src_k; i2++)
+                dst_data[i0 * src_k * after_num + i2 * after_num + first_index + i1] = max_values[i2];
+        }
+        if (dst_idx) {
+            for (int i2 = 0; i2 < src_k; i2++)
+                dst_idx[i0 * src_k * after_num + i2 * after_num + first_index + i1] = max_indexes[i2];
+        }
+    });
+}
+
+void topk_execute(const float* src_data, float* dst_data, int* dst_idx, std::vector<size_t> dims, topk_conf& conf) {
+    if (conf.k <= 0)
+        return;
+
+    if (conf.k == 1) {
+        if (conf.is_last_dim) {
+            if (conf.mode_max)
+                top1<cmpgt_ps, std::greater>(src_data, dst_data, dst_idx, dims, conf);
+            else
+                top1<cmplt_ps, std::less>(src_data, dst_data, dst_idx, dims, conf);
+        } else {
+            if (conf.mode_max)
+                top1_axis<cmpgt_ps, std::greater>(src_data, dst_data, dst_idx, dims, conf);
+            else
+                top1_axis<cmplt_ps, std::less>(src_data, dst_data, dst_idx, dims, conf);
+        }
+    } else {
+        if (conf.is_last_dim) {
+            if (conf.mode_max)
+                topk<cmpgt_ps, std::greater>(src_data, dst_data, dst_idx, dims, conf);
+            else
+                topk<cmplt_ps, std::less>(src_data, dst_data, dst_idx, dims, conf);
+        } else {
+            if (conf.mode_max)
+                topk_axis<cmpgt_ps, std::greater>(src_data, dst_data, dst_idx, dims, conf);
+            else
+                topk_axis<cmplt_ps, std::less>(src_data, dst_data, dst_idx, dims, conf);
+        }
+    }
+}
+
+}  // namespace XARCH
+}  // namespace Cpu
+}  // namespace Extensions
+}  // namespace InferenceEngine
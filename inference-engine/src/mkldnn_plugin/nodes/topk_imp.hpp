@@ -0,0 +1,28 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cstddef>
+#include <vector>
+
+namespace InferenceEngine {
+namespace Extensions {
+namespace Cpu {
+
+struct topk_conf {
+    size_t axis;
+    int k;
+    bool mode_max;
+    bool sort_value;
+    bool is_last_dim;
+};
+
+namespace XARCH {
+
+void topk_execute(const float* src_data, float* dst_data, int* dst_idx, std::vector<size_t> dims, topk_conf& conf);
+
+}  // namespace XARCH
+
+}  // namespace Cpu
+}  // namespace Extensions
+}  // namespace InferenceEngine
@@ -0,0 +1,41 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "allocation_counter.h"
+
+namespace MKLDNNPlugin {
+
+namespace {
+
+// Plain data is constant initialized, so it's safe to touch it from operator new at any time
+struct CounterState {
+    size_t depth;
+    size_t current;
+    size_t last;
+};
+
+thread_local CounterState counterState = {0, 0, 0};
+
+}  // namespace
+
+AllocationCounter::Scope::Scope() noexcept {
+    if (counterState.depth++ == 0)
+        counterState.current = 0;
+}
+
+AllocationCounter::Scope::~Scope() {
+    if (--counterState.depth == 0)
+        counterState.last = counterState.current;
+}
+
+void AllocationCounter::onAllocation() noexcept {
+    if (counterState.depth != 0)
+        counterState.current++;
+}
+
+size_t AllocationCounter::lastScopeAllocations() noexcept {
+    return counterState.last;
+}
+
+}  // namespace MKLDNNPlugin
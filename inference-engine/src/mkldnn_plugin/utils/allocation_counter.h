@@ -0,0 +1,43 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+
+namespace MKLDNNPlugin {
+
+/**
+ * Debug counter of heap allocations made by a thread inside a scope. MKLDNNGraph::Infer opens
+ * such a scope when built with COUNT_INFER_ALLOCATIONS, so tests are able to check that
+ * a steady-state inference doesn't allocate.
+ *
+ * The plugin doesn't intercept allocations itself: an executable which needs the numbers replaces
+ * the global operator new and reports every allocation with AllocationCounter::onAllocation().
+ * Only the thread which opened the scope is counted, worker threads of parallel regions are not.
+ */
+class AllocationCounter {
+public:
+    /**
+     * Counts allocations of the current thread while alive. Nested scopes are accounted
+     * to the outermost one.
+     */
+    class Scope {
+    public:
+        Scope() noexcept;
+        ~Scope();
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+    };
+
+    static void onAllocation() noexcept;
+
+    /**
+     * Returns the number of allocations made inside the last finished outermost scope of the current thread
+     */
+    static size_t lastScopeAllocations() noexcept;
+};
+
+}  // namespace MKLDNNPlugin
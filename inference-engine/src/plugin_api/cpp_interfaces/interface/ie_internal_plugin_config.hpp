@@ -38,6 +38,43 @@ DECLARE_CONFIG_KEY(LP_TRANSFORMS_MODE);
  */
 DECLARE_CONFIG_KEY(CPU_THREADS_PER_STREAM);
 
+/**
+ * @brief Enables concurrent execution of independent graph branches inside a CPU stream (YES/NO, NO by default)
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_INTEROP_PARALLEL);
+
+/**
+ * @brief Makes CPU graphs lease the memory for intermediate tensors from a workspace pool shared by all networks
+ *        loaded to the plugin, instead of owning it (YES/NO, NO by default). A graph with nodes which may keep
+ *        raw pointers to the intermediate memory, e.g. TensorIterator, owns its memory anyway.
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_SHARED_WORKSPACE);
+
+/**
+ * @brief Defines the algorithm planning the memory of intermediate tensors in the CPU plugin:
+ *        MEMORY_SOLVER_GREEDY (default), MEMORY_SOLVER_BEST_FIT or MEMORY_SOLVER_BEST which tries several
+ *        heuristics and keeps the smallest plan
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_MEMORY_SOLVER);
+
+/**
+ * @brief Values of CPU_MEMORY_SOLVER key
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_VALUE(MEMORY_SOLVER_GREEDY);
+DECLARE_CONFIG_VALUE(MEMORY_SOLVER_BEST_FIT);
+DECLARE_CONFIG_VALUE(MEMORY_SOLVER_BEST);
+
+/**
+ * @brief Makes the CPU plugin fuse mean values and the conversion to FP32 into the input pre-processing, which then
+ *        writes directly to the memory of the graph input (YES/NO, YES by default)
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_FUSED_PREPROCESSING);
+
 /**
  * @brief This key should be used to force disable export while loading network even if global cache dir is defined
  *        Used by HETERO plugin to disable automatic caching of subnetworks (set value to YES)
@@ -47,4 +84,44 @@ DECLARE_CONFIG_KEY(FORCE_DISABLE_CACHE);
 
 }  // namespace PluginConfigInternalParams
 
+namespace Metrics {
+
+/**
+ * @brief Total size in bytes of the CPU workspaces shared by the networks loaded with CPU_SHARED_WORKSPACE
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_METRIC_KEY(CPU_SHARED_WORKSPACE_SIZE, uint64_t);
+
+/**
+ * @brief Number of the CPU shared workspaces, i.e. the maximal number of inferences that leased one at the same time
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_METRIC_KEY(CPU_SHARED_WORKSPACE_COUNT, uint64_t);
+
+/**
+ * @brief Number of leases of the CPU shared workspaces
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_METRIC_KEY(CPU_SHARED_WORKSPACE_LEASES, uint64_t);
+
+/**
+ * @brief Number of leases of the CPU shared workspaces which found all of them leased and had to add a new one
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_METRIC_KEY(CPU_SHARED_WORKSPACE_CONTENDED_LEASES, uint64_t);
+
+/**
+ * @brief Size in bytes of the memory planned for intermediate tensors of a CPU executable network
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_METRIC_KEY(CPU_WORKSPACE_SIZE, uint64_t);
+
+/**
+ * @brief Lower bound of CPU_WORKSPACE_SIZE: the maximal size of the tensors alive at the same time
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_METRIC_KEY(CPU_WORKSPACE_LOWER_BOUND, uint64_t);
+
+}  // namespace Metrics
+
 }  // namespace InferenceEngine
@@ -0,0 +1,34 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief Defines a fast content hash for large memory buffers (e.g. weights)
+ * @file ie_data_hash.hpp
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "ie_api.h"
+
+namespace InferenceEngine {
+
+/**
+ * @brief      Computes 64-bit hash of a memory buffer
+ *             The buffer is split into fixed-size chunks which are hashed in parallel
+ *             with a multiply-based hash and then combined in order. The result depends
+ *             only on the content and the size of the buffer, so it is the same for
+ *             any number of threads and can be stored as a persistent key.
+ * @ingroup    ie_dev_api_memory
+ *
+ * @param data A pointer to the buffer
+ * @param size A number of bytes to hash
+ *
+ * @return 64-bit hash value
+ */
+INFERENCE_ENGINE_API_CPP(uint64_t) data_hash(const void* data, size_t size);
+
+}  // namespace InferenceEngine
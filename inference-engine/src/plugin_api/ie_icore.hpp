@@ -100,6 +100,14 @@ public:
      */
     virtual Parameter GetMetric(const std::string& deviceName, const std::string& name) const = 0;
 
+    /**
+     * @brief Checks whether the networks loaded through Core are exported to the model cache
+     *
+     * Plugins can use it to keep the data needed only for the export just when it's going to be used.
+     * @return `true` if the cache directory is set
+     */
+    virtual bool IsModelCachingEnabled() const = 0;
+
     /**
      * @brief Default virtual destructor
      */
@@ -9,6 +9,7 @@
 
 #pragma once
 
+#include <cstddef>
 #include <memory>
 #include <string>
 
@@ -20,7 +21,8 @@ namespace InferenceEngine {
  * @ingroup ie_dev_api_threading
  * @brief CPU Streams executor implementation. The executor splits the CPU into groups of threads,
  *        that can be pinned to cores or NUMA nodes.
- *        It uses custom threads to pull tasks from single queue.
+ *        Each stream thread has its own task queue, idle threads steal tasks from other queues
+ *        preferring the streams of the same NUMA node.
  */
 class INFERENCE_ENGINE_API_CLASS(CPUStreamsExecutor) : public IStreamsExecutor {
 public:
@@ -48,6 +50,22 @@ public:
 
     int GetNumaNodeId() override;
 
+    /**
+     * @brief Snapshot of the task queues counters
+     */
+    struct QueueStatistics {
+        std::size_t queueDepth = 0;         //!< Number of tasks waiting in the queues
+        std::size_t executedTasks = 0;      //!< Number of tasks taken from the queues by the stream threads
+        std::size_t stolenTasks = 0;        //!< Number of tasks taken from a queue of another stream
+        std::size_t remoteStolenTasks = 0;  //!< Number of tasks taken from a stream of another NUMA node
+    };
+
+    /**
+     * @brief Returns the task queues counters
+     * @return Counters values at the moment of the call
+     */
+    QueueStatistics GetQueueStatistics() const;
+
 private:
     struct Impl;
     std::unique_ptr<Impl> _impl;
@@ -29,6 +29,11 @@ class PreProcessData : public IPreProcessData {
      */
     std::shared_ptr<PreprocEngine> _preproc;
 
+    /**
+     * @brief Per-channel mean and scale applied by the same pass.
+     */
+    PreprocEngine::Normalization _normalization;
+
 public:
     void setRoiBlob(const Blob::Ptr &blob) override;
 
@@ -37,6 +42,8 @@ public:
     void execute(Blob::Ptr &preprocessedBlob, const PreProcessInfo &info, bool serial, int batchSize = -1) override;
 
     void isApplicable(const Blob::Ptr &src, const Blob::Ptr &dst) override;
+
+    void setNormalization(const std::vector<float> &mean, const std::vector<float> &scale) override;
 };
 
 INFERENCE_PRERPOC_PLUGIN_API(void) CreatePreProcessData(std::shared_ptr<IPreProcessData>& data);
@@ -70,11 +77,15 @@ void PreProcessData::execute(Blob::Ptr &preprocessedBlob, const PreProcessInfo &
         _preproc.reset(new PreprocEngine);
     }
 
-    _preproc->preprocessWithGAPI(_userBlob, preprocessedBlob, algorithm, fmt, serial, batchSize);
+    _preproc->preprocessWithGAPI(_userBlob, preprocessedBlob, algorithm, fmt, serial, batchSize, _normalization);
 }
 
 void PreProcessData::isApplicable(const Blob::Ptr &src, const Blob::Ptr &dst) {
     PreprocEngine::checkApplicabilityGAPI(src, dst);
 }
 
+void PreProcessData::setNormalization(const std::vector<float> &mean, const std::vector<float> &scale) {
+    _normalization = PreprocEngine::Normalization{mean, scale};
+}
+
 }  // namespace InferenceEngine
@@ -7,6 +7,7 @@
 #include <map>
 #include <string>
 #include <memory>
+#include <vector>
 
 #include <ie_blob.h>
 #include <file_utils.h>
@@ -59,6 +60,14 @@ public:
     //FIXME: rename to verifyAplicable
     virtual void isApplicable(const Blob::Ptr &src, const Blob::Ptr &dst) = 0;
 
+    /**
+     * @brief Sets per-channel normalization fused into pre-processing: out = (in - mean[c]) * scale[c].
+     * The pre-processed blob must be FP32 then. Empty mean disables the normalization.
+     * @param mean per-channel mean values.
+     * @param scale per-channel scale values, empty means 1 for all channels.
+     */
+    virtual void setNormalization(const std::vector<float> &mean, const std::vector<float> &scale) = 0;
+
 protected:
     ~IPreProcessData() = default;
 };
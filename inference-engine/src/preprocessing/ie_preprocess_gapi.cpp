@@ -551,11 +551,23 @@ cv::GComputation buildGraph(const G::Desc &in_desc,
                             Layout out_layout,
                             ResizeAlgorithm algorithm,
                             ColorFormat input_color_format,
-                            ColorFormat output_color_format) {
+                            ColorFormat output_color_format,
+                            const std::vector<float>& mean,
+                            const std::vector<float>& scale) {
     // perform basic validation to ensure our assumptions about input and output are correct
     validateColorFormats(in_desc, out_desc, in_layout, out_layout, input_color_format,
         output_color_format);
 
+    const bool normalize = !mean.empty();
+    if (normalize) {
+        if (out_desc.prec != CV_32F) {
+            IE_THROW() << "[G-API] internal error: normalization requires FP32 output";
+        }
+        if (mean.size() != static_cast<size_t>(out_desc.d.C) || (!scale.empty() && scale.size() != mean.size())) {
+            IE_THROW() << "[G-API] internal error: normalization values don't match the number of channels";
+        }
+    }
+
     std::vector<cv::GMat> inputs;  // 1 element if NHWC, C elements if NCHW
     if (in_layout == NHWC) {
         inputs.resize(1);
@@ -574,7 +586,8 @@ cv::GComputation buildGraph(const G::Desc &in_desc,
     const auto io_color_formats = std::make_tuple(input_color_format, output_color_format);
     const bool drop_channel = (io_color_formats == std::make_tuple(ColorFormat::RGBX, ColorFormat::RGB)) ||
                               (io_color_formats == std::make_tuple(ColorFormat::BGRX, ColorFormat::BGR));
-    const bool specific_case_of_preproc = ((in_layout == NHWC || specific_yuv420_input_handling)
+    const bool specific_case_of_preproc = !normalize
+                                        && ((in_layout == NHWC || specific_yuv420_input_handling)
                                         && (in_desc.d.C == 3 || specific_yuv420_input_handling || drop_channel)
                                         && ((in_desc.prec == CV_8U) && (in_desc.prec == out_desc.prec))
                                         && (algorithm == RESIZE_BILINEAR)
@@ -666,7 +679,12 @@ cv::GComputation buildGraph(const G::Desc &in_desc,
         outputs = planes;
     }
 
-    if ((in_desc.prec != out_desc.prec) || need_tmp_prec_conv) {
+    if (normalize) {
+        // the conversion to float is done by the same pass
+        for (size_t c = 0; c < outputs.size(); c++) {
+            outputs[c] = gapi::Normalize::on(outputs[c], mean[c], scale.empty() ? 1.0f : scale[c]);
+        }
+    } else if ((in_desc.prec != out_desc.prec) || need_tmp_prec_conv) {
         auto convert_prec = [](const std::vector<cv::GMat> & src_gmats, int dst_precision) {
             std::vector<cv::GMat> dst_gmats;
             std::transform(src_gmats.begin(), src_gmats.end(), std::back_inserter(dst_gmats), [&](cv::GMat const& m){
@@ -697,6 +715,7 @@ PreprocEngine::Update PreprocEngine::needUpdate(const CallDesc &newCallOrig) con
     // 3. algorithm has changed (affects kernel version)
     // 4. dimensions have changed from downscale to upscale or vice-versa if interpolation is AREA
     // 5. color format has changed (affects graph topology)
+    // 6. normalization values have changed (they are the kernel parameters)
     if (!_lastCall) {
         return Update::REBUILD;
     }
@@ -704,13 +723,15 @@ PreprocEngine::Update PreprocEngine::needUpdate(const CallDesc &newCallOrig) con
     BlobDesc last_in;
     BlobDesc last_out;
     ResizeAlgorithm last_algo = ResizeAlgorithm::NO_RESIZE;
-    std::tie(last_in, last_out, last_algo) = *_lastCall;
+    Normalization last_norm;
+    std::tie(last_in, last_out, last_algo, last_norm) = *_lastCall;
 
     CallDesc newCall = newCallOrig;
     BlobDesc new_in;
     BlobDesc new_out;
     ResizeAlgorithm new_algo = ResizeAlgorithm::NO_RESIZE;
-    std::tie(new_in, new_out, new_algo) = newCall;
+    Normalization new_norm;
+    std::tie(new_in, new_out, new_algo, new_norm) = newCall;
 
     // Declare two empty vectors per each call
     SizeVector last_in_size;
@@ -726,7 +747,7 @@ PreprocEngine::Update PreprocEngine::needUpdate(const CallDesc &newCallOrig) con
     new_out_size.swap(std::get<2>(new_out));
 
     // If anything (except input sizes) changes, rebuild is required
-    if (last_in != new_in || last_out != new_out || last_algo != new_algo) {
+    if (last_in != new_in || last_out != new_out || last_algo != new_algo || last_norm != new_norm) {
         return Update::REBUILD;
     }
 
@@ -898,8 +919,8 @@ void PreprocEngine::executeGraph(Opt<cv::GComputation>& lastComputation,
 
 template<typename BlobTypePtr>
 void PreprocEngine::preprocessBlob(const BlobTypePtr &inBlob, MemoryBlob::Ptr &outBlob,
-    ResizeAlgorithm algorithm, ColorFormat in_fmt, ColorFormat out_fmt, bool omp_serial,
-    int batch_size) {
+    ResizeAlgorithm algorithm, ColorFormat in_fmt, ColorFormat out_fmt, const Normalization& normalization,
+    bool omp_serial, int batch_size) {
 
     validateBlob(inBlob);
 
@@ -941,9 +962,10 @@ void PreprocEngine::preprocessBlob(const BlobTypePtr &inBlob, MemoryBlob::Ptr &o
                                             out_layout,
                                             out_desc_ie.getDims(),
                                             out_fmt },
-                                  algorithm };
+                                  algorithm,
+                                  normalization };
 
-    if (algorithm == NO_RESIZE && std::get<0>(thisCall) == std::get<1>(thisCall)) {
+    if (algorithm == NO_RESIZE && std::get<0>(thisCall) == std::get<1>(thisCall) && std::get<0>(normalization).empty()) {
         //if requested output parameters match input blob no need to do anything
         IE_THROW()  << "No job to do in the PreProcessing ?";
     }
@@ -966,7 +988,9 @@ void PreprocEngine::preprocessBlob(const BlobTypePtr &inBlob, MemoryBlob::Ptr &o
                            out_layout,
                            algorithm,
                            in_fmt,
-                           out_fmt));
+                           out_fmt,
+                           std::get<0>(normalization),
+                           std::get<1>(normalization)));
         }
     }
 
@@ -978,7 +1002,8 @@ void PreprocEngine::preprocessBlob(const BlobTypePtr &inBlob, MemoryBlob::Ptr &o
 }
 
 void PreprocEngine::preprocessWithGAPI(const Blob::Ptr &inBlob, Blob::Ptr &outBlob,
-        const ResizeAlgorithm& algorithm, ColorFormat in_fmt, bool omp_serial, int batch_size) {
+        const ResizeAlgorithm& algorithm, ColorFormat in_fmt, bool omp_serial, int batch_size,
+        const Normalization& normalization) {
     const auto out_fmt = (in_fmt == ColorFormat::RAW) ? ColorFormat::RAW : ColorFormat::BGR;  // FIXME: get expected color format from network
 
     // output is always a memory blob
@@ -997,8 +1022,8 @@ void PreprocEngine::preprocessWithGAPI(const Blob::Ptr &inBlob, Blob::Ptr &outBl
             IE_THROW()  << "Unsupported input blob for color format " << in_fmt
                                 << ": expected NV12Blob";
         }
-        return preprocessBlob(inNV12Blob, outMemoryBlob, algorithm, in_fmt, out_fmt, omp_serial,
-            batch_size);
+        return preprocessBlob(inNV12Blob, outMemoryBlob, algorithm, in_fmt, out_fmt, normalization,
+            omp_serial, batch_size);
     }
     case ColorFormat::I420: {
         auto inI420Blob = as<I420Blob>(inBlob);
@@ -1006,8 +1031,8 @@ void PreprocEngine::preprocessWithGAPI(const Blob::Ptr &inBlob, Blob::Ptr &outBl
             IE_THROW()  << "Unsupported input blob for color format " << in_fmt
                                 << ": expected I420Blob";
         }
-        return preprocessBlob(inI420Blob, outMemoryBlob, algorithm, in_fmt, out_fmt, omp_serial,
-            batch_size);
+        return preprocessBlob(inI420Blob, outMemoryBlob, algorithm, in_fmt, out_fmt, normalization,
+            omp_serial, batch_size);
     }
 
     default:
@@ -1016,8 +1041,8 @@ void PreprocEngine::preprocessWithGAPI(const Blob::Ptr &inBlob, Blob::Ptr &outBl
             IE_THROW()  << "Unsupported input blob for color format " << in_fmt
                                 << ": expected MemoryBlob";
         }
-        return preprocessBlob(inMemoryBlob, outMemoryBlob, algorithm, in_fmt, out_fmt, omp_serial,
-            batch_size);
+        return preprocessBlob(inMemoryBlob, outMemoryBlob, algorithm, in_fmt, out_fmt, normalization,
+            omp_serial, batch_size);
     }
 }
 }  // namespace InferenceEngine
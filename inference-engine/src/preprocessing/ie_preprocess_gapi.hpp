@@ -21,8 +21,12 @@
 namespace InferenceEngine {
 
 class PreprocEngine {
+public:
+    using Normalization = std::tuple<std::vector<float>, std::vector<float>>;  // per-channel mean and scale
+
+private:
     using BlobDesc = std::tuple<Precision, Layout, SizeVector, ColorFormat>;
-    using CallDesc = std::tuple<BlobDesc, BlobDesc, ResizeAlgorithm>;
+    using CallDesc = std::tuple<BlobDesc, BlobDesc, ResizeAlgorithm, Normalization>;
     template<typename T> using Opt = cv::util::optional<T>;
 
     Opt<CallDesc> _lastCall;
@@ -45,15 +49,16 @@ class PreprocEngine {
 
     template<typename BlobTypePtr>
     void preprocessBlob(const BlobTypePtr &inBlob, MemoryBlob::Ptr &outBlob,
-        ResizeAlgorithm algorithm, ColorFormat in_fmt, ColorFormat out_fmt, bool omp_serial,
-        int batch_size);
+        ResizeAlgorithm algorithm, ColorFormat in_fmt, ColorFormat out_fmt, const Normalization& normalization,
+        bool omp_serial, int batch_size);
 
 public:
     PreprocEngine();
     static void checkApplicabilityGAPI(const Blob::Ptr &src, const Blob::Ptr &dst);
     static int getCorrectBatchSize(int batch_size, const Blob::Ptr& roiBlob);
     void preprocessWithGAPI(const Blob::Ptr &inBlob, Blob::Ptr &outBlob, const ResizeAlgorithm &algorithm,
-        ColorFormat in_fmt, bool omp_serial, int batch_size = -1);
+        ColorFormat in_fmt, bool omp_serial, int batch_size = -1,
+        const Normalization& normalization = {});
 };
 
 }  // namespace InferenceEngine
@@ -2461,6 +2461,43 @@ GAPI_FLUID_KERNEL(FConvertDepth, ConvertDepth, false) {
     }
 };
 
+namespace {
+
+template <typename src_t>
+void normalize_row(const uint8_t* src, float* dst, const int width, const float mean, const float scale) {
+    const auto *in = reinterpret_cast<const src_t *>(src);
+
+    for (int i = 0; i < width; i++) {
+        dst[i] = (static_cast<float>(in[i]) - mean) * scale;
+    }
+}
+
+}  // namespace
+
+// Converts the plane to float and normalizes it in the same pass
+GAPI_FLUID_KERNEL(FNormalize, Normalize, false) {
+    static const int Window = 1;
+
+    static void run(const cv::gapi::fluid::View& src, float mean, float scale, cv::gapi::fluid::Buffer& dst) {
+        GAPI_Assert(src.meta().depth == CV_8U || src.meta().depth == CV_32F || src.meta().depth == CV_16U);
+        GAPI_Assert(dst.meta().depth == CV_32F);
+        GAPI_Assert(src.meta().chan == 1);
+        GAPI_Assert(dst.meta().chan == 1);
+        GAPI_Assert(src.length() == dst.length());
+
+        const auto *in  = src.InLineB(0);
+              auto *out = dst.OutLine<float>();
+        auto const width = dst.length();
+
+        switch (src.meta().depth) {
+            case CV_8U:  normalize_row<uint8_t>(in, out, width, mean, scale);  break;
+            case CV_16U: normalize_row<uint16_t>(in, out, width, mean, scale); break;
+            case CV_32F: normalize_row<float>(in, out, width, mean, scale);    break;
+            default: GAPI_Assert(!"not supported depth");
+        }
+    }
+};
+
 }  // namespace kernels
 
 //----------------------------------------------------------------------
@@ -2488,6 +2525,7 @@ cv::gapi::GKernelPackage preprocKernels() {
         , FNV12toRGB
         , FI420toRGB
         , FConvertDepth
+        , FNormalize
         >();
 }
 
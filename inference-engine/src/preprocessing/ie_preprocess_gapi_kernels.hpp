@@ -152,6 +152,15 @@ namespace gapi {
         }
     };
 
+    G_TYPED_KERNEL(Normalize, <cv::GMat(cv::GMat, float mean, float scale)>, "com.intel.ie.Normalize") {
+        static cv::GMatDesc outMeta(const cv::GMatDesc& in, float, float) {
+            GAPI_Assert(in.depth == CV_8U || in.depth == CV_16U || in.depth == CV_32F);
+            GAPI_Assert(in.chan == 1);
+
+            return in.withDepth(CV_32F);
+        }
+    };
+
 
 
     cv::gapi::GKernelPackage preprocKernels();
@@ -294,7 +294,7 @@ std::vector<BatchNum> BlobCopy_BatchNum = {
 };
 
 std::vector<ChannelNum > BlobCopy_ChannelNum = {
-        3, 7,
+        1, 3, 4, 7, 16, 32,
 };
 
 std::vector<Dims> BlobCopy_Dims = {
@@ -302,10 +302,11 @@ std::vector<Dims> BlobCopy_Dims = {
         {{60, 80}},
 };
 
-//  The 'blob_copy(4/5)_d' function is a template with the parameter-list  <InferenceEngine::Precision::ePrecision PRC>
-//  FP32 is used for cases with the following accuracy:  FP32, I32, U32
-//  FP16 is used for cases with the following accuracy:  FP16, U16, I16
-//  U8 is used for cases with the following accuracy:  U8, I8
+//  The 'blob_copy' function only moves the elements, so it is dispatched by the element size
+//  8 bytes: FP64, I64, U64
+//  4 bytes: FP32, I32, U32
+//  2 bytes: FP16, BF16, U16, I16
+//  1 byte:  U8, I8
 //  Cases with other precision are not supported
 std::vector<PrecisionType> BlobCopy_PrecisionParams = {
         InferenceEngine::Precision::FP32,
@@ -316,6 +317,9 @@ std::vector<PrecisionType> BlobCopy_PrecisionParams = {
         InferenceEngine::Precision::I16,
         InferenceEngine::Precision::U32,
         InferenceEngine::Precision::I32,
+        InferenceEngine::Precision::FP64,
+        InferenceEngine::Precision::U64,
+        InferenceEngine::Precision::I64,
 };
 
 }  // namespace
@@ -472,3 +476,114 @@ INSTANTIATE_TEST_CASE_P(accuracy, BlobCopySetLayoutTest,
     ::testing::Combine(::testing::ValuesIn(BlobCopySetLayout_Dims),
                        ::testing::ValuesIn(BlobCopySetLayout_Precisions)));
 
+
+namespace {
+
+std::vector<ChannelNum> BlobCopyROI_ChannelNum = {
+    1, 3, 4, 16,
+};
+
+std::vector<PrecisionType> BlobCopyROI_Precisions = {
+    Precision::U8,
+    Precision::FP16,
+    Precision::FP32,
+    Precision::I64,
+};
+
+}  // namespace
+
+using BlobCopyROITest = ::testing::TestWithParam<std::tuple<IsInterleaved, IsInterleaved, ChannelNum, PrecisionType>>;
+
+TEST_P(BlobCopyROITest, BlobCopyFromROI) {
+    const IsInterleaved srcIsInterleaved = get<0>(GetParam());
+    const IsInterleaved dstIsInterleaved = get<1>(GetParam());
+    const ChannelNum channelNum = get<2>(GetParam());
+    const Precision precision = get<3>(GetParam());
+
+    const size_t H = 60, W = 80;
+    const ROI roi(0, 7, 5, W - 20, H - 10);  // id, posX, posY, sizeX, sizeY
+
+    auto parent = createBlob(precision, {1, channelNum, H, W}, setLayout(srcIsInterleaved, 2));
+    parent->allocate();
+    FillBlob(parent);
+
+    auto srcBlob = make_shared_blob(parent, roi);
+    auto dstBlob = createBlob(precision, srcBlob->getTensorDesc().getDims(), setLayout(dstIsInterleaved, 2));
+    dstBlob->allocate();
+
+    blob_copy(srcBlob, dstBlob);
+
+    ASSERT_TRUE(IsCorrectBlobCopy(srcBlob, dstBlob)) << "'blob_copy' from ROI blob is not correct";
+}
+
+INSTANTIATE_TEST_CASE_P(accuracy, BlobCopyROITest,
+    ::testing::Combine(::testing::Values(true, false),
+                       ::testing::Values(true, false),
+                       ::testing::ValuesIn(BlobCopyROI_ChannelNum),
+                       ::testing::ValuesIn(BlobCopyROI_Precisions)));
+
+namespace {
+
+// the shapes met in the pre-processing of the typical CV models
+std::vector<Dims> BlobCopyPerf_Dims = {
+    {{224, 224}},
+    {{480, 640}},
+    {{16, 112, 112}},
+};
+
+std::vector<ChannelNum> BlobCopyPerf_ChannelNum = {
+    1, 3, 4, 16, 32,
+};
+
+std::vector<PrecisionType> BlobCopyPerf_Precisions = {
+    Precision::U8,
+    Precision::FP16,
+    Precision::FP32,
+};
+
+}  // namespace
+
+using BlobCopyPerfTest = ::testing::TestWithParam<std::tuple<IsInterleaved, ChannelNum, Dims, PrecisionType>>;
+
+// Prints the average time of the layout conversion in both directions, not a pass/fail benchmark
+TEST_P(BlobCopyPerfTest, BlobCopyTime) {
+    const IsInterleaved srcIsInterleaved = get<0>(GetParam());
+    const ChannelNum channelNum = get<1>(GetParam());
+    const Dims dims = get<2>(GetParam());
+    const PrecisionType precisionType = get<3>(GetParam());
+    const int iterations = 10;
+
+    const SizeVector blobDims = SetDimVector(1, channelNum, dims);
+    const InferenceEngine::Layout srcLayout = setLayout(srcIsInterleaved, dims.size());
+    const InferenceEngine::Layout dstLayout = setLayout(!srcIsInterleaved, dims.size());
+
+    PrintParams(srcLayout, blobDims, "src", precisionType);
+    PrintParams(dstLayout, blobDims, "dst", precisionType);
+
+    Blob::Ptr srcBlob = createBlob(precisionType, blobDims, srcLayout);
+    Blob::Ptr dstBlob = createBlob(precisionType, blobDims, dstLayout);
+    srcBlob->allocate();
+    dstBlob->allocate();
+    FillBlob(srcBlob);
+
+    // warm up the caches and the threading runtime
+    blob_copy(srcBlob, dstBlob);
+
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < iterations; i++) {
+        blob_copy(srcBlob, dstBlob);
+    }
+    auto finish = std::chrono::high_resolution_clock::now();
+
+    std::cout << "Blob_copy average execution time : "
+              << std::chrono::duration_cast<std::chrono::microseconds>(finish - start).count() / iterations
+              << " micros" << std::endl;
+
+    ASSERT_TRUE(IsCorrectBlobCopy(srcBlob, dstBlob)) << "'blob_copy' function is not correct";
+}
+
+INSTANTIATE_TEST_CASE_P(performance, BlobCopyPerfTest,
+    ::testing::Combine(::testing::Values(true, false),
+                       ::testing::ValuesIn(BlobCopyPerf_ChannelNum),
+                       ::testing::ValuesIn(BlobCopyPerf_Dims),
+                       ::testing::ValuesIn(BlobCopyPerf_Precisions)));
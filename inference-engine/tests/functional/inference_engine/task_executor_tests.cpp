@@ -3,6 +3,7 @@
 //
 
 #include <future>
+#include <thread>
 
 #include <gtest/gtest.h>
 
@@ -186,6 +187,61 @@ TEST_P(ASyncTaskExecutorTests, runAndWaitDoesNotOwnTasks) {
     ASSERT_EQ(1, useCount);
 }
 
+TEST(CPUStreamsExecutorTests, queueStatisticsCountsAllTasks) {
+    constexpr int NUMBER_OF_TASKS = 100;
+    auto taskExecutor = std::make_shared<CPUStreamsExecutor>(IStreamsExecutor::Config{"TestCPUStreamsExecutor",
+                                                             2, 1, IStreamsExecutor::ThreadBindingType::NONE});
+    std::atomic_int sharedVar = {0};
+    std::vector<Future> futures;
+    for (int i = 0; i < NUMBER_OF_TASKS; i++) {
+        futures.emplace_back(async(taskExecutor, [&] { ++sharedVar; }));
+    }
+    for (auto&& f : futures) f.wait();
+
+    auto statistics = taskExecutor->GetQueueStatistics();
+    ASSERT_EQ(NUMBER_OF_TASKS, sharedVar);
+    ASSERT_EQ(0u, statistics.queueDepth);
+    ASSERT_EQ(static_cast<std::size_t>(NUMBER_OF_TASKS), statistics.executedTasks);
+    ASSERT_LE(statistics.stolenTasks, statistics.executedTasks);
+    ASSERT_LE(statistics.remoteStolenTasks, statistics.stolenTasks);
+}
+
+TEST(CPUStreamsExecutorTests, workerThreadsUseStreamIdsOfTheirQueues) {
+    constexpr int NUMBER_OF_TASKS = 100;
+    constexpr int NUMBER_OF_STREAMS = 4;
+    auto taskExecutor = std::make_shared<CPUStreamsExecutor>(IStreamsExecutor::Config{"TestCPUStreamsExecutor",
+                                                             NUMBER_OF_STREAMS, 1, IStreamsExecutor::ThreadBindingType::NONE});
+    std::atomic_int outOfRange = {0};
+    std::vector<Future> futures;
+    for (int i = 0; i < NUMBER_OF_TASKS; i++) {
+        futures.emplace_back(async(taskExecutor, [&] {
+            auto streamId = taskExecutor->GetStreamId();
+            if (streamId < 0 || streamId >= NUMBER_OF_STREAMS) ++outOfRange;
+        }));
+    }
+    for (auto&& f : futures) f.wait();
+    ASSERT_EQ(0, outOfRange);
+}
+
+TEST(CPUStreamsExecutorTests, callerThreadsUseStreamIdsInRange) {
+    // a synchronous Infer() runs on the calling thread and indexes per-stream graphs with its stream id
+    auto taskExecutor = std::make_shared<CPUStreamsExecutor>(IStreamsExecutor::Config{"TestCPUStreamsExecutor",
+                                                             1, 1, IStreamsExecutor::ThreadBindingType::NONE});
+    auto workerStreamId = -1;
+    async(taskExecutor, [&] { workerStreamId = taskExecutor->GetStreamId(); }).wait();
+    ASSERT_EQ(0, workerStreamId);
+    ASSERT_EQ(0, taskExecutor->GetStreamId());
+    std::atomic_int outOfRange = {0};
+    std::vector<std::thread> callers;
+    for (int i = 0; i < 4; i++) {
+        callers.emplace_back([&] {
+            if (taskExecutor->GetStreamId() != 0) ++outOfRange;
+        });
+    }
+    for (auto&& caller : callers) caller.join();
+    ASSERT_EQ(0, outOfRange);
+}
+
 static auto Executors = ::testing::Values(
     [] {
         auto streams = getNumberOfCPUCores();
@@ -0,0 +1,63 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "import_export_tests/import_reshape_permute_conv.hpp"
+#include "common_test_utils/file_utils.hpp"
+
+using namespace LayerTestsDefinitions;
+
+namespace {
+
+// CPU plugin keeps the network for the export only while the model cache is enabled
+class ImportReshapePermuteConvCPU : public ImportReshapePermuteConv {
+protected:
+    void SetUp() override {
+        ImportReshapePermuteConv::SetUp();
+        core->SetConfig({{CONFIG_KEY(CACHE_DIR), cacheDir}});
+    }
+
+    void TearDown() override {
+        core->SetConfig({{CONFIG_KEY(CACHE_DIR), {}}});
+        CommonTestUtils::removeFilesWithExt(cacheDir, "blob");
+        CommonTestUtils::removeDir(cacheDir);
+    }
+
+    const std::string cacheDir = "ImportReshapePermuteConvCPU_cache";
+};
+
+TEST_P(ImportReshapePermuteConvCPU, CompareWithRefImpl) {
+    Run();
+};
+
+const std::vector<InferenceEngine::Precision> netPrecisions = {
+        InferenceEngine::Precision::FP32,
+        InferenceEngine::Precision::FP16
+};
+
+const std::vector<std::map<std::string, std::string>> exportConfigs = {
+    {}
+};
+
+const std::vector<std::map<std::string, std::string>> importConfigs = {
+    {},
+    {
+        {InferenceEngine::PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, "2"}
+    }
+};
+
+const std::vector<std::string> appHeaders = {
+        "",
+        "APPLICATION_HEADER"
+};
+
+INSTANTIATE_TEST_CASE_P(smoke_ImportNetworkCase, ImportReshapePermuteConvCPU,
+                        ::testing::Combine(
+                            ::testing::ValuesIn(netPrecisions),
+                            ::testing::Values(CommonTestUtils::DEVICE_CPU),
+                            ::testing::ValuesIn(exportConfigs),
+                            ::testing::ValuesIn(importConfigs),
+                            ::testing::ValuesIn(appHeaders)),
+                        ImportReshapePermuteConv::getTestCaseName);
+
+} // namespace
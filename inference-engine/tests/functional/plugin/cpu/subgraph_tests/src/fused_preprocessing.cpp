@@ -0,0 +1,111 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
+#include "functional_test_utils/blob_utils.hpp"
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "ngraph_functions/utils/ngraph_helpers.hpp"
+#include "ngraph_functions/builders.hpp"
+
+using namespace InferenceEngine;
+using namespace ngraph::helpers;
+
+namespace CPUSubgraphTestsDefinitions {
+
+/* An U8 NHWC image is resized to the network input, its mean values are subtracted and it's converted
+   to FP32. With the fused pre-processing all of it is done by a single G-API pass writing to the graph
+   memory, the results must be the same as with the separate mean subtraction.
+
+        Param
+          |
+         Relu
+          |
+        Result
+*/
+
+class FusedPreprocessingTest : virtual public LayerTestsUtils::LayerTestsCommon {
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        const auto ngPrc = ngraph::element::f32;
+        auto params = ngraph::builder::makeParams(ngPrc, {{1, 3, 16, 16}});
+        auto relu = ngraph::builder::makeActivation(params[0], ngPrc, ActivationTypes::Relu);
+        ngraph::ResultVector results{std::make_shared<ngraph::opset1::Result>(relu)};
+        function = std::make_shared<ngraph::Function>(results, params, "FusedPreprocessing");
+    }
+
+    void ConfigureNetwork() override {
+        LayerTestsCommon::ConfigureNetwork();
+        auto inputInfo = cnnNetwork.getInputsInfo().begin()->second;
+        inputInfo->setPrecision(Precision::U8);
+        auto& preProcess = inputInfo->getPreProcess();
+        preProcess.init(3);
+        for (size_t c = 0; c < 3; c++) {
+            preProcess[c]->meanValue = 50.0f * c + 20.0f;
+            preProcess[c]->stdScale = stdScale;
+        }
+        preProcess.setVariant(MEAN_VALUE);
+        preProcess.setResizeAlgorithm(RESIZE_BILINEAR);
+    }
+
+    InferRequest infer(const std::string& fused, const Blob::Ptr& image) {
+        configuration = {{PluginConfigInternalParams::KEY_CPU_FUSED_PREPROCESSING, fused},
+                         {PluginConfigParams::KEY_PERF_COUNT, PluginConfigParams::YES}};
+        LoadNetwork();
+        auto request = executableNetwork.CreateInferRequest();
+        request.SetBlob(executableNetwork.GetInputsInfo().begin()->first, image);
+        request.Infer();
+        return request;
+    }
+
+    Blob::Ptr output(InferRequest& request) {
+        return request.GetBlob(executableNetwork.GetOutputsInfo().begin()->first);
+    }
+
+    float stdScale = 1.0f;
+};
+
+TEST_F(FusedPreprocessingTest, smoke_fusedMeanSubtractionKeepsResults) {
+    auto image = FuncTestUtils::createAndFillBlob(TensorDesc(Precision::U8, {1, 3, 24, 24}, Layout::NHWC), 255, 0);
+
+    auto fusedRequest = infer(PluginConfigParams::YES, image);
+    auto separateRequest = infer(PluginConfigParams::NO, image);
+    auto fusedOutput = output(fusedRequest);
+    auto separateOutput = output(separateRequest);
+
+    // the fused pass writes to the graph memory, so the input isn't copied
+    const auto perfCounts = fusedRequest.GetPerformanceCounts();
+    ASSERT_EQ(perfCounts.count(executableNetwork.GetInputsInfo().begin()->first + "_copy"), 0);
+
+    ASSERT_EQ(fusedOutput->size(), separateOutput->size());
+    auto fusedData = fusedOutput->cbuffer().as<const float*>();
+    auto separateData = separateOutput->cbuffer().as<const float*>();
+    for (size_t i = 0; i < fusedOutput->size(); i++) {
+        ASSERT_NEAR(separateData[i], fusedData[i], 1e-5f);
+    }
+}
+
+TEST_F(FusedPreprocessingTest, smoke_fusedNormalizationAppliesStdScale) {
+    auto image = FuncTestUtils::createAndFillBlob(TensorDesc(Precision::U8, {1, 3, 24, 24}, Layout::NHWC), 255, 0);
+    auto unscaledRequest = infer(PluginConfigParams::YES, image);
+    auto unscaledOutput = output(unscaledRequest);
+
+    const float scale = 0.5f;
+    stdScale = scale;
+
+    for (const auto& fused : {PluginConfigParams::YES, PluginConfigParams::NO}) {
+        auto scaledRequest = infer(fused, image);
+        auto scaledOutput = output(scaledRequest);
+
+        // Relu((x - mean) * scale) == Relu(x - mean) * scale for a positive scale
+        ASSERT_EQ(scaledOutput->size(), unscaledOutput->size());
+        auto scaledData = scaledOutput->cbuffer().as<const float*>();
+        auto unscaledData = unscaledOutput->cbuffer().as<const float*>();
+        for (size_t i = 0; i < scaledOutput->size(); i++) {
+            ASSERT_NEAR(unscaledData[i] * scale, scaledData[i], 1e-5f) << "fused: " << fused;
+        }
+    }
+}
+
+}  // namespace CPUSubgraphTestsDefinitions
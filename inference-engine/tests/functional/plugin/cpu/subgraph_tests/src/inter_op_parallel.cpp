@@ -0,0 +1,63 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "ngraph_functions/utils/ngraph_helpers.hpp"
+#include "ngraph_functions/builders.hpp"
+
+using namespace InferenceEngine;
+using namespace ngraph::helpers;
+
+namespace CPUSubgraphTestsDefinitions {
+
+/* Independent branches are executed concurrently and must not corrupt each other's data.
+
+                      Parameter
+          /         /           \          \
+    Convolution  Relu(in-place)  MaxPool   Add
+         |          |             |         |
+        Relu     Multiply         |        Sigmoid
+          \         |            /          /
+                      Concat
+                        |
+                      Result
+*/
+
+class InterOpParallelTest : virtual public LayerTestsUtils::LayerTestsCommon {
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        configuration.insert({PluginConfigInternalParams::KEY_CPU_INTEROP_PARALLEL, PluginConfigParams::YES});
+
+        const auto ngPrc = ngraph::element::f32;
+        const std::vector<size_t> inputShape = {1, 8, 32, 32};
+        auto params = ngraph::builder::makeParams(ngPrc, {inputShape});
+
+        auto conv = ngraph::builder::makeConvolution(params[0], ngPrc, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                                     ngraph::op::PadType::EXPLICIT, 8);
+        auto convRelu = ngraph::builder::makeActivation(conv, ngPrc, ActivationTypes::Relu);
+
+        auto relu = ngraph::builder::makeActivation(params[0], ngPrc, ActivationTypes::Relu);
+        auto mulConst = ngraph::builder::makeConstant<float>(ngPrc, {1, 8, 1, 1}, {}, true);
+        auto mul = ngraph::builder::makeEltwise(relu, mulConst, EltwiseTypes::MULTIPLY);
+
+        auto pool = ngraph::builder::makePooling(params[0], {1, 1}, {1, 1}, {1, 1}, {3, 3}, ngraph::op::RoundingType::FLOOR,
+                                                 ngraph::op::PadType::EXPLICIT, false, PoolingTypes::MAX);
+
+        auto addConst = ngraph::builder::makeConstant<float>(ngPrc, {1, 8, 1, 1}, {}, true);
+        auto add = ngraph::builder::makeEltwise(params[0], addConst, EltwiseTypes::ADD);
+        auto sigmoid = ngraph::builder::makeActivation(add, ngPrc, ActivationTypes::Sigmoid);
+
+        auto concat = ngraph::builder::makeConcat({convRelu, mul, pool, sigmoid}, 1);
+        ngraph::ResultVector results{std::make_shared<ngraph::opset1::Result>(concat)};
+        function = std::make_shared<ngraph::Function>(results, params, "InterOpParallel");
+    }
+};
+
+TEST_F(InterOpParallelTest, smoke_InterOpParallel_CPU) {
+    Run();
+}
+
+}  // namespace CPUSubgraphTestsDefinitions
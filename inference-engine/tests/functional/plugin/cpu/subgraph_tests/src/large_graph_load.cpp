@@ -0,0 +1,62 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "ngraph_functions/utils/ngraph_helpers.hpp"
+#include "ngraph_functions/builders.hpp"
+
+using namespace InferenceEngine;
+using namespace ngraph::helpers;
+
+namespace CPUSubgraphTestsDefinitions {
+
+/* Synthetic deep graph built of repeated diamond blocks (similar to an unrolled RNN body).
+
+           X
+         /   \
+      Relu   Sigmoid      x blocksNum
+         \   /
+          Add
+           |
+*/
+
+static std::shared_ptr<ngraph::Function> makeLargeGraph(size_t blocksNum) {
+    const auto ngPrc = ngraph::element::f32;
+    auto params = ngraph::builder::makeParams(ngPrc, {{1, 4, 2, 2}});
+
+    ngraph::Output<ngraph::Node> last = params[0];
+    for (size_t i = 0; i < blocksNum; i++) {
+        auto relu = ngraph::builder::makeActivation(last, ngPrc, ActivationTypes::Relu);
+        auto sigmoid = ngraph::builder::makeActivation(last, ngPrc, ActivationTypes::Sigmoid);
+        last = ngraph::builder::makeEltwise(relu, sigmoid, EltwiseTypes::ADD);
+    }
+
+    ngraph::ResultVector results{std::make_shared<ngraph::opset1::Result>(last)};
+    return std::make_shared<ngraph::Function>(results, params, "LargeGraph");
+}
+
+// The number of blocks is large enough for a graph load with quadratic steps to time out
+class LargeGraphLoadTest : public testing::WithParamInterface<size_t>,
+                           virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<size_t> &obj) {
+        return "blocks=" + std::to_string(obj.param);
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        function = makeLargeGraph(GetParam());
+    }
+};
+
+TEST_P(LargeGraphLoadTest, CompareWithRefs) {
+    Run();
+}
+
+INSTANTIATE_TEST_CASE_P(smoke_LargeGraphLoad, LargeGraphLoadTest,
+                        ::testing::Values(1000, 10000),
+                        LargeGraphLoadTest::getTestCaseName);
+
+}  // namespace CPUSubgraphTestsDefinitions
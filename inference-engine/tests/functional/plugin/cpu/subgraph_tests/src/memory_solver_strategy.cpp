@@ -0,0 +1,81 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "ngraph_functions/utils/ngraph_helpers.hpp"
+#include "ngraph_functions/builders.hpp"
+
+using namespace InferenceEngine;
+using namespace ngraph::helpers;
+
+namespace CPUSubgraphTestsDefinitions {
+
+/* The memory planned by each strategy must keep the results. The eltwise nodes are the last consumers
+   of the convolution outputs, so the strategies other than greedy may place them in-place.
+
+            Parameter
+                |
+           Convolution
+           /         \
+      Sigmoid        Add
+          |           |
+          |      Convolution
+          |        /      \
+          |   Multiply   Tanh
+           \      |       /
+               Concat
+                  |
+                Result
+*/
+
+class MemorySolverStrategyTest : public testing::WithParamInterface<std::string>,
+                                 virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<std::string> &obj) {
+        return "strategy=" + obj.param;
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        configuration.insert({PluginConfigInternalParams::KEY_CPU_MEMORY_SOLVER, GetParam()});
+
+        const auto ngPrc = ngraph::element::f32;
+        auto params = ngraph::builder::makeParams(ngPrc, {{1, 8, 16, 16}});
+        auto conv1 = ngraph::builder::makeConvolution(params[0], ngPrc, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                                      ngraph::op::PadType::EXPLICIT, 8);
+        auto sigmoid = ngraph::builder::makeActivation(conv1, ngPrc, ActivationTypes::Sigmoid);
+        auto addConst = ngraph::builder::makeConstant<float>(ngPrc, {1, 8, 1, 1}, {}, true);
+        auto add = ngraph::builder::makeEltwise(conv1, addConst, EltwiseTypes::ADD);
+
+        auto conv2 = ngraph::builder::makeConvolution(add, ngPrc, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                                      ngraph::op::PadType::EXPLICIT, 8);
+        auto mulConst = ngraph::builder::makeConstant<float>(ngPrc, {1, 8, 1, 1}, {}, true);
+        auto mul = ngraph::builder::makeEltwise(conv2, mulConst, EltwiseTypes::MULTIPLY);
+        auto tanh = ngraph::builder::makeActivation(conv2, ngPrc, ActivationTypes::Tanh);
+
+        auto concat = ngraph::builder::makeConcat({sigmoid, mul, tanh}, 1);
+        ngraph::ResultVector results{std::make_shared<ngraph::opset1::Result>(concat)};
+        function = std::make_shared<ngraph::Function>(results, params, "MemorySolverStrategy");
+    }
+};
+
+TEST_P(MemorySolverStrategyTest, CompareWithRefs) {
+    Run();
+
+    auto size = executableNetwork.GetMetric(METRIC_KEY(CPU_WORKSPACE_SIZE)).as<uint64_t>();
+    auto lowerBound = executableNetwork.GetMetric(METRIC_KEY(CPU_WORKSPACE_LOWER_BOUND)).as<uint64_t>();
+    if (GetParam() == PluginConfigInternalParams::MEMORY_SOLVER_GREEDY)
+        ASSERT_GE(size, lowerBound);
+    ASSERT_GT(size, 0);
+}
+
+INSTANTIATE_TEST_CASE_P(smoke_MemorySolverStrategy, MemorySolverStrategyTest,
+                        ::testing::Values(PluginConfigInternalParams::MEMORY_SOLVER_GREEDY,
+                                          PluginConfigInternalParams::MEMORY_SOLVER_BEST_FIT,
+                                          PluginConfigInternalParams::MEMORY_SOLVER_BEST),
+                        MemorySolverStrategyTest::getTestCaseName);
+
+}  // namespace CPUSubgraphTestsDefinitions
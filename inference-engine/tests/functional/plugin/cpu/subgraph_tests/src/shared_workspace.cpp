@@ -0,0 +1,125 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "ngraph_functions/utils/ngraph_helpers.hpp"
+#include "ngraph_functions/builders.hpp"
+
+using namespace InferenceEngine;
+using namespace ngraph::helpers;
+
+namespace CPUSubgraphTestsDefinitions {
+
+/* Two networks lease the intermediate memory from the same workspace pool, so they overwrite each
+   other's intermediate data between inferences and their results must stay the same as without sharing.
+
+        Parameter
+            |
+       Convolution
+            |
+          Relu
+            |
+       Convolution
+            |
+         Sigmoid
+            |
+         Result
+*/
+
+static std::shared_ptr<ngraph::Function> makeConvChain(size_t spatial, size_t channels) {
+    const auto ngPrc = ngraph::element::f32;
+    auto params = ngraph::builder::makeParams(ngPrc, {{1, channels, spatial, spatial}});
+    auto conv1 = ngraph::builder::makeConvolution(params[0], ngPrc, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                                  ngraph::op::PadType::EXPLICIT, channels);
+    auto relu = ngraph::builder::makeActivation(conv1, ngPrc, ActivationTypes::Relu);
+    auto conv2 = ngraph::builder::makeConvolution(relu, ngPrc, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                                  ngraph::op::PadType::EXPLICIT, channels);
+    auto sigmoid = ngraph::builder::makeActivation(conv2, ngPrc, ActivationTypes::Sigmoid);
+    ngraph::ResultVector results{std::make_shared<ngraph::opset1::Result>(sigmoid)};
+    return std::make_shared<ngraph::Function>(results, params, "ConvChain");
+}
+
+/* TensorIterator binds its body memory to raw pointers, so the graph keeps its own memory.
+
+        X[t]    H
+           \   /
+            Add
+           /    \
+        Relu    Relu
+         |        |
+        H'      Y[t]
+*/
+
+static std::shared_ptr<ngraph::Function> makeTensorIterator(size_t seqLen, size_t hiddenSize) {
+    const auto ngPrc = ngraph::element::f32;
+    auto outerParams = ngraph::builder::makeParams(ngPrc, {{seqLen, hiddenSize}, {1, hiddenSize}});
+
+    auto bodyParams = ngraph::builder::makeParams(ngPrc, {{1, hiddenSize}, {1, hiddenSize}});
+    auto add = ngraph::builder::makeEltwise(bodyParams[0], bodyParams[1], EltwiseTypes::ADD);
+    auto hidden = ngraph::builder::makeActivation(add, ngPrc, ActivationTypes::Relu);
+    auto output = ngraph::builder::makeActivation(add, ngPrc, ActivationTypes::Relu);
+    ngraph::ResultVector bodyResults{std::make_shared<ngraph::opset1::Result>(hidden),
+                                     std::make_shared<ngraph::opset1::Result>(output)};
+    auto body = std::make_shared<ngraph::Function>(bodyResults, bodyParams, "body");
+
+    auto tensorIterator = std::make_shared<ngraph::opset4::TensorIterator>();
+    tensorIterator->set_function(body);
+    tensorIterator->set_sliced_input(bodyParams[0], outerParams[0], 0, 1, 1, -1, 0);
+    tensorIterator->get_concatenated_slices(bodyResults[1], 0, 1, 1, -1, 0);
+    tensorIterator->set_merged_input(bodyParams[1], outerParams[1], bodyResults[0]);
+    tensorIterator->get_iter_value(bodyResults[0]);
+
+    return std::make_shared<ngraph::Function>(ngraph::OutputVector{tensorIterator->output(0), tensorIterator->output(1)},
+                                              outerParams, "TensorIterator");
+}
+
+class SharedWorkspaceTest : virtual public LayerTestsUtils::LayerTestsCommon {
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        configuration = {{PluginConfigInternalParams::KEY_CPU_SHARED_WORKSPACE, PluginConfigParams::YES}};
+    }
+
+    uint64_t GetLeases() {
+        return core->GetMetric(targetDevice, METRIC_KEY(CPU_SHARED_WORKSPACE_LEASES)).as<uint64_t>();
+    }
+
+    // Infers the tested network in turns with another one sharing the workspace and validates every result
+    void RunWithNeighbour(const std::shared_ptr<ngraph::Function>& neighbourFunction, int inferCount) {
+        auto neighbour = core->LoadNetwork(CNNNetwork(neighbourFunction), targetDevice, configuration).CreateInferRequest();
+        LoadNetwork();
+        GenerateInputs();
+        for (int i = 0; i < inferCount; i++) {
+            neighbour.Infer();
+            Infer();
+            Validate();
+        }
+    }
+};
+
+TEST_F(SharedWorkspaceTest, smoke_networksSharingWorkspaceKeepResults) {
+    function = makeConvChain(32, 8);
+    const auto leasesBefore = GetLeases();
+
+    const int inferCount = 3;
+    RunWithNeighbour(makeConvChain(16, 16), inferCount);
+
+    ASSERT_EQ(leasesBefore + 2 * inferCount, GetLeases());
+    ASSERT_GE(core->GetMetric(targetDevice, METRIC_KEY(CPU_SHARED_WORKSPACE_COUNT)).as<uint64_t>(), 1);
+    ASSERT_GT(core->GetMetric(targetDevice, METRIC_KEY(CPU_SHARED_WORKSPACE_SIZE)).as<uint64_t>(), 0);
+}
+
+TEST_F(SharedWorkspaceTest, smoke_networkWithNotRebasedNodesOwnsMemory) {
+    function = makeTensorIterator(10, 16);
+    const auto leasesBefore = GetLeases();
+
+    const int inferCount = 3;
+    RunWithNeighbour(makeConvChain(16, 16), inferCount);
+
+    // only the neighbour leases the workspace
+    ASSERT_EQ(leasesBefore + inferCount, GetLeases());
+}
+
+}  // namespace CPUSubgraphTestsDefinitions
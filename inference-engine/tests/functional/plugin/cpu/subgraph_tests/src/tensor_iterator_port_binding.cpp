@@ -0,0 +1,102 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "ngraph_functions/utils/ngraph_helpers.hpp"
+#include "ngraph_functions/builders.hpp"
+
+using namespace InferenceEngine;
+using namespace ngraph::helpers;
+
+namespace CPUSubgraphTestsDefinitions {
+
+/* TensorIterator with a small body: the sequence slices and the concatenated output are bound as
+   the body memory and the back edge swaps buffers, so the iterations don't copy data.
+
+        X[t]    H
+           \   /
+            Add
+           /    \
+    Multiply    Relu
+       |          |
+      H'        Y[t]
+*/
+
+static std::shared_ptr<ngraph::Function> makeTensorIterator(size_t seqLen, int64_t stride) {
+    const auto ngPrc = ngraph::element::f32;
+    const size_t hiddenSize = 16;
+    auto outerParams = ngraph::builder::makeParams(ngPrc, {{seqLen, hiddenSize}, {1, hiddenSize}});
+
+    auto bodyParams = ngraph::builder::makeParams(ngPrc, {{1, hiddenSize}, {1, hiddenSize}});
+    auto add = ngraph::builder::makeEltwise(bodyParams[0], bodyParams[1], EltwiseTypes::ADD);
+    auto scale = ngraph::builder::makeConstant<float>(ngPrc, {1, hiddenSize}, {0.5f});
+    auto hidden = ngraph::builder::makeEltwise(add, scale, EltwiseTypes::MULTIPLY);
+    auto output = ngraph::builder::makeActivation(add, ngPrc, ActivationTypes::Relu);
+    ngraph::ResultVector bodyResults{std::make_shared<ngraph::opset1::Result>(hidden),
+                                     std::make_shared<ngraph::opset1::Result>(output)};
+    auto body = std::make_shared<ngraph::Function>(bodyResults, bodyParams, "body");
+
+    auto tensorIterator = std::make_shared<ngraph::opset4::TensorIterator>();
+    tensorIterator->set_function(body);
+    if (stride > 0) {
+        tensorIterator->set_sliced_input(bodyParams[0], outerParams[0], 0, 1, 1, -1, 0);
+        tensorIterator->get_concatenated_slices(bodyResults[1], 0, 1, 1, -1, 0);
+    } else {
+        tensorIterator->set_sliced_input(bodyParams[0], outerParams[0], -1, -1, 1, 0, 0);
+        tensorIterator->get_concatenated_slices(bodyResults[1], -1, -1, 1, 0, 0);
+    }
+    tensorIterator->set_merged_input(bodyParams[1], outerParams[1], bodyResults[0]);
+    tensorIterator->get_iter_value(bodyResults[0]);
+
+    return std::make_shared<ngraph::Function>(ngraph::OutputVector{tensorIterator->output(0), tensorIterator->output(1)},
+                                              outerParams, "TensorIteratorPortBinding");
+}
+
+typedef std::tuple<
+        size_t,     // Sequence length
+        int64_t     // Stride
+> TensorIteratorPortBindingParams;
+
+class TensorIteratorPortBindingTest : public testing::WithParamInterface<TensorIteratorPortBindingParams>,
+                                      virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<TensorIteratorPortBindingParams> &obj) {
+        size_t seqLen;
+        int64_t stride;
+        std::tie(seqLen, stride) = obj.param;
+        return "seqLen=" + std::to_string(seqLen) + "_stride=" + std::to_string(stride);
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        size_t seqLen;
+        int64_t stride;
+        std::tie(seqLen, stride) = GetParam();
+        function = makeTensorIterator(seqLen, stride);
+    }
+};
+
+TEST_P(TensorIteratorPortBindingTest, CompareWithRefs) {
+    Run();
+}
+
+// Depending on the sequence length parity the back edge buffers are left swapped after the last iteration,
+// the next inference must start from the initial hidden state anyway
+TEST_P(TensorIteratorPortBindingTest, RepeatedInferKeepsResults) {
+    LoadNetwork();
+    GenerateInputs();
+    for (int i = 0; i < 3; i++) {
+        Infer();
+        Validate();
+    }
+}
+
+INSTANTIATE_TEST_CASE_P(smoke_TensorIteratorPortBinding, TensorIteratorPortBindingTest,
+                        ::testing::Combine(
+                                ::testing::Values(1, 50, 51),
+                                ::testing::Values(1, -1)),
+                        TensorIteratorPortBindingTest::getTestCaseName);
+
+}  // namespace CPUSubgraphTestsDefinitions
@@ -0,0 +1,93 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+
+using namespace InferenceEngine;
+
+namespace CPUSubgraphTestsDefinitions {
+
+/* Beam search step over a vocabulary: the TopK along the innermost dimension goes through the vectorized
+   heap selection, the embedding lookup of the selected tokens through the element gather.
+
+      Logits      Embeddings
+         |             |
+        TopK           |
+       /    \          |
+   Values  Indexes     |
+              \        |
+               Gather(axis = 0)
+                   |
+               Embedded
+*/
+
+typedef std::tuple<
+        size_t,     // Vocabulary size
+        int64_t     // K
+> TopKGatherVocabularyParams;
+
+static std::shared_ptr<ngraph::Function> makeTopKGather(size_t beams, size_t vocabulary, int64_t k, size_t embeddingSize) {
+    const auto ngPrc = ngraph::element::f32;
+    auto params = ngraph::builder::makeParams(ngPrc, {{beams, vocabulary}});
+    auto kConst = std::make_shared<ngraph::opset1::Constant>(ngraph::element::i64, ngraph::Shape{}, std::vector<int64_t>{k});
+    auto topK = std::make_shared<ngraph::opset4::TopK>(params[0], kConst, 1, ngraph::opset4::TopK::Mode::MAX,
+                                                       ngraph::opset4::TopK::SortType::SORT_VALUES);
+
+    std::vector<float> embeddingsData(vocabulary * embeddingSize);
+    for (size_t i = 0; i < embeddingsData.size(); i++) {
+        embeddingsData[i] = static_cast<float>(i % 97);
+    }
+    auto embeddings = ngraph::builder::makeConstant<float>(ngPrc, {vocabulary, embeddingSize}, embeddingsData);
+    auto axis = std::make_shared<ngraph::opset1::Constant>(ngraph::element::i64, ngraph::Shape{}, std::vector<int64_t>{0});
+    auto gather = std::make_shared<ngraph::opset1::Gather>(embeddings, topK->output(1), axis);
+
+    ngraph::ResultVector results{std::make_shared<ngraph::opset1::Result>(topK->output(0)),
+                                 std::make_shared<ngraph::opset1::Result>(gather)};
+    return std::make_shared<ngraph::Function>(results, params, "TopKGatherVocabulary");
+}
+
+class TopKGatherVocabularyTest : public testing::WithParamInterface<TopKGatherVocabularyParams>,
+                                 virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<TopKGatherVocabularyParams> &obj) {
+        size_t vocabulary;
+        int64_t k;
+        std::tie(vocabulary, k) = obj.param;
+        return "vocabulary=" + std::to_string(vocabulary) + "_k=" + std::to_string(k);
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        size_t vocabulary;
+        int64_t k;
+        std::tie(vocabulary, k) = GetParam();
+        function = makeTopKGather(4, vocabulary, k, 8);
+    }
+
+    InferenceEngine::Blob::Ptr GenerateInput(const InferenceEngine::InputInfo &info) const override {
+        // Values are unique, so the selected indexes don't depend on the order ties are resolved in
+        auto blob = make_blob_with_precision(info.getTensorDesc());
+        blob->allocate();
+        auto data = blob->buffer().as<float*>();
+        const size_t size = blob->size();
+        for (size_t i = 0; i < size; i++) {
+            data[i] = static_cast<float>((i * 7919) % size) / size;
+        }
+        return blob;
+    }
+};
+
+TEST_P(TopKGatherVocabularyTest, CompareWithRefs) {
+    Run();
+}
+
+INSTANTIATE_TEST_CASE_P(smoke_TopKGatherVocabulary, TopKGatherVocabularyTest,
+                        ::testing::Combine(
+                                ::testing::Values(37, 1000, 32000),
+                                ::testing::Values(1, 5, 20)),
+                        TopKGatherVocabularyTest::getTestCaseName);
+
+}  // namespace CPUSubgraphTestsDefinitions
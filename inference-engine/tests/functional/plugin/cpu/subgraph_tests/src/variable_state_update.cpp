@@ -0,0 +1,125 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+
+using namespace InferenceEngine;
+
+namespace CPUSubgraphTestsDefinitions {
+
+/* The state buffers are swapped between inferences instead of being copied in and out of the graph,
+   so every inference has to read the value written by the previous one.
+
+         Param   ReadValue
+             \   /      \
+              Add       Relu
+               |          |
+             Assign     Result
+*/
+
+class VariableStateUpdateTest : virtual public LayerTestsUtils::LayerTestsCommon {
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        const auto ngPrc = ngraph::element::f32;
+        auto params = ngraph::builder::makeParams(ngPrc, {{1, 64}});
+        auto init = ngraph::builder::makeConstant<float>(ngPrc, {1, 64}, {0.0f});
+        auto readValue = std::make_shared<ngraph::opset3::ReadValue>(init, "accumulator");
+        auto add = std::make_shared<ngraph::opset1::Add>(readValue, params[0]);
+        auto assign = std::make_shared<ngraph::opset3::Assign>(add, "accumulator");
+        auto relu = std::make_shared<ngraph::opset1::Relu>(readValue);
+        assign->add_control_dependency(readValue);
+        relu->add_control_dependency(assign);
+        ngraph::ResultVector results{std::make_shared<ngraph::opset1::Result>(relu)};
+        function = std::make_shared<ngraph::Function>(results, params, "VariableStateUpdate");
+    }
+
+    void fillInput(InferRequest& request, float value) {
+        auto input = request.GetBlob(executableNetwork.GetInputsInfo().begin()->first);
+        auto inputData = input->buffer().as<float*>();
+        std::fill(inputData, inputData + input->size(), value);
+    }
+
+    void checkOutput(InferRequest& request, float expected) {
+        auto output = request.GetBlob(executableNetwork.GetOutputsInfo().begin()->first);
+        auto outputData = output->cbuffer().as<const float*>();
+        for (size_t j = 0; j < output->size(); j++) {
+            ASSERT_FLOAT_EQ(expected, outputData[j]);
+        }
+    }
+};
+
+TEST_F(VariableStateUpdateTest, smoke_stateIsUpdatedByEveryInference) {
+    LoadNetwork();
+    auto request = executableNetwork.CreateInferRequest();
+    fillInput(request, 1.0f);
+
+    IE_SUPPRESS_DEPRECATED_START
+    for (int i = 0; i < 5; i++) {
+        request.Infer();
+        checkOutput(request, static_cast<float>(i));
+
+        auto states = request.QueryState();
+        ASSERT_EQ(states.size(), 1);
+        auto state = states[0].GetState();
+        auto stateData = state->cbuffer().as<const float*>();
+        for (size_t j = 0; j < state->size(); j++) {
+            ASSERT_FLOAT_EQ(static_cast<float>(i + 1), stateData[j]);
+        }
+    }
+
+    request.QueryState()[0].Reset();
+    request.Infer();
+    auto stateData = request.QueryState()[0].GetState()->cbuffer().as<const float*>();
+    ASSERT_FLOAT_EQ(1.0f, stateData[0]);
+    IE_SUPPRESS_DEPRECATED_END
+}
+
+TEST_F(VariableStateUpdateTest, smoke_newRequestDoesNotUseStateOfDestroyedOne) {
+    LoadNetwork();
+    // with several requests alive each of them has its own state buffers
+    auto request = executableNetwork.CreateInferRequest();
+    {
+        auto destroyed = executableNetwork.CreateInferRequest();
+        fillInput(destroyed, 1.0f);
+        destroyed.Infer();
+        destroyed.Infer();
+    }
+
+    auto created = executableNetwork.CreateInferRequest();
+    fillInput(created, 1.0f);
+    created.Infer();
+    checkOutput(created, 0.0f);
+    created.Infer();
+    checkOutput(created, 1.0f);
+}
+
+TEST_F(VariableStateUpdateTest, smoke_setStateCopiesTheBlob) {
+    LoadNetwork();
+    auto request = executableNetwork.CreateInferRequest();
+    fillInput(request, 1.0f);
+
+    IE_SUPPRESS_DEPRECATED_START
+    auto state = request.QueryState()[0];
+    auto newState = make_blob_with_precision(state.GetState()->getTensorDesc());
+    newState->allocate();
+    auto newStateData = newState->buffer().as<float*>();
+    std::fill(newStateData, newStateData + newState->size(), 5.0f);
+    state.SetState(newState);
+
+    for (int i = 0; i < 3; i++) {
+        request.Infer();
+        checkOutput(request, 5.0f + i);
+        // the blob is never used as a state buffer, so inferences don't write to it
+        for (size_t j = 0; j < newState->size(); j++) {
+            ASSERT_FLOAT_EQ(5.0f, newStateData[j]);
+        }
+    }
+    IE_SUPPRESS_DEPRECATED_END
+}
+
+}  // namespace CPUSubgraphTestsDefinitions
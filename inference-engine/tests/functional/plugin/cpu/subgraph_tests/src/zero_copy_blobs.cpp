@@ -0,0 +1,70 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "ngraph_functions/utils/ngraph_helpers.hpp"
+#include "ngraph_functions/builders.hpp"
+
+using namespace InferenceEngine;
+using namespace ngraph::helpers;
+
+namespace CPUSubgraphTestsDefinitions {
+
+/* User blobs set via SetBlob are bound as the graph memory when their precision and layout
+   match the graph, otherwise the copy is reported in the performance counters.
+
+        Param
+          |
+         Relu
+          |
+       Multiply
+          |
+        Result
+*/
+
+class ZeroCopyBlobsTest : virtual public LayerTestsUtils::LayerTestsCommon {
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        configuration = {{PluginConfigParams::KEY_PERF_COUNT, PluginConfigParams::YES}};
+
+        const auto ngPrc = ngraph::element::f32;
+        auto params = ngraph::builder::makeParams(ngPrc, {{1, 3, 16, 16}});
+        auto relu = ngraph::builder::makeActivation(params[0], ngPrc, ActivationTypes::Relu);
+        auto multiply = ngraph::builder::makeEltwise(relu, ngraph::builder::makeConstant<float>(ngPrc, {1}, {2.0f}),
+                                                     EltwiseTypes::MULTIPLY);
+        ngraph::ResultVector results{std::make_shared<ngraph::opset1::Result>(multiply)};
+        function = std::make_shared<ngraph::Function>(results, params, "ZeroCopy");
+    }
+
+    std::map<std::string, InferenceEngineProfileInfo> GetCopies() {
+        std::map<std::string, InferenceEngineProfileInfo> copies;
+        for (const auto& perfCount : inferRequest.GetPerformanceCounts()) {
+            if (perfCount.second.layer_type == std::string("Copy"))
+                copies.insert(perfCount);
+        }
+        return copies;
+    }
+};
+
+TEST_F(ZeroCopyBlobsTest, smoke_userBlobsAreBound) {
+    Run();
+
+    ASSERT_TRUE(GetCopies().empty());
+}
+
+TEST_F(ZeroCopyBlobsTest, smoke_copyReasonIsReported) {
+    inPrc = Precision::I64;
+    Run();
+
+    auto copies = GetCopies();
+    const auto inputName = executableNetwork.GetInputsInfo().begin()->first;
+    ASSERT_EQ(copies.size(), 1);
+    ASSERT_EQ(copies.count(inputName + "_copy"), 1);
+    const auto& copy = copies.at(inputName + "_copy");
+    ASSERT_EQ(copy.status, InferenceEngineProfileInfo::EXECUTED);
+    ASSERT_NE(std::string(copy.exec_type).find("precision conversion"), std::string::npos);
+}
+
+}  // namespace CPUSubgraphTestsDefinitions
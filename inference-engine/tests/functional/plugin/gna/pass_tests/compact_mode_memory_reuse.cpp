@@ -0,0 +1,83 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <vector>
+#include <memory>
+#include <string>
+
+#include <ie_core.hpp>
+#include <gna/gna_config.hpp>
+
+#include "common_test_utils/common_utils.hpp"
+#include "common_test_utils/data_utils.hpp"
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "ngraph_functions/utils/ngraph_helpers.hpp"
+#include "ngraph_functions/builders.hpp"
+
+namespace LayerTestsDefinitions {
+
+/* Intermediate buffers of a chain of fully connected layers are never used at the same time,
+   so they share the GNA memory in compact mode.
+
+      Parameter
+          |
+    FullyConnected
+          |
+       Sigmoid
+          |
+    FullyConnected
+          |
+       Sigmoid
+          |
+         ...
+          |
+        Result
+*/
+
+class CompactModeMemoryReuse : public LayerTestsUtils::LayerTestsCommon {
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_GNA;
+        configuration = {
+            {"GNA_DEVICE_MODE", "GNA_SW_FP32"},
+            {"GNA_COMPACT_MODE", "YES"},
+        };
+
+        const size_t size = 64;
+        const auto ngPrc = ngraph::element::f32;
+        auto params = ngraph::builder::makeParams(ngPrc, {{1, size}});
+        std::shared_ptr<ngraph::Node> layer = params[0];
+        for (size_t i = 0; i < 4; i++) {
+            auto weights = CommonTestUtils::generate_float_numbers(size * size, -0.1f, 0.1f);
+            auto fc = ngraph::builder::makeFullyConnected(layer, ngPrc, size, false, {}, weights);
+            layer = ngraph::builder::makeActivation(fc, ngPrc, ngraph::helpers::ActivationTypes::Sigmoid);
+        }
+        ngraph::ResultVector results{std::make_shared<ngraph::opset1::Result>(layer)};
+        function = std::make_shared<ngraph::Function>(results, params, "CompactModeMemoryReuse");
+    }
+};
+
+TEST_F(CompactModeMemoryReuse, smoke_OutputsAreSameWithoutReuse) {
+    Run();
+
+    auto rwSize = executableNetwork.GetMetric(METRIC_KEY(GNA_RW_MEMORY_SIZE)).as<uint64_t>();
+    auto rwSizeWithoutReuse = executableNetwork.GetMetric(METRIC_KEY(GNA_RW_MEMORY_SIZE_WITHOUT_REUSE)).as<uint64_t>();
+    ASSERT_LT(rwSize, rwSizeWithoutReuse);
+
+    auto withoutReuseConfig = configuration;
+    withoutReuseConfig["GNA_COMPACT_MODE"] = "NO";
+    auto withoutReuse = core->LoadNetwork(cnnNetwork, targetDevice, withoutReuseConfig).CreateInferRequest();
+    const auto& inputsInfo = executableNetwork.GetInputsInfo();
+    const auto& functionParams = function->get_parameters();
+    for (size_t i = 0; i < functionParams.size(); ++i) {
+        withoutReuse.SetBlob(inputsInfo.at(functionParams[i]->get_friendly_name())->name(), inputs[i]);
+    }
+    withoutReuse.Infer();
+
+    for (const auto& output : executableNetwork.GetOutputsInfo()) {
+        Compare(withoutReuse.GetBlob(output.first), inferRequest.GetBlob(output.first));
+    }
+}
+
+}  // namespace LayerTestsDefinitions
@@ -28,6 +28,7 @@ public:
         const InferenceEngine::CNNNetwork&, const std::string&, const std::map<std::string, std::string>&));
 
     MOCK_QUALIFIED_METHOD2(GetMetric, const, InferenceEngine::Parameter(const std::string&, const std::string&));
+    MOCK_QUALIFIED_METHOD0(IsModelCachingEnabled, const, bool());
 
     ~MockICore() = default;
 };
@@ -2,6 +2,13 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <limits>
+#include <random>
+#include <sstream>
+#include <string>
 #include <vector>
 #include <gtest/gtest.h>
 #include <ie_common.h>
@@ -273,3 +280,226 @@ TEST(MemSolverTest, BestSolution1) {
             ASSERT_TRUE(no_overlap(boxes[i], boxes[j])) << "Box overlapping is detected";
 }
 
+
+namespace {
+
+void checkNoOverlapping(const MKLDNNPlugin::MemorySolver &ms, const std::vector<Box> &boxes,
+                        const std::vector<std::pair<int64_t, int64_t>> &in_place = {}) {
+    auto is_in_place = [&](const Box &box1, const Box &box2) {
+        for (auto &pair : in_place) {
+            if ((pair.first == box1.id && pair.second == box2.id) || (pair.first == box2.id && pair.second == box1.id))
+                return ms.getOffset(box1.id) == ms.getOffset(box2.id);
+        }
+        return false;
+    };
+    auto no_overlap = [&](const Box &box1, const Box &box2) -> bool {
+        int64_t off1 = ms.getOffset(box1.id);
+        int64_t off2 = ms.getOffset(box2.id);
+        int finish1 = box1.finish == -1 ? std::numeric_limits<int>::max() : box1.finish;
+        int finish2 = box2.finish == -1 ? std::numeric_limits<int>::max() : box2.finish;
+        return finish1 < box2.start || box1.start > finish2 ||
+               off1 + box1.size <= off2 || off1 >= off2 + box2.size || is_in_place(box1, box2);
+    };
+
+    for (size_t i = 0; i < boxes.size(); i++)
+        for (size_t j = i + 1; j < boxes.size(); j++)
+            ASSERT_TRUE(no_overlap(boxes[i], boxes[j])) << "Box overlapping is detected";
+}
+
+}  // namespace
+
+TEST(MemSolverTest, BestFitSolvesUnefficiency) {
+    std::vector<Box> boxes{    //  |            __________
+            {6, 7, 3, 0},      //  |   ____    |_3________|
+            {2, 5, 2, 1},      //  |  |_4__|_____ |    |
+            {5, 8, 2, 2},      //  |__|_2________||_1__|___
+            {2, 3, 2, 3},      //      2  3  4  5  6  7  8
+    };
+
+    MKLDNNPlugin::MemorySolver ms(boxes);
+    EXPECT_EQ(ms.solve(MKLDNNPlugin::MemorySolver::Strategy::BestFit), 5);
+    checkNoOverlapping(ms, boxes);
+}
+
+TEST(MemSolverTest, BestKeepsSmallestSolution) {
+    int n = 0;                //  |         _____________
+    std::vector<Box> boxes{   //  |   _____|___1_________|
+            {4, 8, 1, n++},   //  |  |_2_____|    ____
+            {6, 7, 3, n++},   //  |  |    |      |    |
+            {2, 3, 3, n++},   //  |__|_3__|______|_3__|___
+            {2, 4, 2, n++},   //      2  3  4  5  6  7  8
+    };
+
+    MKLDNNPlugin::MemorySolver ms(boxes);
+    auto greedy = ms.solve();
+    auto best = ms.solve(MKLDNNPlugin::MemorySolver::Strategy::Best);
+    EXPECT_EQ(best, 5);
+    EXPECT_LE(best, greedy);
+    EXPECT_EQ(ms.maxDepth(), 5);
+    checkNoOverlapping(ms, boxes);
+}
+
+TEST(MemSolverTest, BestFitWithToEndBoxes) {
+    std::vector<Box> boxes{     //  |      _____________
+            {0, 1,  2, 0},      //  |     |_____________>>
+            {1, -1, 2, 1},      //  |           |____|__
+            {3, 3,  2, 2},      //  |   ____    |_______>>
+            {3, -1, 2, 3},      //  |__|____|___|_|_________
+            {3, 4,  2, 4},      //      0  1  2  3  4  5  6
+    };
+
+    MKLDNNPlugin::MemorySolver ms(boxes);
+    EXPECT_EQ(ms.solve(MKLDNNPlugin::MemorySolver::Strategy::Best), 8);
+    checkNoOverlapping(ms, boxes);
+}
+
+TEST(MemSolverTest, InPlaceChain) {
+    int n = 0;
+    std::vector<Box> boxes{      //  |
+            {n, ++n, 4, 0},      //  |   ________
+            {n, ++n, 4, 1},      //  |__|__|__|__|__
+            {n, ++n, 4, 2},      //      0  1  2  3
+    };
+    std::vector<std::pair<int64_t, int64_t>> in_place{{1, 0}, {2, 1}};
+
+    MKLDNNPlugin::MemorySolver ms(boxes);
+    for (auto &pair : in_place)
+        ms.allowInPlace(pair.first, pair.second);
+
+    EXPECT_EQ(ms.solve(), 8);  // in-place is not supported by greedy strategy
+    EXPECT_EQ(ms.solve(MKLDNNPlugin::MemorySolver::Strategy::BestFit), 4);
+    EXPECT_EQ(ms.getOffset(0), ms.getOffset(2));
+    checkNoOverlapping(ms, boxes, in_place);
+}
+
+TEST(MemSolverTest, InPlaceIsIgnoredForOverlappingLifetimes) {
+    std::vector<Box> boxes{
+            {0, 2, 4, 0},
+            {1, 3, 4, 1},
+    };
+
+    MKLDNNPlugin::MemorySolver ms(boxes);
+    // the producer is still alive after the start of the consumer
+    ms.allowInPlace(1, 0);
+    EXPECT_EQ(ms.solve(MKLDNNPlugin::MemorySolver::Strategy::Best), 8);
+    checkNoOverlapping(ms, boxes);
+}
+
+namespace {
+
+struct BoxSet {
+    std::string name;
+    std::vector<Box> boxes;
+    std::vector<std::pair<int64_t, int64_t>> in_place;
+};
+
+// Residual network: the skip connection lives during the whole block
+BoxSet makeResidual(int blocks, int64_t size) {
+    BoxSet set {"residual_" + std::to_string(blocks)};
+    int t = 0;
+    int64_t id = 0;
+    for (int b = 0; b < blocks; b++) {
+        int64_t block_size = size >> (b / 4);
+        int block_start = t;
+        set.boxes.push_back({t, t + 4, block_size, id++});  // skip connection
+        for (int l = 0; l < 3; l++, t++)
+            set.boxes.push_back({t + 1, t + 2, l == 1 ? block_size / 4 : block_size, id++});
+        set.boxes.push_back({t + 1, t + 2, block_size, id++});  // sum
+        set.in_place.emplace_back(id - 1, id - 2);
+        t = block_start + 4;
+    }
+    return set;
+}
+
+// Encoder-decoder network: the encoder outputs live until the decoder stage of the same resolution
+BoxSet makeUNet(int levels, int64_t size) {
+    BoxSet set {"unet_" + std::to_string(levels)};
+    const int duration = 4 * levels + 2;
+    int64_t id = 0;
+    for (int l = 0; l < levels; l++) {
+        int64_t level_size = size >> (2 * l);
+        set.boxes.push_back({2 * l, duration - 2 * l, level_size, id++});  // skip
+        set.boxes.push_back({2 * l + 1, 2 * l + 2, level_size / 2, id++});
+        set.boxes.push_back({duration - 2 * l - 1, duration - 2 * l, level_size, id++});
+    }
+    return set;
+}
+
+// Detection network: several heads of different sizes read the same feature maps
+BoxSet makeDetection(int heads, int64_t size, unsigned seed) {
+    BoxSet set {"detection_" + std::to_string(heads)};
+    std::mt19937 gen(seed);
+    std::uniform_int_distribution<int64_t> sizes(1, 16);
+    std::uniform_int_distribution<int> lengths(1, 6);
+    int t = 0;
+    int64_t id = 0;
+    for (int h = 0; h < heads; h++, t += 2) {
+        set.boxes.push_back({t, t + heads * 2, size >> (h % 5), id++});  // feature map
+        for (int l = 0; l < 4; l++)
+            set.boxes.push_back({t + l, t + l + lengths(gen), sizes(gen) * (size >> 6), id++});
+        set.boxes.push_back({t + 1, -1, sizes(gen) * 64, id++});  // output
+    }
+    return set;
+}
+
+// Box sets dumped by the CPU plugin with KEY_DUMP_EXEC_GRAPH_AS_DOT, see dumpMemoryBoxes() in mkldnn_graph.cpp
+std::vector<BoxSet> readDumpedBoxSets(const std::string &list_file) {
+    std::vector<BoxSet> sets;
+    std::ifstream list(list_file);
+    std::string file;
+    while (std::getline(list, file)) {
+        std::ifstream in(file);
+        if (file.empty() || !in.is_open())
+            continue;
+        BoxSet set {file};
+        std::string line;
+        while (std::getline(in, line)) {
+            std::istringstream fields(line);
+            std::string kind;
+            fields >> kind;
+            if (kind == "box") {
+                Box box {0, 0, 0, static_cast<int64_t>(set.boxes.size())};
+                fields >> box.start >> box.finish >> box.size;
+                set.boxes.push_back(box);
+            } else if (kind == "inplace") {
+                int64_t id = 0, producer = 0;
+                fields >> id >> producer;
+                set.in_place.emplace_back(id, producer);
+            }
+        }
+        sets.push_back(set);
+    }
+    return sets;
+}
+
+}  // namespace
+
+// Checks the strategies on box sets of typical topologies. The box sets dumped from real models are
+// read from the files listed in the file given by MKLDNN_MEMORY_SOLVER_CORPUS environment variable.
+TEST(MemSolverTest, StrategiesOnTypicalTopologies) {
+    std::vector<BoxSet> corpus = {
+        makeResidual(16, 1 << 20), makeResidual(50, 1 << 20),
+        makeUNet(4, 1 << 22), makeUNet(6, 1 << 22),
+        makeDetection(6, 1 << 20, 1), makeDetection(20, 1 << 20, 2),
+    };
+    if (const char *list = std::getenv("MKLDNN_MEMORY_SOLVER_CORPUS")) {
+        auto dumped = readDumpedBoxSets(list);
+        corpus.insert(corpus.end(), dumped.begin(), dumped.end());
+    }
+
+    for (auto &set : corpus) {
+        SCOPED_TRACE(set.name);
+        MKLDNNPlugin::MemorySolver ms(set.boxes);
+        for (auto &pair : set.in_place)
+            ms.allowInPlace(pair.first, pair.second);
+
+        auto greedy = ms.solve(MKLDNNPlugin::MemorySolver::Strategy::Greedy);
+        checkNoOverlapping(ms, set.boxes, set.in_place);
+        auto best_fit = ms.solve(MKLDNNPlugin::MemorySolver::Strategy::BestFit);
+        checkNoOverlapping(ms, set.boxes, set.in_place);
+        auto best = ms.solve(MKLDNNPlugin::MemorySolver::Strategy::Best);
+        checkNoOverlapping(ms, set.boxes, set.in_place);
+
+        EXPECT_LE(best, std::min(greedy, best_fit));
+    }
+}
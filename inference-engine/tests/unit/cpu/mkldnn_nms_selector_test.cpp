@@ -0,0 +1,129 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <random>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "nodes/common/nms.h"
+
+using namespace MKLDNNPlugin;
+
+namespace {
+
+std::vector<NmsSelector::Box> randomBoxes(size_t count, float extent, float maxSize, float offset, unsigned seed) {
+    std::mt19937 gen(seed);
+    std::uniform_real_distribution<float> position(0.0f, extent);
+    std::uniform_real_distribution<float> size(0.0f, maxSize);
+    std::vector<NmsSelector::Box> boxes(count);
+    for (auto& b : boxes) {
+        b.min0 = position(gen);
+        b.min1 = position(gen);
+        b.max0 = b.min0 + size(gen);
+        b.max1 = b.min1 + size(gen);
+        b.area = (b.max0 - b.min0 + offset) * (b.max1 - b.min1 + offset);
+    }
+    return boxes;
+}
+
+// Greedy suppression comparing every candidate with every selected box
+std::vector<int> referenceNms(const std::vector<NmsSelector::Box>& boxes, size_t maxSelected,
+                              float threshold, bool suppressOnEqual, float offset) {
+    std::vector<int> selected;
+    for (size_t i = 0; i < boxes.size() && selected.size() < maxSelected; i++) {
+        bool keep = true;
+        for (int s : selected) {
+            const float iou = NmsSelector::iou(boxes[i], boxes[s], offset);
+            if (suppressOnEqual ? iou >= threshold : iou > threshold) {
+                keep = false;
+                break;
+            }
+        }
+        if (keep)
+            selected.push_back(static_cast<int>(i));
+    }
+    return selected;
+}
+
+std::vector<int> selectorNms(const std::vector<NmsSelector::Box>& boxes, size_t maxSelected,
+                             float threshold, bool suppressOnEqual, float offset) {
+    NmsSelector selector(threshold, suppressOnEqual, offset);
+    selector.reset(boxes.data(), boxes.size(), maxSelected);
+    for (size_t i = 0; i < boxes.size() && selector.size() < maxSelected; i++) {
+        selector.select(boxes[i], static_cast<int>(i));
+    }
+    return selector.selected();
+}
+
+}  // namespace
+
+TEST(NmsSelectorTest, iouOfCornerBoxes) {
+    NmsSelector::Box a {0.0f, 0.0f, 2.0f, 2.0f, 4.0f};
+    NmsSelector::Box b {1.0f, 1.0f, 3.0f, 3.0f, 4.0f};
+    NmsSelector::Box c {2.0f, 2.0f, 3.0f, 3.0f, 1.0f};
+    NmsSelector::Box empty {1.0f, 1.0f, 1.0f, 2.0f, 0.0f};
+
+    ASSERT_FLOAT_EQ(1.0f / 7.0f, NmsSelector::iou(a, b, 0.0f));
+    ASSERT_FLOAT_EQ(0.0f, NmsSelector::iou(a, c, 0.0f));
+    ASSERT_FLOAT_EQ(0.0f, NmsSelector::iou(a, empty, 0.0f));
+    // Boxes in pixels touching by the border share the border pixels
+    NmsSelector::Box pa {0.0f, 0.0f, 1.0f, 1.0f, 4.0f};
+    NmsSelector::Box pb {1.0f, 0.0f, 2.0f, 1.0f, 4.0f};
+    ASSERT_FLOAT_EQ(2.0f / 6.0f, NmsSelector::iou(pa, pb, 1.0f));
+}
+
+TEST(NmsSelectorTest, thresholdEquality) {
+    NmsSelector::Box a {0.0f, 0.0f, 2.0f, 1.0f, 2.0f};
+    NmsSelector::Box b {1.0f, 0.0f, 3.0f, 1.0f, 2.0f};
+    const float iou = NmsSelector::iou(a, b, 0.0f);
+
+    NmsSelector inclusive(iou, true);
+    inclusive.reset(nullptr, 0, 2);
+    ASSERT_TRUE(inclusive.select(a, 0));
+    ASSERT_FALSE(inclusive.select(b, 1));
+
+    NmsSelector exclusive(iou, false);
+    exclusive.reset(nullptr, 0, 2);
+    ASSERT_TRUE(exclusive.select(a, 0));
+    ASSERT_TRUE(exclusive.select(b, 1));
+    ASSERT_EQ(exclusive.selected(), std::vector<int>({0, 1}));
+}
+
+TEST(NmsSelectorTest, zeroThresholdSuppressesEverything) {
+    auto boxes = randomBoxes(2000, 100.0f, 5.0f, 0.0f, 1);
+    ASSERT_EQ(selectorNms(boxes, 1000, 0.0f, true, 0.0f), std::vector<int>({0}));
+}
+
+TEST(NmsSelectorTest, gridSelectsAsReference) {
+    for (float threshold : {0.0f, 0.3f, 0.7f}) {
+        for (float offset : {0.0f, 1.0f}) {
+            for (float maxSize : {2.0f, 20.0f, 300.0f}) {
+                auto boxes = randomBoxes(5000, 500.0f, maxSize, offset, 7);
+                for (size_t maxSelected : {10, 200, 5000}) {
+                    for (bool suppressOnEqual : {true, false}) {
+                        ASSERT_EQ(referenceNms(boxes, maxSelected, threshold, suppressOnEqual, offset),
+                                  selectorNms(boxes, maxSelected, threshold, suppressOnEqual, offset))
+                            << "threshold " << threshold << " offset " << offset << " max size " << maxSize
+                            << " max selected " << maxSelected << " suppress on equal " << suppressOnEqual;
+                    }
+                }
+            }
+        }
+    }
+}
+
+TEST(NmsSelectorTest, overlapsWithSelected) {
+    auto boxes = randomBoxes(50, 10.0f, 5.0f, 0.0f, 3);
+    NmsSelector selector(1.0f, false);
+    selector.reset(nullptr, 0, boxes.size());
+    for (size_t i = 0; i < boxes.size(); i++) {
+        selector.add(boxes[i], static_cast<int>(i));
+    }
+
+    std::vector<float> ious(boxes.size() - 10);
+    selector.overlaps(boxes[0], 10, ious.data());
+    for (size_t i = 10; i < boxes.size(); i++) {
+        ASSERT_EQ(NmsSelector::iou(boxes[0], boxes[i], 0.0f), ious[i - 10]);
+    }
+}
@@ -0,0 +1,124 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "mkldnn_memory.h"
+#include "mkldnn_reorder_cache.hpp"
+
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+
+namespace {
+
+const mkldnn::memory::dims reorderTestDims {2, 16, 3, 5};
+
+std::vector<float> reorderTestData() {
+    std::vector<float> data(2 * 16 * 3 * 5);
+    for (size_t i = 0; i < data.size(); i++) {
+        data[i] = static_cast<float>(i);
+    }
+    return data;
+}
+
+}  // namespace
+
+TEST(ReorderCacheTest, reorderDataReusesPrimitive) {
+    mkldnn::engine eng(mkldnn::engine::kind::cpu, 0);
+    auto& cache = MKLDNNReorderCache::GetInstance();
+    cache.clear();
+
+    auto data = reorderTestData();
+    MKLDNNMemory blocked(eng);
+    blocked.Create(reorderTestDims, mkldnn::memory::data_type::f32, mkldnn::memory::format_tag::nChw8c);
+    MKLDNNMemory planar(eng);
+    planar.Create(reorderTestDims, mkldnn::memory::data_type::f32, mkldnn::memory::format_tag::nchw);
+
+    for (int i = 0; i < 3; i++) {
+        blocked.SetData(mkldnn::memory::data_type::f32, mkldnn::memory::format_tag::nchw, data.data(),
+                        data.size() * sizeof(float), false);
+    }
+    ASSERT_EQ(cache.misses(), 1);
+    ASSERT_EQ(cache.hits(), 2);
+
+    MKLDNNMemory::reorderData(blocked, planar);
+    ASSERT_EQ(cache.misses(), 2);
+    ASSERT_EQ(cache.size(), 2);
+
+    auto result = static_cast<const float*>(planar.GetPtr());
+    for (size_t i = 0; i < data.size(); i++) {
+        ASSERT_EQ(data[i], result[i]);
+    }
+}
+
+TEST(ReorderCacheTest, leastRecentlyUsedIsEvicted) {
+    mkldnn::engine eng(mkldnn::engine::kind::cpu, 0);
+    MKLDNNReorderCache cache(2);
+
+    const mkldnn::memory::desc nchw(reorderTestDims, mkldnn::memory::data_type::f32, mkldnn::memory::format_tag::nchw);
+    const mkldnn::memory::desc nhwc(reorderTestDims, mkldnn::memory::data_type::f32, mkldnn::memory::format_tag::nhwc);
+    const mkldnn::memory::desc blocked(reorderTestDims, mkldnn::memory::data_type::f32, mkldnn::memory::format_tag::nChw8c);
+
+    cache.get(nchw, nhwc, eng);
+    cache.get(nchw, blocked, eng);
+    cache.get(nchw, nhwc, eng);
+    // evicts nchw -> nChw8c as the least recently used one
+    cache.get(nhwc, nchw, eng);
+    ASSERT_EQ(cache.size(), 2);
+    ASSERT_EQ(cache.misses(), 3);
+    ASSERT_EQ(cache.hits(), 1);
+
+    cache.get(nchw, nhwc, eng);
+    ASSERT_EQ(cache.hits(), 2);
+    cache.get(nchw, blocked, eng);
+    ASSERT_EQ(cache.misses(), 4);
+}
+
+TEST(ReorderCacheTest, conversionIsCached) {
+    mkldnn::engine eng(mkldnn::engine::kind::cpu, 0);
+    auto& cache = MKLDNNReorderCache::GetInstance();
+    cache.clear();
+
+    std::vector<int32_t> data(2 * 16 * 3 * 5);
+    for (size_t i = 0; i < data.size(); i++) {
+        data[i] = static_cast<int32_t>(i % 100);
+    }
+    MKLDNNMemory src(eng);
+    src.Create(reorderTestDims, mkldnn::memory::data_type::s32, mkldnn::memory::format_tag::nchw, data.data());
+    MKLDNNMemory dst(eng);
+    dst.Create(reorderTestDims, mkldnn::memory::data_type::f32, mkldnn::memory::format_tag::nhwc);
+
+    for (int i = 0; i < 2; i++) {
+        MKLDNNMemory::reorderData(src, dst);
+    }
+    ASSERT_EQ(cache.misses(), 1);
+    ASSERT_EQ(cache.hits(), 1);
+
+    auto result = static_cast<const float*>(dst.GetPtr());
+    const size_t C = 16, HW = 15;
+    for (size_t n = 0; n < 2; n++) {
+        for (size_t c = 0; c < C; c++) {
+            for (size_t hw = 0; hw < HW; hw++) {
+                ASSERT_EQ(static_cast<float>(data[(n * C + c) * HW + hw]), result[(n * HW + hw) * C + c]);
+            }
+        }
+    }
+}
+
+TEST(ReorderCacheTest, entryOfReleasedEngineIsNotReused) {
+    MKLDNNReorderCache cache;
+    const mkldnn::memory::desc nchw(reorderTestDims, mkldnn::memory::data_type::f32, mkldnn::memory::format_tag::nchw);
+    const mkldnn::memory::desc nhwc(reorderTestDims, mkldnn::memory::data_type::f32, mkldnn::memory::format_tag::nhwc);
+
+    {
+        mkldnn::engine released(mkldnn::engine::kind::cpu, 0);
+        cache.get(nchw, nhwc, released);
+    }
+    // the cache keeps the first engine alive, so the new one can't reuse its address
+    mkldnn::engine eng(mkldnn::engine::kind::cpu, 0);
+    cache.get(nchw, nhwc, eng);
+    ASSERT_EQ(cache.misses(), 2);
+    ASSERT_EQ(cache.size(), 2);
+}
@@ -0,0 +1,46 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include "mkldnn_workspace_pool.hpp"
+
+using namespace MKLDNNPlugin;
+
+TEST(WorkspacePoolTest, releasedWorkspaceIsReused) {
+    MKLDNNWorkspacePool pool;
+
+    void* first = nullptr;
+    {
+        auto lease = pool.acquire(1024);
+        first = lease.data();
+        ASSERT_NE(first, nullptr);
+    }
+    auto lease = pool.acquire(512, first);
+    ASSERT_EQ(first, lease.data());
+
+    auto stats = pool.statistics();
+    ASSERT_EQ(stats.workspaces, 1);
+    ASSERT_EQ(stats.size, 1024);
+    ASSERT_EQ(stats.leases, 2);
+    ASSERT_EQ(stats.contendedLeases, 0);
+}
+
+TEST(WorkspacePoolTest, concurrentLeasesGetDifferentWorkspaces) {
+    MKLDNNWorkspacePool pool;
+
+    auto first = pool.acquire(256);
+    auto second = pool.acquire(256, first.data());
+    ASSERT_NE(first.data(), second.data());
+
+    auto stats = pool.statistics();
+    ASSERT_EQ(stats.workspaces, 2);
+    ASSERT_EQ(stats.contendedLeases, 1);
+
+    // the workspace grows to the largest requested size
+    second = MKLDNNWorkspacePool::Lease();
+    auto grown = pool.acquire(4096);
+    ASSERT_NE(grown.data(), nullptr);
+    ASSERT_EQ(pool.statistics().size, 256 + 4096);
+}
@@ -0,0 +1,229 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+// to suppress deprecated definition errors
+#define IMPLEMENT_INFERENCE_ENGINE_PLUGIN
+#include "runtime/floatmath.h"
+#include "runtime/cnn.h"
+
+namespace {
+
+std::vector<float> generate(size_t size, uint32_t seed) {
+    std::mt19937 gen(seed);
+    std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
+    std::vector<float> data(size);
+    for (auto& value : data) {
+        value = dist(gen);
+    }
+    return data;
+}
+
+// The straightforward loop which was used by the software emulation mode before
+void referenceAffine(uint32_t M, uint32_t N, uint32_t K, const float* A, const float* B, float* C,
+                     const uint32_t* rows = nullptr, uint32_t L = 0) {
+    const uint32_t count = rows ? L : M;
+    for (uint32_t l = 0; l < count; l++) {
+        const uint32_t i = rows ? rows[l] : l;
+        for (uint32_t j = 0; j < N; j++) {
+            float sum = C[l * N + j];
+            for (uint32_t k = 0; k < K; k++) {
+                sum += A[i * K + k] * B[k * N + j];
+            }
+            C[l * N + j] = sum;
+        }
+    }
+}
+
+void expectNear(const std::vector<float>& expected, const std::vector<float>& actual) {
+    ASSERT_EQ(expected.size(), actual.size());
+    for (size_t i = 0; i < expected.size(); i++) {
+        ASSERT_NEAR(expected[i], actual[i], 1e-3f) << "at " << i;
+    }
+}
+
+class GNAFloatAffineTest : public ::testing::TestWithParam<std::tuple<uint32_t, uint32_t, uint32_t>> {};
+
+}  // namespace
+
+TEST_P(GNAFloatAffineTest, matchesReference) {
+    uint32_t M, N, K;
+    std::tie(M, N, K) = GetParam();
+    auto A = generate(M * K, 1);
+    auto B = generate(K * N, 2);
+    auto expected = generate(M * N, 3);
+    auto actual = expected;
+
+    referenceAffine(M, N, K, A.data(), B.data(), expected.data());
+    cblas_sgemm1(CblasRowMajor, CblasNoTrans, CblasNoTrans, M, N, K, 1.0, A.data(), K, B.data(), N, 1.0, actual.data(), N);
+    expectNear(expected, actual);
+}
+
+TEST_P(GNAFloatAffineTest, subsetMatchesReference) {
+    uint32_t M, N, K;
+    std::tie(M, N, K) = GetParam();
+    auto A = generate(M * K, 1);
+    auto B = generate(K * N, 2);
+    std::vector<uint32_t> rows;
+    for (uint32_t i = 0; i < M; i += 3) {
+        rows.push_back(M - 1 - i);
+    }
+    const auto L = static_cast<uint32_t>(rows.size());
+    auto expected = generate(L * N, 3);
+    auto actual = expected;
+
+    referenceAffine(M, N, K, A.data(), B.data(), expected.data(), rows.data(), L);
+    cblas_sgemm_subset(CblasRowMajor, CblasNoTrans, CblasNoTrans, M, N, K, 1.0, A.data(), K, B.data(), N, 1.0,
+                       actual.data(), N, rows.data(), L);
+    expectNear(expected, actual);
+}
+
+INSTANTIATE_TEST_CASE_P(GNAFloatRuntime, GNAFloatAffineTest,
+                        ::testing::Values(std::make_tuple(1, 1, 1),
+                                          std::make_tuple(7, 1, 13),
+                                          std::make_tuple(64, 8, 440),
+                                          std::make_tuple(513, 3, 1027)));
+
+TEST(GNAFloatRuntime, convolution1DMatchesReference) {
+    const uint32_t numFilters = 10, filterRows = 3, featureMaps = 4, featureMapColumns = 5, featureMapRows = 20;
+    const uint32_t coefficients = filterRows * featureMaps * featureMapColumns;
+    const uint32_t bandStride = featureMaps * featureMapColumns;
+    const uint32_t outputs = featureMapRows - filterRows + 1;
+
+    auto inputs = generate(featureMapRows * bandStride, 1);
+    auto filters = generate(numFilters * coefficients, 2);
+    auto biases = generate(numFilters, 3);
+    std::vector<float> actual(outputs * numFilters);
+
+    intel_dnn_component_t component{};
+    component.num_rows_in = 1;
+    component.num_rows_out = 1;
+    component.num_columns_out = outputs * numFilters;
+    component.op.conv1D.num_filters = numFilters;
+    component.op.conv1D.num_filter_rows = filterRows;
+    component.op.conv1D.num_filter_coefficients = coefficients;
+    component.op.conv1D.num_feature_maps = featureMaps;
+    component.op.conv1D.num_feature_map_rows = featureMapRows;
+    component.op.conv1D.num_feature_map_columns = featureMapColumns;
+    component.op.conv1D.ptr_filters = filters.data();
+    component.op.conv1D.ptr_biases = biases.data();
+    component.ptr_inputs = inputs.data();
+    component.ptr_outputs = actual.data();
+    component.original_layer_name = "conv";
+    CNNFilter32(&component);
+
+    std::vector<float> expected(outputs * numFilters);
+    for (uint32_t j = 0; j < outputs; j++) {
+        for (uint32_t i = 0; i < numFilters; i++) {
+            float sum = biases[i];
+            for (uint32_t k = 0; k < coefficients; k++) {
+                sum += inputs[j * bandStride + k] * filters[i * coefficients + k];
+            }
+            expected[j * numFilters + i] = sum;
+        }
+    }
+    expectNear(expected, actual);
+}
+
+#if GNA_LIB_VER == 2
+namespace {
+
+// IH, IW, IC, OC, kh, kw, stride H, stride W, padding H, padding W
+using Convolution2DParams = std::tuple<uint32_t, uint32_t, uint32_t, uint32_t, uint32_t, uint32_t,
+                                       uint32_t, uint32_t, uint32_t, uint32_t>;
+
+class GNAFloatConvolution2DTest : public ::testing::TestWithParam<Convolution2DParams> {};
+
+}  // namespace
+
+TEST_P(GNAFloatConvolution2DTest, matchesReference) {
+    uint32_t IH, IW, IC, OC, kh, kw, SH, SW, PH, PW;
+    std::tie(IH, IW, IC, OC, kh, kw, SH, SW, PH, PW) = GetParam();
+    const uint32_t OH = (IH + 2 * PH - kh) / SH + 1;
+    const uint32_t OW = (IW + 2 * PW - kw) / SW + 1;
+    // every kernel is padded to 16 bytes
+    const uint32_t kernelStride = (kh * kw * IC + 3) / 4 * 4;
+
+    auto inputs = generate(IH * IW * IC, 1);
+    auto filters = generate(OC * kernelStride, 2);
+    auto biases = generate(OC, 3);
+    std::vector<float> actual(OH * OW * OC);
+
+    intel_dnn_component_t component{};
+    component.tensors = {{{1, IH, IW, IC}, OvGnaTypeInt32, OvGnaModeDefault},
+                         {{1, OH, OW, OC}, OvGnaTypeInt32, OvGnaModeDefault},
+                         {{OC, kh, kw, IC}, OvGnaTypeInt32, OvGnaModeDefault}};
+    component.op.conv2D.convStride = {SH, SW};
+    component.op.conv2D.zeroPadding = {PH, PW};
+    component.op.conv2D.ptr_filters = filters.data();
+    component.op.conv2D.ptr_biases = biases.data();
+    component.ptr_inputs = inputs.data();
+    component.ptr_outputs = actual.data();
+    component.original_layer_name = "conv";
+    CNN2DFilter32(&component);
+
+    // HWC layout, the filter elements over the zero padding are skipped
+    std::vector<float> expected(OH * OW * OC);
+    for (uint32_t oh = 0; oh < OH; oh++) {
+        for (uint32_t ow = 0; ow < OW; ow++) {
+            for (uint32_t oc = 0; oc < OC; oc++) {
+                float sum = biases[oc];
+                for (uint32_t fh = 0; fh < kh; fh++) {
+                    for (uint32_t fw = 0; fw < kw; fw++) {
+                        const int ih = static_cast<int>(oh * SH + fh) - static_cast<int>(PH);
+                        const int iw = static_cast<int>(ow * SW + fw) - static_cast<int>(PW);
+                        if (ih < 0 || iw < 0 || ih >= static_cast<int>(IH) || iw >= static_cast<int>(IW)) {
+                            continue;
+                        }
+                        for (uint32_t c = 0; c < IC; c++) {
+                            sum += inputs[(ih * IW + iw) * IC + c] * filters[oc * kernelStride + (fh * kw + fw) * IC + c];
+                        }
+                    }
+                }
+                expected[(oh * OW + ow) * OC + oc] = sum;
+            }
+        }
+    }
+    expectNear(expected, actual);
+}
+
+INSTANTIATE_TEST_CASE_P(GNAFloatRuntime, GNAFloatConvolution2DTest,
+                        ::testing::Values(std::make_tuple(8, 8, 3, 4, 3, 3, 1, 1, 0, 0),
+                                          std::make_tuple(8, 8, 3, 4, 3, 3, 1, 1, 1, 1),
+                                          std::make_tuple(9, 7, 2, 5, 3, 3, 2, 2, 0, 0),
+                                          std::make_tuple(9, 7, 2, 5, 3, 3, 2, 2, 1, 1),
+                                          std::make_tuple(16, 1, 8, 6, 5, 1, 3, 1, 2, 0),
+                                          std::make_tuple(10, 12, 4, 3, 2, 4, 2, 3, 1, 2)));
+#endif
+
+// Compares the affine kernel with the former straightforward loop on a typical speech model layer
+TEST(GNAFloatRuntime, DISABLED_affineBenchmark) {
+    const uint32_t M = 2048, N = 8, K = 2048;
+    const int iterations = 20;
+    auto A = generate(M * K, 1);
+    auto B = generate(K * N, 2);
+    std::vector<float> C(M * N, 0.0f);
+
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < iterations; i++) {
+        referenceAffine(M, N, K, A.data(), B.data(), C.data());
+    }
+    auto finish = std::chrono::high_resolution_clock::now();
+    std::cout << "Reference affine execution time : "
+              << std::chrono::duration_cast<std::chrono::milliseconds>(finish - start).count() << " ms" << std::endl;
+
+    start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < iterations; i++) {
+        cblas_sgemm1(CblasRowMajor, CblasNoTrans, CblasNoTrans, M, N, K, 1.0, A.data(), K, B.data(), N, 1.0, C.data(), N);
+    }
+    finish = std::chrono::high_resolution_clock::now();
+    std::cout << "cblas_sgemm1 execution time : "
+              << std::chrono::duration_cast<std::chrono::milliseconds>(finish - start).count() << " ms" << std::endl;
+}
@@ -0,0 +1,116 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <vector>
+
+#include <gtest/gtest.h>
+// to suppress deprecated definition errors
+#define IMPLEMENT_INFERENCE_ENGINE_PLUGIN
+#include "runtime/pwl.h"
+#include "runtime/pwl_design_cache.hpp"
+
+using namespace GNAPluginNS::runtime;
+
+namespace {
+
+void expectEqual(const std::vector<pwl_t>& expected, const std::vector<pwl_t>& actual) {
+    ASSERT_EQ(expected.size(), actual.size());
+    for (size_t i = 0; i < expected.size(); i++) {
+        EXPECT_DOUBLE_EQ(expected[i].t, actual[i].t);
+        EXPECT_DOUBLE_EQ(expected[i].alpha, actual[i].alpha);
+        EXPECT_DOUBLE_EQ(expected[i].beta, actual[i].beta);
+        EXPECT_DOUBLE_EQ(expected[i].m, actual[i].m);
+        EXPECT_DOUBLE_EQ(expected[i].b, actual[i].b);
+    }
+}
+
+}  // namespace
+
+class PwlDesignCacheTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        PwlDesignCache::instance().clear();
+    }
+    void TearDown() override {
+        PwlDesignCache::instance().clear();
+        std::remove("gna_pwl_design.cache");
+    }
+};
+
+TEST_F(PwlDesignCacheTest, searchResultIsReused) {
+    auto activation = DnnActivation::fromType(kActSigmoid);
+    double errPct = 0.0;
+    auto pwl = pwl_search(activation, -SIGMOID_DOMAIN, SIGMOID_DOMAIN, PWL_DESIGN_THRESHOLD, 1.0, PWL_DESIGN_SAMPLES, errPct);
+    ASSERT_FALSE(pwl.empty());
+
+    PwlDesignCache::Design design;
+    ASSERT_TRUE(PwlDesignCache::instance().find(
+        PwlDesignCache::Key(activation, -SIGMOID_DOMAIN, SIGMOID_DOMAIN, PWL_DESIGN_THRESHOLD, 1.0, PWL_DESIGN_SAMPLES), design));
+    expectEqual(pwl, design.pwl);
+    EXPECT_DOUBLE_EQ(errPct, design.err_pct);
+
+    double cachedErrPct = 0.0;
+    expectEqual(pwl, pwl_search(activation, -SIGMOID_DOMAIN, SIGMOID_DOMAIN, PWL_DESIGN_THRESHOLD, 1.0, PWL_DESIGN_SAMPLES,
+                                cachedErrPct));
+    EXPECT_DOUBLE_EQ(errPct, cachedErrPct);
+}
+
+TEST_F(PwlDesignCacheTest, keyDependsOnPowArguments) {
+    auto square = DnnActivation::fromType(kActPow);
+    square.args.pow = {2.0f, 1.0f, 0.0f};
+    auto cube = square;
+    cube.args.pow.exponent = 3.0f;
+
+    PwlDesignCache::Key squareKey(square, -1.0, 1.0, PWL_DESIGN_THRESHOLD, 1.0, PWL_DESIGN_SAMPLES);
+    PwlDesignCache::Key cubeKey(cube, -1.0, 1.0, PWL_DESIGN_THRESHOLD, 1.0, PWL_DESIGN_SAMPLES);
+    EXPECT_TRUE(squareKey < cubeKey || cubeKey < squareKey);
+}
+
+TEST_F(PwlDesignCacheTest, designsArePersisted) {
+    auto activation = DnnActivation::fromType(kActTanh);
+    PwlDesignCache::Key key(activation, -5.0, 5.0, PWL_DESIGN_THRESHOLD, 0.5, PWL_DESIGN_SAMPLES);
+    PwlDesignCache::Design stored;
+    stored.pwl.resize(3);
+    for (size_t i = 0; i < stored.pwl.size(); i++) {
+        stored.pwl[i] = {0.5 * i, 1.0 * i, 2.0 * i, 3.0 * i, 4.0 * i};
+    }
+    stored.err_pct = 0.25;
+    PwlDesignCache::instance().insert(key, stored);
+    PwlDesignCache::instance().save(".");
+
+    PwlDesignCache::instance().clear();
+    PwlDesignCache::Design loaded;
+    ASSERT_FALSE(PwlDesignCache::instance().find(key, loaded));
+    PwlDesignCache::instance().load(".");
+    ASSERT_TRUE(PwlDesignCache::instance().find(key, loaded));
+    expectEqual(stored.pwl, loaded.pwl);
+    EXPECT_DOUBLE_EQ(stored.err_pct, loaded.err_pct);
+}
+
+TEST_F(PwlDesignCacheTest, corruptedSegmentCountIsIgnored) {
+    auto activation = DnnActivation::fromType(kActTanh);
+    PwlDesignCache::Key key(activation, -5.0, 5.0, PWL_DESIGN_THRESHOLD, 0.5, PWL_DESIGN_SAMPLES);
+    PwlDesignCache::Design stored;
+    stored.pwl.resize(2);
+    stored.err_pct = 0.25;
+    PwlDesignCache::instance().insert(key, stored);
+    PwlDesignCache::instance().save(".");
+
+    {
+        // magic, cache and search versions, number of designs, then key, error and number of segments
+        std::fstream file("gna_pwl_design.cache", std::ios::in | std::ios::out | std::ios::binary);
+        ASSERT_TRUE(file.good());
+        file.seekp(sizeof("GNAPWL") + 2 * sizeof(uint32_t) + sizeof(uint64_t) + sizeof(PwlDesignCache::Key) + sizeof(double));
+        const uint64_t segments = uint64_t(1) << 60;
+        file.write(reinterpret_cast<const char*>(&segments), sizeof(segments));
+    }
+
+    PwlDesignCache::instance().clear();
+    PwlDesignCache::instance().load(".");
+    PwlDesignCache::Design loaded;
+    EXPECT_FALSE(PwlDesignCache::instance().find(key, loaded));
+}
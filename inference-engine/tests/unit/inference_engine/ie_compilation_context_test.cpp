@@ -193,6 +193,17 @@ TEST(NetworkContext_CNNNetwork, HashOfSame) {
               NetworkCompilationContext::computeHash(net2, {}));
 }
 
+TEST(NetworkContext_CNNNetwork, LegacyHashOfSame) {
+    auto net1 = createNetwork();
+    auto net2 = createNetwork();
+    ASSERT_EQ(NetworkCompilationContext::computeLegacyHash(net1, {}),
+              NetworkCompilationContext::computeLegacyHash(net2, {}));
+    ASSERT_NE(NetworkCompilationContext::computeLegacyHash(net1, {}),
+              NetworkCompilationContext::computeHash(net1, {}));
+    ASSERT_NE(NetworkCompilationContext::computeLegacyHash(net1, {{"key", "value"}}),
+              NetworkCompilationContext::computeLegacyHash(net2, {}));
+}
+
 TEST(NetworkContext_CNNNetwork, HashWithConfig) {
     auto net1 = createNetwork();
     auto net2 = createNetwork();
@@ -349,6 +360,51 @@ TEST(NetworkContext_CNNNetwork, HashWithDifferentMeanValues) {
               NetworkCompilationContext::computeHash(net3, {}));
 }
 
+TEST(NetworkContext_CNNNetwork, HashWithDifferentConstantValues) {
+    auto updateConstant = [&](CNNNetwork& cnnNet) {
+        for (const auto& op : cnnNet.getFunction()->get_ops()) {
+            if (op->get_friendly_name() == "mul_constant") {
+                auto constant = std::dynamic_pointer_cast<ngraph::opset6::Constant>(op);
+                const_cast<int8_t*>(constant->get_data_ptr<int8_t>())[0] = 4;
+            }
+        }
+    };
+    auto net1 = createNetwork();
+    auto net2 = createNetwork();
+    updateConstant(net2);
+    auto net3 = createNetwork();
+    updateConstant(net3);
+    ASSERT_NE(NetworkCompilationContext::computeHash(net1, {}),
+              NetworkCompilationContext::computeHash(net2, {}));
+    ASSERT_EQ(NetworkCompilationContext::computeHash(net2, {}),
+              NetworkCompilationContext::computeHash(net3, {}));
+}
+
+TEST(NetworkContext_CNNNetwork, HashWithDifferentNames) {
+    auto net1 = createNetwork();
+    auto net2 = createNetwork();
+    net2.getFunction()->get_parameters().front()->set_friendly_name("Parameter2");
+    ASSERT_NE(NetworkCompilationContext::computeHash(net1, {}),
+              NetworkCompilationContext::computeHash(net2, {}));
+}
+
+TEST(NetworkContext_CNNNetwork, HashWithDifferentAttributes) {
+    auto createNetworkWithPad = [](ngraph::op::PadMode mode) {
+        auto data = std::make_shared<ngraph::opset6::Parameter>(ngraph::element::f32, ngraph::Shape{1, 3, 4, 4});
+        auto pads = ngraph::opset6::Constant::create(ngraph::element::i64, ngraph::Shape{4}, {0, 0, 1, 1});
+        auto pad = std::make_shared<ngraph::opset6::Pad>(data, pads, pads, mode);
+        auto res = std::make_shared<ngraph::opset6::Result>(pad);
+        return CNNNetwork(std::make_shared<ngraph::Function>(ngraph::ResultVector{res}, ngraph::ParameterVector{data}));
+    };
+    auto net1 = createNetworkWithPad(ngraph::op::PadMode::REFLECT);
+    auto net2 = createNetworkWithPad(ngraph::op::PadMode::EDGE);
+    auto net3 = createNetworkWithPad(ngraph::op::PadMode::EDGE);
+    ASSERT_NE(NetworkCompilationContext::computeHash(net1, {}),
+              NetworkCompilationContext::computeHash(net2, {}));
+    ASSERT_EQ(NetworkCompilationContext::computeHash(net2, {}),
+              NetworkCompilationContext::computeHash(net3, {}));
+}
+
 // Verify all internal hash calculations are thread-safe (like ngraph::function serialization)
 TEST(NetworkContext_CNNNetwork, HashOfSameMultiThreading) {
     auto net1 = createNetwork();
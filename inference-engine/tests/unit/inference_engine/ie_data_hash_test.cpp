@@ -0,0 +1,74 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <vector>
+
+#include "ie_data_hash.hpp"
+
+using namespace InferenceEngine;
+
+namespace {
+
+std::vector<uint8_t> generateData(size_t size) {
+    std::vector<uint8_t> data(size);
+    uint32_t state = 1;
+    for (auto& value : data) {
+        state = state * 1664525u + 1013904223u;
+        value = static_cast<uint8_t>(state >> 24);
+    }
+    return data;
+}
+
+}  // namespace
+
+TEST(DataHashTests, matchesReferenceValues) {
+    const char* text = "Nobody inspects the spammish repetition";
+    EXPECT_EQ(0xEF46DB3751D8E999ULL, data_hash("", 0));
+    EXPECT_EQ(0x44BC2CF5AD770999ULL, data_hash("abc", 3));
+    EXPECT_EQ(0xFBCEA83C8A378BF1ULL, data_hash(text, std::strlen(text)));
+}
+
+TEST(DataHashTests, isStableForSameContent) {
+    auto data = generateData(3 * 1024 * 1024 + 17);
+    auto copy = data;
+    EXPECT_EQ(data_hash(data.data(), data.size()), data_hash(copy.data(), copy.size()));
+}
+
+TEST(DataHashTests, dependsOnEachByte) {
+    auto data = generateData(3 * 1024 * 1024 + 17);
+    const auto reference = data_hash(data.data(), data.size());
+    for (size_t pos : {size_t(0), size_t(256 * 1024 - 1), size_t(256 * 1024), data.size() - 1}) {
+        data[pos] ^= 1;
+        EXPECT_NE(reference, data_hash(data.data(), data.size())) << "position " << pos;
+        data[pos] ^= 1;
+    }
+}
+
+TEST(DataHashTests, dependsOnSize) {
+    std::vector<uint8_t> data(1024 * 1024, 0);
+    EXPECT_NE(data_hash(data.data(), data.size()), data_hash(data.data(), data.size() - 1));
+    EXPECT_NE(data_hash(data.data(), 8), data_hash(data.data(), 16));
+}
+
+TEST(DataHashTests, dependsOnChunksOrder) {
+    const size_t chunk = 256 * 1024;
+    auto data = generateData(2 * chunk);
+    auto swapped = data;
+    std::memcpy(swapped.data(), data.data() + chunk, chunk);
+    std::memcpy(swapped.data() + chunk, data.data(), chunk);
+    EXPECT_NE(data_hash(data.data(), data.size()), data_hash(swapped.data(), swapped.size()));
+}
+
+TEST(DataHashTests, doesNotDependOnAlignment) {
+    auto data = generateData(256 * 1024 + 33);
+    std::vector<uint8_t> shifted(data.size() + 3);
+    for (size_t offset = 1; offset < 4; offset++) {
+        std::memcpy(shifted.data() + offset, data.data(), data.size());
+        EXPECT_EQ(data_hash(data.data(), data.size()), data_hash(shifted.data() + offset, data.size()))
+            << "offset " << offset;
+    }
+}
@@ -0,0 +1,69 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "common_test_utils/test_common.hpp"
+
+#include "mmap_allocator.hpp"
+
+using namespace InferenceEngine;
+
+class MmapBlobTests : public CommonTestUtils::TestsCommon {
+protected:
+    void SetUp() override {
+        CommonTestUtils::TestsCommon::SetUp();
+        fileName = "mmap_blob_test_" + std::to_string(reinterpret_cast<size_t>(this)) + ".bin";
+        data.resize(4096 + 17);
+        for (size_t i = 0; i < data.size(); ++i)
+            data[i] = static_cast<char>(i % 251);
+        std::ofstream file(fileName, std::ios::binary);
+        file.write(data.data(), data.size());
+    }
+
+    void TearDown() override {
+        std::remove(fileName.c_str());
+        CommonTestUtils::TestsCommon::TearDown();
+    }
+
+    std::string fileName;
+    std::vector<char> data;
+};
+
+TEST_F(MmapBlobTests, canMapFile) {
+    auto blob = details::make_mmap_blob(fileName);
+    ASSERT_NE(nullptr, blob);
+    ASSERT_EQ(Precision::U8, blob->getTensorDesc().getPrecision());
+    ASSERT_EQ(data.size(), blob->byteSize());
+    auto mapped = blob->cbuffer().as<const char*>();
+    ASSERT_NE(nullptr, mapped);
+    for (size_t i = 0; i < data.size(); ++i)
+        ASSERT_EQ(data[i], mapped[i]);
+}
+
+TEST_F(MmapBlobTests, writesDoNotChangeFile) {
+    {
+        auto blob = details::make_mmap_blob(fileName);
+        ASSERT_NE(nullptr, blob);
+        blob->buffer().as<char*>()[0] = data[0] + 1;
+    }
+    std::ifstream file(fileName, std::ios::binary);
+    char first = 0;
+    file.read(&first, 1);
+    ASSERT_EQ(data[0], first);
+}
+
+TEST_F(MmapBlobTests, returnsNullForMissingFile) {
+    ASSERT_EQ(nullptr, details::make_mmap_blob(fileName + ".missing"));
+}
+
+TEST_F(MmapBlobTests, returnsNullForEmptyFile) {
+    std::ofstream(fileName, std::ios::binary | std::ios::trunc).close();
+    ASSERT_EQ(nullptr, details::make_mmap_blob(fileName));
+}
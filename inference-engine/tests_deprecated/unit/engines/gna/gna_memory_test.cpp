@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <unordered_map>
 #include <vector>
 #include <gtest/gtest.h>
 #include "memory/gna_memory.hpp"
@@ -436,4 +437,76 @@ TEST_F(GNAMemoryTest, canUpdateSizeOfPushRequestWithBindRequestWhenAlloc) {
     ASSERT_FLOAT_EQ(pFutureInput[0], 1);
     ASSERT_FLOAT_EQ(pFutureInput[1], 2);
     ASSERT_FLOAT_EQ(pFutureInput[2], 3);
-}
\ No newline at end of file
+}
+
+TEST_F(GNAMemoryTest, canShareMemoryOfBuffersNotUsedAtTheSameTime) {
+    // chain of operations: each one reads output of the previous one
+    void *inputs[4] = {};
+    void *outputs[4] = {};
+    std::unordered_map<const void *, BufferUsage> usages;
+    for (size_t i = 0; i != 3; i++) {
+        mem.reserve_ptr(&outputs[i], 64, 64);
+        mem.bind_ptr(&inputs[i + 1], &outputs[i]);
+        usages[&outputs[i]] = {BufferUsage::WRITE, i};
+        usages[&inputs[i + 1]] = {BufferUsage::READ, i + 1};
+    }
+    // output of the last operation isn't described, so it's kept for the whole inference
+    mem.reserve_ptr(&outputs[3], 64, 64);
+
+    mem.setLifetimes(usages);
+    mem.commit();
+
+    ASSERT_EQ(mem.getRWBytesWithoutReuse(), 4 * 64);
+    ASSERT_EQ(mem.getRWBytes(), 3 * 64);
+    ASSERT_EQ(outputs[0], outputs[2]);
+    ASSERT_NE(outputs[0], outputs[1]);
+    ASSERT_NE(outputs[1], outputs[3]);
+    ASSERT_NE(outputs[0], outputs[3]);
+    ASSERT_EQ(inputs[1], outputs[0]);
+    ASSERT_EQ(inputs[2], outputs[1]);
+    ASSERT_EQ(inputs[3], outputs[2]);
+}
+
+TEST_F(GNAMemoryTest, doesNotShareMemoryOfBufferReadBeforeWritten) {
+    void *input = nullptr;
+    void *output = nullptr;
+    void *other = nullptr;
+    std::unordered_map<const void *, BufferUsage> usages;
+
+    // buffer read by the first operation keeps data of the previous inference
+    mem.reserve_ptr(&output, 64, 64);
+    mem.bind_ptr(&input, &output);
+    usages[&input] = {BufferUsage::READ, 0};
+    usages[&output] = {BufferUsage::WRITE, 1};
+
+    mem.reserve_ptr(&other, 64, 64);
+    usages[&other] = {BufferUsage::WRITE, 2};
+
+    mem.setLifetimes(usages);
+    mem.commit();
+
+    ASSERT_EQ(mem.getRWBytes(), 2 * 64);
+    ASSERT_NE(output, other);
+}
+
+TEST_F(GNAMemoryTest, doesNotShareMemoryOfPaddedBuffer) {
+    void *input = nullptr;
+    void *output = nullptr;
+    void *other = nullptr;
+    std::unordered_map<const void *, BufferUsage> usages;
+
+    // reading past the written data pads the buffer, the padding has to stay zeroed
+    mem.reserve_ptr(&output, 64, 64);
+    mem.bind_ptr(&input, &output, 0, 128);
+    usages[&output] = {BufferUsage::WRITE, 0};
+    usages[&input] = {BufferUsage::READ, 1};
+
+    mem.reserve_ptr(&other, 64, 64);
+    usages[&other] = {BufferUsage::WRITE, 2};
+
+    mem.setLifetimes(usages);
+    mem.commit();
+
+    ASSERT_EQ(mem.getRWBytes(), 128 + 64);
+    ASSERT_NE(output, other);
+}
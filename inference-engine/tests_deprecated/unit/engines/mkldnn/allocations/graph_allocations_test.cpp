@@ -0,0 +1,207 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "test_graph.hpp"
+
+#include <ie_iextension.h>
+#include <ie_core.hpp>
+#include "tests_common.hpp"
+#include "utils/allocation_counter.h"
+
+#include <cstdlib>
+#include <new>
+
+using namespace ::testing;
+using namespace std;
+using namespace mkldnn;
+
+// Reports heap allocations to the plugin counter, so tests can check what MKLDNNGraph::Infer allocates.
+// It's the reason these tests live in their own executable.
+void* operator new(std::size_t size) {
+    MKLDNNPlugin::AllocationCounter::onAllocation();
+    if (void* ptr = std::malloc(size ? size : 1))
+        return ptr;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept {
+    std::free(ptr);
+}
+
+class InPlaceDoublePrimitiveImpl : public InferenceEngine::ILayerExecImpl {
+public:
+    InPlaceDoublePrimitiveImpl(const InferenceEngine::CNNLayer *layer) {
+        cnnLayer = const_cast<InferenceEngine::CNNLayer *>(layer);
+    }
+    InferenceEngine::StatusCode getSupportedConfigurations(std::vector<InferenceEngine::LayerConfig>& conf, InferenceEngine::ResponseDesc *resp) noexcept override {
+        InferenceEngine::LayerConfig config;
+        config.dynBatchSupport = true;
+        if (cnnLayer->outData.size() != 1 && cnnLayer->insData.size() != 1)
+            return InferenceEngine::GENERAL_ERROR;
+        InferenceEngine::DataConfig cfg;
+        cfg.constant = false;
+        cfg.inPlace = 0;
+        InferenceEngine::SizeVector order;
+        for (size_t i = 0; i < cnnLayer->outData[0]->getTensorDesc().getDims().size(); i++) {
+            order.push_back(i);
+        }
+        cfg.desc = InferenceEngine::TensorDesc(cnnLayer->outData[0]->getTensorDesc().getPrecision(),
+                                               cnnLayer->outData[0]->getTensorDesc().getDims(),
+                                               {cnnLayer->outData[0]->getTensorDesc().getDims(), order});
+        config.outConfs.push_back(cfg);
+        config.inConfs.push_back(cfg);
+        conf.push_back(config);
+        return InferenceEngine::OK;
+    }
+    InferenceEngine::StatusCode init(InferenceEngine::LayerConfig& config, InferenceEngine::ResponseDesc *resp) noexcept override {
+        return InferenceEngine::OK;
+    }
+    InferenceEngine::StatusCode execute(std::vector<InferenceEngine::Blob::Ptr>& inputs, std::vector<InferenceEngine::Blob::Ptr>& outputs, InferenceEngine::ResponseDesc *resp) noexcept override {
+        const float *src_data = inputs[0]->buffer();
+        float *dst_data = outputs[0]->buffer();
+        size_t data_size = inputs[0]->size();
+        for (size_t i = 0; i < data_size; i++) {
+            dst_data[i] = src_data[i]*2;
+        }
+        return InferenceEngine::OK;
+    }
+
+private:
+    InferenceEngine::CNNLayer* cnnLayer;
+};
+
+class InPlaceDoublePrimitiveFactory : public InferenceEngine::ILayerImplFactory {
+public:
+    InPlaceDoublePrimitiveFactory(const InferenceEngine::CNNLayer *layer) {
+        cnnLayer = const_cast<InferenceEngine::CNNLayer *>(layer);
+    }
+    InferenceEngine::StatusCode getImplementations(std::vector<InferenceEngine::ILayerImpl::Ptr>& impls, InferenceEngine::ResponseDesc *resp) noexcept override {
+        impls.push_back(InferenceEngine::ILayerImpl::Ptr(new InPlaceDoublePrimitiveImpl(cnnLayer)));
+        return InferenceEngine::OK;
+    }
+
+private:
+    InferenceEngine::CNNLayer * cnnLayer;
+};
+
+class DoubleExtension : public InferenceEngine::Extensions::Cpu::MKLDNNExtensions {
+public:
+    void GetVersion(const InferenceEngine::Version *&versionInfo) const noexcept override {}
+    void Unload() noexcept override {}
+    InferenceEngine::StatusCode getPrimitiveTypes(char**& types, unsigned int& size, InferenceEngine::ResponseDesc* resp) noexcept override {
+        static const std::string type = "NewDoubleLayer";
+        types = new char *[1];
+        types[0] = new char[type.size() + 1];
+        std::copy(type.begin(), type.end(), types[0]);
+        types[0][type.size()] = '\0';
+        size = 1;
+        return InferenceEngine::OK;
+    }
+    InferenceEngine::StatusCode getFactoryFor(InferenceEngine::ILayerImplFactory *&factory,
+                                              const InferenceEngine::CNNLayer *cnnLayer,
+                                              InferenceEngine::ResponseDesc *resp) noexcept override {
+        if (cnnLayer->type != "NewDoubleLayer") {
+            std::string errorMsg = std::string("Factory for ") + cnnLayer->type + " wasn't found!";
+            errorMsg.copy(resp->msg, sizeof(resp->msg) - 1);
+            return InferenceEngine::NOT_FOUND;
+        }
+        factory = new InPlaceDoublePrimitiveFactory(cnnLayer);
+        return InferenceEngine::OK;
+    }
+};
+
+class MKLDNNGraphAllocationTests: public TestsCommon {
+protected:
+    virtual void SetUp() {
+        TestsCommon::SetUp();
+        extension.reset(new DoubleExtension());
+    }
+    std::shared_ptr<InferenceEngine::IExtension> extension;
+};
+
+TEST_F(MKLDNNGraphAllocationTests, ExecuteGenericPrimitiveWithoutAllocations) {
+    std::string model = R"V0G0N(
+        <Net Name="DoubleLayer_Only" version="2" precision="FP32" batch="1">
+            <layers>
+                <layer name="in1" type="Input" precision="FP32" id="0">
+                    <output>
+                        <port id="0">
+                            <dim>1</dim>
+                            <dim>3</dim>
+                            <dim>5</dim>
+                            <dim>5</dim>
+                        </port>
+                    </output>
+                </layer>
+                <layer name="double_layer" id="1" type="NewDoubleLayer" precision="FP32">
+                    <input>
+                        <port id="1">
+                            <dim>1</dim>
+                            <dim>3</dim>
+                            <dim>5</dim>
+                            <dim>5</dim>
+                        </port>
+                    </input>
+                    <output>
+                        <port id="2">
+                            <dim>1</dim>
+                            <dim>3</dim>
+                            <dim>5</dim>
+                            <dim>5</dim>
+                        </port>
+                    </output>
+                </layer>
+            </layers>
+            <edges>
+                <edge from-layer="0" from-port="0" to-layer="1" to-port="1"/>
+            </edges>
+        </Net>
+        )V0G0N";
+    MKLDNNPlugin::MKLDNNExtensionManager::Ptr extMgr(new MKLDNNPlugin::MKLDNNExtensionManager());
+    extMgr->AddExtension(extension);
+
+    InferenceEngine::Core core;
+    InferenceEngine::CNNNetwork network;
+    ASSERT_NO_THROW(network = core.ReadNetwork(model, InferenceEngine::Blob::CPtr()));
+
+    MKLDNNGraphTestClass graph;
+    graph.CreateGraph(network, extMgr);
+
+    InferenceEngine::SizeVector dims_src = {1, 3, 5, 5};
+    InferenceEngine::Blob::Ptr src =
+           InferenceEngine::make_shared_blob<float>({InferenceEngine::Precision::FP32, dims_src, InferenceEngine::NCHW});
+    src->allocate();
+    fill_data(src->buffer(), src->size());
+
+    InferenceEngine::BlobMap srcs;
+    srcs["in1"] = src;
+
+    auto item = *network.getOutputsInfo().begin();
+    InferenceEngine::TBlob<float>::Ptr output = InferenceEngine::make_shared_blob<float>(item.second->getTensorDesc());
+    output->allocate();
+    InferenceEngine::BlobMap outputBlobs;
+    outputBlobs[item.first] = output;
+
+    // The first inference creates the streams, only the next ones are expected to be allocation free
+    graph.Infer(srcs, outputBlobs);
+
+    for (int i = 0; i < 3; i++) {
+        graph.Infer(srcs, outputBlobs);
+        ASSERT_EQ(MKLDNNPlugin::AllocationCounter::lastScopeAllocations(), 0);
+    }
+
+    const float *src_data = src->cbuffer().as<const float *>();
+    const float *dst_data = output->cbuffer().as<const float *>();
+    for (size_t i = 0; i < src->size(); i++) {
+        ASSERT_FLOAT_EQ(dst_data[i], src_data[i] * 2);
+    }
+}
+
+TEST_F(MKLDNNGraphAllocationTests, CounterSeesAllocationsOfTheScope) {
+    {
+        MKLDNNPlugin::AllocationCounter::Scope scope;
+        std::unique_ptr<int> ptr(new int(0));
+    }
+    ASSERT_EQ(MKLDNNPlugin::AllocationCounter::lastScopeAllocations(), 1);
+}
@@ -177,6 +177,35 @@ private:
     InferenceEngine::CNNLayer * cnnLayer;
 };
 
+// Records the blobs of every execution, so tests can check they aren't recreated between inferences
+class TrackingDoublePrimitiveImpl : public DoublePrimitiveImpl {
+public:
+    using DoublePrimitiveImpl::DoublePrimitiveImpl;
+    InferenceEngine::StatusCode execute(std::vector<InferenceEngine::Blob::Ptr>& inputs, std::vector<InferenceEngine::Blob::Ptr>& outputs, InferenceEngine::ResponseDesc *resp) noexcept override {
+        executedBlobs.emplace_back(inputs[0].get(), outputs[0].get());
+        return DoublePrimitiveImpl::execute(inputs, outputs, resp);
+    }
+
+    static std::vector<std::pair<const InferenceEngine::Blob*, const InferenceEngine::Blob*>> executedBlobs;
+};
+
+std::vector<std::pair<const InferenceEngine::Blob*, const InferenceEngine::Blob*>> TrackingDoublePrimitiveImpl::executedBlobs;
+
+class TrackingDoublePrimitiveFactory : public InferenceEngine::ILayerImplFactory {
+public:
+    TrackingDoublePrimitiveFactory(const InferenceEngine::CNNLayer *layer) {
+        cnnLayer = const_cast<InferenceEngine::CNNLayer *>(layer);
+    }
+    // First implementation has more priority than next
+    InferenceEngine::StatusCode getImplementations(std::vector<InferenceEngine::ILayerImpl::Ptr>& impls, InferenceEngine::ResponseDesc *resp) noexcept override {
+        impls.push_back(InferenceEngine::ILayerImpl::Ptr(new TrackingDoublePrimitiveImpl(cnnLayer)));
+        return InferenceEngine::OK;
+    }
+
+private:
+    InferenceEngine::CNNLayer * cnnLayer;
+};
+
 class TwoDifferentOutputsImpl : public InferenceEngine::ILayerExecImpl {
 public:
     TwoDifferentOutputsImpl(const InferenceEngine::CNNLayer *layer) {
@@ -420,6 +449,7 @@ public:
     FakeExtensionFabric() {
         factories["CustomNewConvolution"] = [](const InferenceEngine::CNNLayer * cnnLayer) -> InferenceEngine::ILayerImplFactory* { return new FakeGenericPrimitiveFactory(); };
         factories["NewDoubleLayer"] = [](const InferenceEngine::CNNLayer * cnnLayer) -> InferenceEngine::ILayerImplFactory* { return new DoublePrimitiveFactory(cnnLayer); };
+        factories["TrackingDoubleLayer"] = [](const InferenceEngine::CNNLayer * cnnLayer) -> InferenceEngine::ILayerImplFactory* { return new TrackingDoublePrimitiveFactory(cnnLayer); };
         factories["NewTwoDifferentOutputs"] = [](const InferenceEngine::CNNLayer * cnnLayer) -> InferenceEngine::ILayerImplFactory* { return new TwoDifferentOutputsFactory(cnnLayer); };
         factories["ConstPrim"] = [](const InferenceEngine::CNNLayer * cnnLayer) -> InferenceEngine::ILayerImplFactory* { return new ConstPrimitiveFactory(cnnLayer); };
         factories["CustomInPlaceConcat"] = [](const InferenceEngine::CNNLayer * cnnLayer) -> InferenceEngine::ILayerImplFactory* { return new CustomConcatFactory(cnnLayer); };
@@ -740,6 +770,86 @@ TEST_F(MKLDNNGraphGenericTests, ExecuteGenericPrimitive) {
     compare(*output, dst_ref);
 }
 
+TEST_F(MKLDNNGraphGenericTests, ExecuteGenericPrimitiveReusesBlobs) {
+    std::string model = R"V0G0N(
+        <Net Name="DoubleLayer_Only" version="2" precision="FP32" batch="1">
+            <layers>
+                <layer name="in1" type="Input" precision="FP32" id="0">
+                    <output>
+                        <port id="0">
+                            <dim>1</dim>
+                            <dim>3</dim>
+                            <dim>5</dim>
+                            <dim>5</dim>
+                        </port>
+                    </output>
+                </layer>
+                <layer name="double_layer" id="1" type="TrackingDoubleLayer" precision="FP32">
+                    <input>
+                        <port id="1">
+                            <dim>1</dim>
+                            <dim>3</dim>
+                            <dim>5</dim>
+                            <dim>5</dim>
+                        </port>
+                    </input>
+                    <output>
+                        <port id="2">
+                            <dim>1</dim>
+                            <dim>3</dim>
+                            <dim>5</dim>
+                            <dim>5</dim>
+                        </port>
+                    </output>
+                </layer>
+            </layers>
+            <edges>
+                <edge from-layer="0" from-port="0" to-layer="1" to-port="1"/>
+            </edges>
+        </Net>
+        )V0G0N";
+    MKLDNNPlugin::MKLDNNExtensionManager::Ptr extMgr(new MKLDNNPlugin::MKLDNNExtensionManager());
+    extMgr->AddExtension(extension);
+
+    InferenceEngine::Core core;
+    InferenceEngine::CNNNetwork network;
+    ASSERT_NO_THROW(network = core.ReadNetwork(model, InferenceEngine::Blob::CPtr()));
+
+    MKLDNNGraphTestClass graph;
+    graph.CreateGraph(network, extMgr);
+
+    InferenceEngine::SizeVector dims_src = {1, 3, 5, 5};
+    InferenceEngine::Blob::Ptr src =
+           InferenceEngine::make_shared_blob<float>({InferenceEngine::Precision::FP32, dims_src, InferenceEngine::NCHW});
+    src->allocate();
+    fill_data(src->buffer(), src->size());
+
+    InferenceEngine::BlobMap srcs;
+    srcs["in1"] = src;
+
+    auto item = *network.getOutputsInfo().begin();
+    InferenceEngine::TBlob<float>::Ptr output = InferenceEngine::make_shared_blob<float>(item.second->getTensorDesc());
+    output->allocate();
+    InferenceEngine::BlobMap outputBlobs;
+    outputBlobs[item.first] = output;
+
+    const size_t inferCount = 3;
+    TrackingDoublePrimitiveImpl::executedBlobs.clear();
+    for (size_t i = 0; i < inferCount; i++) {
+        graph.Infer(srcs, outputBlobs);
+    }
+    const auto& executedBlobs = TrackingDoublePrimitiveImpl::executedBlobs;
+    ASSERT_EQ(executedBlobs.size(), inferCount);
+    for (const auto& blobs : executedBlobs) {
+        ASSERT_EQ(blobs, executedBlobs.front());
+    }
+
+    InferenceEngine::TBlob<float> dst_ref(item.second->getTensorDesc());
+    dst_ref.allocate();
+    ref_double(dynamic_cast<InferenceEngine::TBlob<float>&>(*src), dst_ref);
+    compare(*output, dst_ref);
+}
+
 TEST_F(MKLDNNGraphGenericTests, ExecuteGenericPrimitiveWithTwoOutputs) {
     std::string model = R"V0G0N(
         <Net Name="DoubleLayer_Only" version="2" precision="FP32" batch="1">
@@ -8,6 +8,7 @@
 #include <initializer_list>
 #include <list>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -97,6 +98,14 @@ namespace ngraph
 
         void validate_nodes_and_infer_types() const;
 
+        /// \brief Revalidates the nodes changed since the last validation and all the nodes
+        /// downstream of them.
+        ///
+        /// Changes are tracked for the rewiring of node inputs and for the output types set by
+        /// the validation itself. The caller is responsible for the nodes whose attributes were
+        /// modified directly, they have to be revalidated by validate_nodes_and_infer_types().
+        void validate_changed_nodes_and_infer_types() const;
+
         /// \brief Returns the sum of the size of all nodes in the graph plus the size of
         /// all constant data. This has little value beyond comparing the relative size of
         /// graphs and should not be considered the actual memory consumption of a graph.
@@ -191,6 +200,10 @@ namespace ngraph
         Function& operator=(const Function&) = delete;
         /// \brief Checks all the Parameter nodes are registered in the list of Function parameters
         void check_all_parameters_registered() const;
+        void validate_nodes(bool only_changed) const;
+        /// \brief The list of parameters, results or sinks has changed, the topological order has
+        /// to be rebuilt.
+        void invalidate_ordered_ops();
 
         static std::atomic<size_t> m_next_instance_id;
         std::string m_name;
@@ -204,6 +217,14 @@ namespace ngraph
         // These nodes are not outputs of graph but should not be removed even if have no children.
         SinkVector m_sinks;
         ParameterVector m_parameters;
+
+        // Topological order of the nodes, it's rebuilt only when the graph has been rewired since
+        // the last call to get_ordered_ops(). Nodes dropped from the graph by the rewiring must not
+        // be kept alive by the stale order.
+        mutable std::shared_ptr<FunctionCache> m_cache;
+        mutable std::vector<std::weak_ptr<Node>> m_cached_ordered_ops;
+        // Guards m_cache and m_cached_ordered_ops, the cache state is guarded by FunctionCache
+        mutable std::mutex m_cache_mutex;
     };
 
     template <>
@@ -47,6 +47,7 @@ namespace ngraph
     class Node;
 
     class Function;
+    class FunctionCache;
 
     namespace runtime
     {
@@ -130,6 +131,9 @@ namespace ngraph
         template <typename NodeType>
         friend class Output;
 
+        // For access to m_function_caches and m_outputs.
+        friend class FunctionCache;
+
     public:
         /// \brief Verifies that attributes and inputs are consistent and computes output shapes
         /// and element types. Must be implemented by concrete child classes so that it
@@ -482,6 +486,8 @@ namespace ngraph
         std::deque<descriptor::Output> m_outputs;
         std::shared_ptr<ngraph::op::util::OpAnnotations> m_op_annotations;
         std::map<std::string, std::shared_ptr<Variant>> m_rt_info;
+        // caches of the functions the node has been sorted by, notified about the node changes
+        std::vector<std::weak_ptr<FunctionCache>> m_function_caches;
     };
 
     using NodeTypeInfo = Node::type_info_t;
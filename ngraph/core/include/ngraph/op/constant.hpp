@@ -240,6 +240,9 @@ namespace ngraph
                 {
                     m_data = data;
                     constructor_validate_and_infer_types();
+                    // stops at the first mismatch, so only the head of a real weights buffer
+                    // is touched
+                    m_all_elements_bitwise_identical = are_all_data_elements_bitwise_identical();
                 }
 
                 Constant(const Constant& other);
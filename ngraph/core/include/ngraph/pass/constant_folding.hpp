@@ -24,6 +24,15 @@ namespace ngraph
         private:
             void copy_runtime_info_to_target_inputs(const std::shared_ptr<Node>& node,
                                                     const Output<Node>& replacement);
+            /// \brief Replaces the outputs of a folded node with the computed constants.
+            /// Returns true if any output was replaced.
+            bool replace_folded_outputs(const std::shared_ptr<Node>& node,
+                                        const OutputVector& replacements);
+            /// \brief Folds the nodes whose inputs are all constants level by level. Nodes of
+            /// one level do not depend on each other, so they are evaluated concurrently, while
+            /// the graph is modified sequentially in the topological order.
+            bool parallel_constant_folding(const std::shared_ptr<ngraph::Function>& f,
+                                           bool rewritten);
             /// \brief Folds pre-calculated output tensor values to constants in case lower and
             /// upper estimations are equal. Traverses graph backwards starting from the results.
             bool pre_calculated_values_folding(const std::shared_ptr<ngraph::Function>& f);
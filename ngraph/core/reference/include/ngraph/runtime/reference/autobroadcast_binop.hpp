@@ -4,11 +4,13 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cstddef>
 
 #include <utility>
 #include "ngraph/coordinate_transform.hpp"
 #include "ngraph/op/util/attr_types.hpp"
+#include "ngraph/runtime/reference/parallel_chunks.hpp"
 #include "ngraph/shape_util.hpp"
 
 namespace ngraph
@@ -19,6 +21,9 @@ namespace ngraph
         {
             namespace internal
             {
+                // Below this amount of output elements per thread a binop is not worth threads
+                constexpr size_t parallel_binop_threshold = 1 << 16;
+
                 inline void
                     row_major_strides(const Shape& shape, size_t* strides, size_t size) noexcept
                 {
@@ -83,6 +88,51 @@ namespace ngraph
                         --axis;
                     return axis;
                 }
+
+                /// \return true if shape without its leading ones equals the innermost
+                ///         dimensions of output_shape, i.e. the argument repeats as a block
+                inline bool is_trailing_block(const Shape& shape, const Shape& output_shape)
+                {
+                    auto first = std::find_if(
+                        shape.begin(), shape.end(), [](size_t dim) { return dim != 1; });
+                    const size_t rank = std::distance(first, shape.end());
+                    return rank <= output_shape.size() &&
+                           std::equal(first, shape.end(), output_shape.end() - rank);
+                }
+
+                /// \brief Contiguous kernel for arguments which are either full sized (A == 1)
+                ///        or a block repeated over the output (A == 0). A block of one element
+                ///        is a scalar, and two full sized arguments have the same shape.
+                template <int A0, int A1, typename T, typename U, typename Functor>
+                inline void blocked_autobroadcast_binop(const T* arg0,
+                                                        const T* arg1,
+                                                        U* out,
+                                                        const size_t size,
+                                                        const size_t block,
+                                                        Functor elementwise_functor)
+                {
+                    if (block == 1)
+                    {
+                        parallel_chunks(
+                            size, parallel_binop_threshold, [&](size_t begin, size_t end) {
+                                for (size_t i = begin; i < end; ++i)
+                                    out[i] = elementwise_functor(arg0[i * A0], arg1[i * A1]);
+                            });
+                        return;
+                    }
+                    parallel_chunks(size / block,
+                                    std::max<size_t>(parallel_binop_threshold / block, 1),
+                                    [&](size_t begin, size_t end) {
+                                        for (size_t r = begin; r < end; ++r)
+                                        {
+                                            const T* a0 = arg0 + r * block * A0;
+                                            const T* a1 = arg1 + r * block * A1;
+                                            U* dst = out + r * block;
+                                            for (size_t i = 0; i < block; ++i)
+                                                dst[i] = elementwise_functor(a0[i], a1[i]);
+                                        }
+                                    });
+                }
             }
 
             /// \brief Helper function to implement autobroadcasting elementwise binop references.
@@ -114,10 +164,8 @@ namespace ngraph
                 switch (broadcast_spec.m_type)
                 {
                 case op::AutoBroadcastType::NONE:
-                    for (size_t i = 0; i < shape_size(arg0_shape); i++)
-                    {
-                        out[i] = elementwise_functor(arg0[i], arg1[i]);
-                    }
+                    internal::blocked_autobroadcast_binop<1, 1>(
+                        arg0, arg1, out, shape_size(arg0_shape), 1, elementwise_functor);
                     break;
                 case op::AutoBroadcastType::NUMPY:
                     // We'll be using CoordinateTransform to handle the broadcasting. The general
@@ -191,10 +239,29 @@ namespace ngraph
                         }
 #else
 
+                        const size_t size0 = shape_size(arg0_shape);
+                        const size_t size1 = shape_size(arg1_shape);
+                        const size_t output_size = shape_size(output_shape);
+                        // an empty argument broadcasts to an empty output
+                        if (size0 == 0 || size1 == 0)
+                            break;
+
                         if (axis == 0)
                         {
-                            for (size_t i = 0, end = strides0[0]; i < end; ++i)
-                                out[i] = elementwise_functor(arg0[i], arg1[i]);
+                            blocked_autobroadcast_binop<1, 1>(
+                                arg0, arg1, out, strides0[0], 1, elementwise_functor);
+                        }
+                        else if (size0 == output_size &&
+                                 is_trailing_block(arg1_shape, output_shape))
+                        {
+                            blocked_autobroadcast_binop<1, 0>(
+                                arg0, arg1, out, output_size, size1, elementwise_functor);
+                        }
+                        else if (size1 == output_size &&
+                                 is_trailing_block(arg0_shape, output_shape))
+                        {
+                            blocked_autobroadcast_binop<0, 1>(
+                                arg0, arg1, out, output_size, size0, elementwise_functor);
                         }
                         else if (strides0[axis] == 1 &&
                                  value_with_padding_or(arg0_shape, padding0, axis, 1) == 1)
@@ -0,0 +1,70 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace reference
+        {
+            namespace internal
+            {
+                bool& parallel_kernels_enabled() noexcept;
+
+                /// \return The number of threads to split count items over, so that every
+                ///         thread gets at least min_chunk items.
+                size_t parallel_chunks_threads(size_t count, size_t min_chunk);
+
+                void run_parallel_chunks(size_t count,
+                                         size_t threads,
+                                         const std::function<void(size_t, size_t)>& func);
+            }
+
+            /// \brief Lets the reference kernels called by the current thread split their work
+            ///        over threads while alive, or keeps them single-threaded if enabled is false.
+            ///
+            /// Kernels are single-threaded by default: they are also called at inference time
+            /// from threads of the plugins' own executors.
+            class ParallelKernels
+            {
+            public:
+                explicit ParallelKernels(bool enabled)
+                    : m_outer(internal::parallel_kernels_enabled())
+                {
+                    internal::parallel_kernels_enabled() = enabled;
+                }
+                ~ParallelKernels() { internal::parallel_kernels_enabled() = m_outer; }
+                ParallelKernels(const ParallelKernels&) = delete;
+                ParallelKernels& operator=(const ParallelKernels&) = delete;
+
+            private:
+                bool m_outer;
+            };
+
+            /// \brief Calls func(begin, end) over consecutive chunks of [0, count). The chunks
+            ///        run on separate threads when the caller is in an enabled ParallelKernels
+            ///        scope and each of them gets at least min_chunk items.
+            ///
+            /// \note  An exception thrown by func is rethrown on the calling thread.
+            template <typename Func>
+            void parallel_chunks(size_t count, size_t min_chunk, Func func)
+            {
+                const size_t threads = internal::parallel_kernels_enabled()
+                                           ? internal::parallel_chunks_threads(count, min_chunk)
+                                           : 1;
+                if (threads <= 1)
+                {
+                    func(size_t{0}, count);
+                    return;
+                }
+                internal::run_parallel_chunks(count, threads, func);
+            }
+        }
+    }
+}
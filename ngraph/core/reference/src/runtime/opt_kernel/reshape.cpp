@@ -2,8 +2,10 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
-#include <cmath>
-#include <stdio.h>
+#include <algorithm>
+#include <cstring>
+#include <numeric>
+#include <vector>
 
 #include "ngraph/check.hpp"
 #include "ngraph/runtime/opt_kernel/reshape.hpp"
@@ -12,228 +14,151 @@ using namespace ngraph;
 
 namespace
 {
-    void reshape_in0(const char* in,
-                     char* out,
-                     const Shape& in_shape,
-                     const AxisVector& in_axis_order,
-                     const Shape& out_shape,
-                     size_t elem_size)
+    /// \brief Describes the data movement of a transposition with the smallest possible rank:
+    ///        the axes of size 1 are dropped and the input axes which stay adjacent and keep
+    ///        their order in the output are merged. A reshape without transposition collapses
+    ///        to rank 1 at most.
+    /// \param shape Collapsed input shape
+    /// \param order Collapsed axis order, output axis i is the input axis order[i]
+    void collapse_axes(const Shape& in_shape,
+                       const AxisVector& in_axis_order,
+                       std::vector<size_t>& shape,
+                       std::vector<size_t>& order)
     {
-        memcpy(out, in, elem_size);
-    }
-
-    void reshape_in1(const char* in,
-                     char* out,
-                     const Shape& in_shape,
-                     const AxisVector& in_axis_order,
-                     const Shape& out_shape,
-                     size_t elem_size)
-    {
-        size_t size[1];
-        size_t in_index[1];
-        size_t* map_index[1];
-        for (size_t i = 0; i < 1; i++)
-        {
-            size[i] = in_shape[in_axis_order[i]];
-            map_index[in_axis_order[i]] = &in_index[i];
-        }
-        for (in_index[0] = 0; in_index[0] < size[0]; ++in_index[0])
+        const size_t rank = in_shape.size();
+        std::vector<size_t> compact_index(rank);
+        for (size_t axis = 0, index = 0; axis < rank; ++axis)
         {
-            memcpy(out, in + *map_index[0] * elem_size, elem_size);
-            out += elem_size;
+            compact_index[axis] = index;
+            if (in_shape[axis] != 1)
+            {
+                ++index;
+            }
         }
-    }
 
-    void reshape_in2(const char* in,
-                     char* out,
-                     const Shape& in_shape,
-                     const AxisVector& in_axis_order,
-                     const Shape& out_shape,
-                     size_t elem_size)
-    {
-        size_t size[2];
-        size_t in_index[2];
-        size_t* map_index[2];
-        for (size_t i = 0; i < 2; i++)
-        {
-            size[i] = in_shape[in_axis_order[i]];
-            map_index[in_axis_order[i]] = &in_index[i];
-        }
-        for (in_index[0] = 0; in_index[0] < size[0]; ++in_index[0])
+        // runs of consecutive input axes in the output order
+        std::vector<size_t> group_size;
+        std::vector<size_t> group_first;
+        size_t previous = 0;
+        for (auto axis : in_axis_order)
         {
-            for (in_index[1] = 0; in_index[1] < size[1]; ++in_index[1])
+            if (in_shape[axis] == 1)
+            {
+                continue;
+            }
+            const auto index = compact_index[axis];
+            if (!group_size.empty() && index == previous + 1)
+            {
+                group_size.back() *= in_shape[axis];
+            }
+            else
             {
-                // clang-format off
-                memcpy(out,
-                       in + (*map_index[0] * in_shape[1] +
-                             *map_index[1]) * elem_size,
-                       elem_size);
-                out += elem_size;
-                // clang-format on
+                group_size.push_back(in_shape[axis]);
+                group_first.push_back(index);
             }
+            previous = index;
         }
-    }
 
-    void reshape_in3(const char* in,
-                     char* out,
-                     const Shape& in_shape,
-                     const AxisVector& in_axis_order,
-                     const Shape& out_shape,
-                     size_t elem_size)
-    {
-        size_t size[3];
-        size_t in_index[3];
-        size_t* map_index[3];
-        for (size_t i = 0; i < 3; i++)
-        {
-            size[i] = in_shape[in_axis_order[i]];
-            map_index[in_axis_order[i]] = &in_index[i];
-        }
-        for (in_index[0] = 0; in_index[0] < size[0]; ++in_index[0])
+        // position of every group in the input
+        std::vector<size_t> by_input(group_size.size());
+        std::iota(by_input.begin(), by_input.end(), 0);
+        std::sort(by_input.begin(), by_input.end(), [&](size_t a, size_t b) {
+            return group_first[a] < group_first[b];
+        });
+
+        shape.resize(group_size.size());
+        order.resize(group_size.size());
+        for (size_t position = 0; position < by_input.size(); ++position)
         {
-            for (in_index[1] = 0; in_index[1] < size[1]; ++in_index[1])
-            {
-                for (in_index[2] = 0; in_index[2] < size[2]; ++in_index[2])
-                {
-                    // clang-format off
-                    memcpy(out,
-                           in + (*map_index[0] * in_shape[1] * in_shape[2] +
-                                 *map_index[1] * in_shape[2] +
-                                 *map_index[2]) * elem_size,
-                           elem_size);
-                    out += elem_size;
-                    // clang-format on
-                }
-            }
+            shape[position] = group_size[by_input[position]];
+            order[by_input[position]] = position;
         }
     }
 
-    void reshape_in4(const char* in,
-                     char* out,
-                     const Shape& in_shape,
-                     const AxisVector& in_axis_order,
-                     const Shape& out_shape,
-                     size_t elem_size)
+    /// \brief Copies elements of a size known at compile time, so the copy is a single move
+    template <size_t N>
+    struct FixedSizeCopy
     {
-        size_t size[4];
-        size_t in_index[4];
-        size_t* map_index[4];
-        for (size_t i = 0; i < 4; i++)
-        {
-            size[i] = in_shape[in_axis_order[i]];
-            map_index[in_axis_order[i]] = &in_index[i];
-        }
-        for (in_index[0] = 0; in_index[0] < size[0]; ++in_index[0])
+        size_t size() const { return N; }
+        void operator()(char* dst, const char* src) const { std::memcpy(dst, src, N); }
+    };
+
+    struct DynamicSizeCopy
+    {
+        size_t m_size;
+        size_t size() const { return m_size; }
+        void operator()(char* dst, const char* src) const { std::memcpy(dst, src, m_size); }
+    };
+
+    /// \brief Gathers the output in its natural order from the input elements located by
+    ///        byte strides. The last two output axes are processed by tiles, so both the
+    ///        reads and the writes of a transposition stay in cache.
+    /// \param dims Output dimensions
+    /// \param strides Input byte stride of every output axis
+    template <typename Copy>
+    void permute(const char* in,
+                 char* out,
+                 const std::vector<size_t>& dims,
+                 const std::vector<size_t>& strides,
+                 const Copy& copy)
+    {
+        const size_t elem_size = copy.size();
+        const size_t rank = dims.size();
+        if (rank == 1)
         {
-            for (in_index[1] = 0; in_index[1] < size[1]; ++in_index[1])
+            for (size_t i = 0; i < dims[0]; ++i)
             {
-                for (in_index[2] = 0; in_index[2] < size[2]; ++in_index[2])
-                {
-                    for (in_index[3] = 0; in_index[3] < size[3]; ++in_index[3])
-                    {
-                        // clang-format off
-                        memcpy(out,
-                               in + (*map_index[0] * in_shape[1] * in_shape[2] * in_shape[3] +
-                                     *map_index[1] * in_shape[2] * in_shape[3] +
-                                     *map_index[2] * in_shape[3] +
-                                     *map_index[3]) * elem_size,
-                               elem_size);
-                        out += elem_size;
-                        // clang-format on
-                    }
-                }
+                copy(out + i * elem_size, in + i * strides[0]);
             }
+            return;
         }
-    }
 
-    void reshape_in5(const char* in,
-                     char* out,
-                     const Shape& in_shape,
-                     const AxisVector& in_axis_order,
-                     const Shape& out_shape,
-                     size_t elem_size)
-    {
-        size_t size[5];
-        size_t in_index[5];
-        size_t* map_index[5];
-        for (size_t i = 0; i < 5; i++)
-        {
-            size[i] = in_shape[in_axis_order[i]];
-            map_index[in_axis_order[i]] = &in_index[i];
-        }
-        for (in_index[0] = 0; in_index[0] < size[0]; ++in_index[0])
+        constexpr size_t tile = 32;
+        const size_t rows = dims[rank - 2];
+        const size_t cols = dims[rank - 1];
+        const size_t row_stride = strides[rank - 2];
+        const size_t col_stride = strides[rank - 1];
+        const size_t outer = std::accumulate(
+            dims.begin(), dims.end() - 2, size_t{1}, std::multiplies<size_t>());
+
+        std::vector<size_t> index(rank - 2, 0);
+        size_t in_offset = 0;
+        for (size_t o = 0; o < outer; ++o)
         {
-            for (in_index[1] = 0; in_index[1] < size[1]; ++in_index[1])
+            const char* src = in + in_offset;
+            for (size_t i0 = 0; i0 < rows; i0 += tile)
             {
-                for (in_index[2] = 0; in_index[2] < size[2]; ++in_index[2])
+                const size_t i1 = std::min(rows, i0 + tile);
+                for (size_t j0 = 0; j0 < cols; j0 += tile)
                 {
-                    for (in_index[3] = 0; in_index[3] < size[3]; ++in_index[3])
+                    const size_t j1 = std::min(cols, j0 + tile);
+                    for (size_t i = i0; i < i1; ++i)
                     {
-                        for (in_index[4] = 0; in_index[4] < size[4]; ++in_index[4])
+                        char* dst = out + (i * cols + j0) * elem_size;
+                        const char* row = src + i * row_stride;
+                        for (size_t j = j0; j < j1; ++j, dst += elem_size)
                         {
-                            // clang-format off
-                            memcpy(out,
-                                   in + (*map_index[0] * in_shape[1] * in_shape[2] * in_shape[3] * in_shape[4] +
-                                         *map_index[1] * in_shape[2] * in_shape[3] * in_shape[4] +
-                                         *map_index[2] * in_shape[3] * in_shape[4] +
-                                         *map_index[3] * in_shape[4] +
-                                         *map_index[4]) * elem_size,
-                                   elem_size);
-                            out += elem_size;
-                            // clang-format on
+                            copy(dst, row + j * col_stride);
                         }
                     }
                 }
             }
-        }
-    }
+            out += rows * cols * elem_size;
 
-    void reshape_in6(const char* in,
-                     char* out,
-                     const Shape& in_shape,
-                     const AxisVector& in_axis_order,
-                     const Shape& out_shape,
-                     size_t elem_size)
-    {
-        size_t size[6];
-        size_t in_index[6];
-        size_t* map_index[6];
-        for (size_t i = 0; i < 6; i++)
-        {
-            size[i] = in_shape[in_axis_order[i]];
-            map_index[in_axis_order[i]] = &in_index[i];
-        }
-        for (in_index[0] = 0; in_index[0] < size[0]; ++in_index[0])
-        {
-            for (in_index[1] = 0; in_index[1] < size[1]; ++in_index[1])
+            for (size_t axis = rank - 2; axis-- > 0;)
             {
-                for (in_index[2] = 0; in_index[2] < size[2]; ++in_index[2])
+                in_offset += strides[axis];
+                if (++index[axis] < dims[axis])
                 {
-                    for (in_index[3] = 0; in_index[3] < size[3]; ++in_index[3])
-                    {
-                        for (in_index[4] = 0; in_index[4] < size[4]; ++in_index[4])
-                        {
-                            for (in_index[5] = 0; in_index[5] < size[5]; ++in_index[5])
-                            {
-                                // clang-format off
-                                memcpy(out,
-                                       in + (*map_index[0] * in_shape[1] * in_shape[2] * in_shape[3] * in_shape[4] * in_shape[5] +
-                                             *map_index[1] * in_shape[2] * in_shape[3] * in_shape[4] * in_shape[5] +
-                                             *map_index[2] * in_shape[3] * in_shape[4] * in_shape[5] +
-                                             *map_index[3] * in_shape[4] * in_shape[5] +
-                                             *map_index[4] * in_shape[5] +
-                                             *map_index[5]) * elem_size,
-                                       elem_size);
-                                out += elem_size;
-                                // clang-format on
-                            }
-                        }
-                    }
+                    break;
                 }
+                in_offset -= strides[axis] * dims[axis];
+                index[axis] = 0;
             }
         }
     }
 }
+
 void runtime::opt_kernel::reshape(const char* in,
                                   char* out,
                                   const Shape& in_shape,
@@ -241,15 +166,50 @@ void runtime::opt_kernel::reshape(const char* in,
                                   const Shape& out_shape,
                                   size_t elem_size)
 {
-    switch (in_shape.size())
+    NGRAPH_CHECK(in_axis_order.size() == in_shape.size(),
+                 "Axis order size mismatch with input shape rank");
+
+    std::vector<size_t> shape;
+    std::vector<size_t> order;
+    collapse_axes(in_shape, in_axis_order, shape, order);
+
+    const size_t size = shape_size(in_shape) * elem_size;
+    if (order.size() <= 1)
+    {
+        std::memcpy(out, in, size);
+        return;
+    }
+
+    // the innermost input axis which stays the innermost one is copied as a whole
+    size_t block_size = elem_size;
+    if (order.back() == shape.size() - 1)
+    {
+        block_size *= shape.back();
+        order.pop_back();
+        shape.pop_back();
+    }
+
+    std::vector<size_t> in_strides(shape.size());
+    for (size_t axis = shape.size(), stride = block_size; axis-- > 0;)
+    {
+        in_strides[axis] = stride;
+        stride *= shape[axis];
+    }
+    std::vector<size_t> dims(order.size());
+    std::vector<size_t> strides(order.size());
+    for (size_t i = 0; i < order.size(); ++i)
+    {
+        dims[i] = shape[order[i]];
+        strides[i] = in_strides[order[i]];
+    }
+
+    switch (block_size)
     {
-    case 0: reshape_in0(in, out, in_shape, in_axis_order, out_shape, elem_size); break;
-    case 1: reshape_in1(in, out, in_shape, in_axis_order, out_shape, elem_size); break;
-    case 2: reshape_in2(in, out, in_shape, in_axis_order, out_shape, elem_size); break;
-    case 3: reshape_in3(in, out, in_shape, in_axis_order, out_shape, elem_size); break;
-    case 4: reshape_in4(in, out, in_shape, in_axis_order, out_shape, elem_size); break;
-    case 5: reshape_in5(in, out, in_shape, in_axis_order, out_shape, elem_size); break;
-    case 6: reshape_in6(in, out, in_shape, in_axis_order, out_shape, elem_size); break;
-    default: reference::reshape(in, out, in_shape, in_axis_order, out_shape, elem_size); break;
+    case 1: permute(in, out, dims, strides, FixedSizeCopy<1>()); break;
+    case 2: permute(in, out, dims, strides, FixedSizeCopy<2>()); break;
+    case 4: permute(in, out, dims, strides, FixedSizeCopy<4>()); break;
+    case 8: permute(in, out, dims, strides, FixedSizeCopy<8>()); break;
+    case 16: permute(in, out, dims, strides, FixedSizeCopy<16>()); break;
+    default: permute(in, out, dims, strides, DynamicSizeCopy{block_size}); break;
     }
 }
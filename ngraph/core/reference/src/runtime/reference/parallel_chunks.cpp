@@ -0,0 +1,72 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <exception>
+#include <thread>
+#include <vector>
+
+#include "ngraph/runtime/reference/parallel_chunks.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace reference
+        {
+            namespace internal
+            {
+                bool& parallel_kernels_enabled() noexcept
+                {
+                    static thread_local bool value = false;
+                    return value;
+                }
+
+                size_t parallel_chunks_threads(size_t count, size_t min_chunk)
+                {
+                    const size_t max_threads = std::max(1u, std::thread::hardware_concurrency());
+                    return std::min(max_threads, count / std::max<size_t>(min_chunk, 1));
+                }
+
+                void run_parallel_chunks(size_t count,
+                                         size_t threads,
+                                         const std::function<void(size_t, size_t)>& func)
+                {
+                    const size_t chunk = (count + threads - 1) / threads;
+                    std::vector<std::exception_ptr> errors(threads);
+                    auto run = [&](size_t t) {
+                        // the chunks are already running in parallel, kernels they call must not
+                        // start threads of their own
+                        ParallelKernels single_threaded(false);
+                        try
+                        {
+                            func(t * chunk, std::min(count, (t + 1) * chunk));
+                        }
+                        catch (...)
+                        {
+                            errors[t] = std::current_exception();
+                        }
+                    };
+                    std::vector<std::thread> workers;
+                    for (size_t t = 1; t < threads && t * chunk < count; ++t)
+                    {
+                        workers.emplace_back(run, t);
+                    }
+                    run(0);
+                    for (auto& worker : workers)
+                    {
+                        worker.join();
+                    }
+                    for (const auto& error : errors)
+                    {
+                        if (error)
+                        {
+                            std::rethrow_exception(error);
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
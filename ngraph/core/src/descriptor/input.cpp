@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include "function_cache.hpp"
 #include "ngraph/descriptor/input.hpp"
 #include "ngraph/descriptor/output.hpp"
 #include "ngraph/env_util.hpp"
@@ -45,6 +46,7 @@ void descriptor::Input::replace_output(Output& new_output)
     new_output.add_input(this);
     m_output = &new_output;
     m_src_node = std::shared_ptr<Node>(new_output.get_node());
+    FunctionCache::node_rewired(m_node);
 
     if (getenv_bool("NGRAPH_ENABLE_REPLACE_CHECK"))
     {
@@ -7,6 +7,7 @@
 #include <memory>
 #include <ngraph/ops.hpp>
 
+#include "function_cache.hpp"
 #include "itt.hpp"
 #include "ngraph/function.hpp"
 #include "ngraph/graph_util.hpp"
@@ -106,7 +107,18 @@ void Function::validate_nodes_and_infer_types() const
 {
     OV_ITT_SCOPED_TASK(ngraph::itt::domains::nGraphPass_LT,
                        "Function::validate_nodes_and_infer_types");
+    validate_nodes(false);
+}
+
+void Function::validate_changed_nodes_and_infer_types() const
+{
+    OV_ITT_SCOPED_TASK(ngraph::itt::domains::nGraphPass_LT,
+                       "Function::validate_changed_nodes_and_infer_types");
+    validate_nodes(true);
+}
 
+void Function::validate_nodes(bool only_changed) const
+{
     struct Counter
     {
         int cnt_assign = 0;
@@ -114,9 +126,46 @@ void Function::validate_nodes_and_infer_types() const
     };
     std::map<Variable*, Counter> pair_checker;
     std::stringstream unregistered_parameters;
-    for (auto& node : get_ordered_ops())
+    auto ordered_ops = get_ordered_ops();
+
+    // Nodes to revalidate, grows with the revalidated nodes so their consumers are revalidated
+    // as well
+    std::shared_ptr<FunctionCache> cache;
+    {
+        std::lock_guard<std::mutex> lock(m_cache_mutex);
+        cache = m_cache;
+    }
+    std::unordered_set<const Node*> changed;
+    if (only_changed)
+    {
+        changed = cache->get_changed_nodes();
+    }
+    auto is_changed = [&changed](const std::shared_ptr<Node>& node) {
+        if (changed.count(node.get()))
+        {
+            return true;
+        }
+        for (auto& input : node->inputs())
+        {
+            if (changed.count(input.get_source_output().get_node()))
+            {
+                return true;
+            }
+        }
+        return false;
+    };
+
+    for (auto& node : ordered_ops)
     {
-        node->revalidate_and_infer_types();
+        if (!only_changed)
+        {
+            node->revalidate_and_infer_types();
+        }
+        else if (is_changed(node))
+        {
+            node->revalidate_and_infer_types();
+            changed.insert(node.get());
+        }
         if (op::is_parameter(node) &&
             std::find(m_parameters.begin(), m_parameters.end(), node) == m_parameters.end())
             unregistered_parameters << node << std::endl;
@@ -141,12 +190,39 @@ void Function::validate_nodes_and_infer_types() const
         throw ngraph_error(
             "Function is incorrect. Assign and ReadValue operations must be in pairs on the "
             "network.");
+
+    cache->clear_changed_nodes();
 }
 
 std::vector<shared_ptr<Node>> Function::get_ordered_ops() const
 {
     OV_ITT_SCOPED_TASK(itt::domains::nGraph, "Function::get_ordered_ops");
 
+    std::lock_guard<std::mutex> lock(m_cache_mutex);
+    if (!m_cache)
+    {
+        m_cache = std::make_shared<FunctionCache>();
+    }
+    if (m_cache->is_order_valid())
+    {
+        vector<shared_ptr<Node>> ordered_ops;
+        ordered_ops.reserve(m_cached_ordered_ops.size());
+        for (auto& weak_node : m_cached_ordered_ops)
+        {
+            auto node = weak_node.lock();
+            if (!node)
+            {
+                break;
+            }
+            ordered_ops.push_back(node);
+        }
+        // A node released without rewiring makes the order stale as well
+        if (ordered_ops.size() == m_cached_ordered_ops.size())
+        {
+            return ordered_ops;
+        }
+    }
+
     vector<shared_ptr<Node>> nodes;
     for (auto& r : get_results())
     {
@@ -161,7 +237,23 @@ std::vector<shared_ptr<Node>> Function::get_ordered_ops() const
         nodes.push_back(param);
     }
 
-    return m_topological_sorter(nodes);
+    auto ordered_ops = m_topological_sorter(nodes);
+    m_cached_ordered_ops.assign(ordered_ops.begin(), ordered_ops.end());
+    for (auto& node : ordered_ops)
+    {
+        FunctionCache::register_node(node.get(), m_cache);
+    }
+    m_cache->set_order_valid(true);
+    return ordered_ops;
+}
+
+void Function::invalidate_ordered_ops()
+{
+    std::lock_guard<std::mutex> lock(m_cache_mutex);
+    if (m_cache)
+    {
+        m_cache->set_order_valid(false);
+    }
 }
 
 void Function::map_unordered_ops(std::function<void(Node*)> f) const
@@ -325,11 +417,13 @@ void Function::replace_parameter(size_t parameter_index, const shared_ptr<op::Pa
                  " parameters.");
     replace_node(m_parameters[parameter_index], parameter);
     m_parameters[parameter_index] = parameter;
+    invalidate_ordered_ops();
 }
 
 void Function::set_topological_sort(topological_sort_t sorter)
 {
     m_topological_sorter = sorter;
+    invalidate_ordered_ops();
 }
 
 int64_t Function::get_parameter_index(const std::shared_ptr<op::Parameter>& parameter) const
@@ -399,12 +493,14 @@ bool Function::visit_attributes(AttributeVisitor& visitor)
 {
     visitor.on_attribute("parameters", m_parameters);
     visitor.on_attribute("results", m_results);
+    invalidate_ordered_ops();
     return true;
 }
 
 void Function::add_sinks(const SinkVector& sinks)
 {
     m_sinks.insert(m_sinks.end(), sinks.begin(), sinks.end());
+    invalidate_ordered_ops();
 }
 
 void Function::remove_sink(const std::shared_ptr<op::Sink>& sink)
@@ -413,11 +509,13 @@ void Function::remove_sink(const std::shared_ptr<op::Sink>& sink)
                                  m_sinks.end(),
                                  [&sink](std::shared_ptr<op::Sink>& s) { return s == sink; }),
                   m_sinks.end());
+    invalidate_ordered_ops();
 }
 
 void Function::add_results(const ResultVector& results)
 {
     m_results.insert(m_results.end(), results.begin(), results.end());
+    invalidate_ordered_ops();
 }
 
 void Function::remove_result(const std::shared_ptr<op::Result>& result)
@@ -427,6 +525,7 @@ void Function::remove_result(const std::shared_ptr<op::Result>& result)
                        m_results.end(),
                        [&result](std::shared_ptr<op::v0::Result>& r) { return r == result; }),
         m_results.end());
+    invalidate_ordered_ops();
 }
 
 void Function::add_parameters(const ParameterVector& params)
@@ -443,6 +542,7 @@ void Function::add_parameters(const ParameterVector& params)
         }
     }
     m_parameters.insert(m_parameters.end(), params.begin(), params.end());
+    invalidate_ordered_ops();
 }
 
 void Function::remove_parameter(const std::shared_ptr<op::Parameter>& param)
@@ -452,6 +552,7 @@ void Function::remove_parameter(const std::shared_ptr<op::Parameter>& param)
                        m_parameters.end(),
                        [&param](std::shared_ptr<op::v0::Parameter>& r) { return r == param; }),
         m_parameters.end());
+    invalidate_ordered_ops();
 }
 
 constexpr DiscreteTypeInfo AttributeAdapter<shared_ptr<Function>>::type_info;
@@ -0,0 +1,103 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+
+#include "function_cache.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+mutex& FunctionCache::get_mutex()
+{
+    static mutex cache_mutex;
+    return cache_mutex;
+}
+
+void FunctionCache::register_node(Node* node, const shared_ptr<FunctionCache>& cache)
+{
+    lock_guard<mutex> lock(get_mutex());
+    auto& caches = node->m_function_caches;
+    bool registered = false;
+    caches.erase(remove_if(caches.begin(),
+                           caches.end(),
+                           [&](const weak_ptr<FunctionCache>& node_cache) {
+                               auto locked = node_cache.lock();
+                               registered |= locked == cache;
+                               return locked == nullptr;
+                           }),
+                 caches.end());
+    if (!registered)
+    {
+        caches.push_back(cache);
+        cache->m_changed.insert(node);
+    }
+}
+
+void FunctionCache::node_rewired(Node* node)
+{
+    lock_guard<mutex> lock(get_mutex());
+    for (auto& node_cache : node->m_function_caches)
+    {
+        if (auto cache = node_cache.lock())
+        {
+            cache->m_order_valid = false;
+            cache->m_changed.insert(node);
+        }
+    }
+}
+
+void FunctionCache::node_changed(Node* node)
+{
+    lock_guard<mutex> lock(get_mutex());
+    node_changed_locked(node);
+}
+
+void FunctionCache::node_changed_locked(Node* node)
+{
+    for (auto& node_cache : node->m_function_caches)
+    {
+        if (auto cache = node_cache.lock())
+        {
+            cache->m_changed.insert(node);
+        }
+    }
+}
+
+void FunctionCache::output_changed(Node* node, size_t output_index)
+{
+    lock_guard<mutex> lock(get_mutex());
+    if (node->m_function_caches.empty())
+    {
+        return;
+    }
+    for (auto input : node->m_outputs.at(output_index).get_inputs())
+    {
+        node_changed_locked(input->get_raw_pointer_node());
+    }
+}
+
+bool FunctionCache::is_order_valid() const
+{
+    lock_guard<mutex> lock(get_mutex());
+    return m_order_valid;
+}
+
+void FunctionCache::set_order_valid(bool valid)
+{
+    lock_guard<mutex> lock(get_mutex());
+    m_order_valid = valid;
+}
+
+unordered_set<const Node*> FunctionCache::get_changed_nodes() const
+{
+    lock_guard<mutex> lock(get_mutex());
+    return m_changed;
+}
+
+void FunctionCache::clear_changed_nodes()
+{
+    lock_guard<mutex> lock(get_mutex());
+    m_changed.clear();
+}
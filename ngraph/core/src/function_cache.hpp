@@ -0,0 +1,56 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <unordered_set>
+
+#include "ngraph/node.hpp"
+
+namespace ngraph
+{
+    /// \brief State shared by a Function and its nodes which tracks the graph changes, so the
+    ///        Function can reuse its topological order and revalidate only the changed nodes.
+    ///
+    /// Nodes are registered with the cache when the Function sorts them. The Function owns the
+    /// cache while the nodes only keep weak references to it, so caches of temporary functions
+    /// built over the same nodes go away with them.
+    ///
+    /// The lists of caches kept by the nodes and the state of all the caches are guarded by a
+    /// single mutex, so functions sharing nodes may be sorted and validated from different
+    /// threads. Modifying a graph while another thread uses it is not supported, as elsewhere.
+    class FunctionCache
+    {
+    public:
+        /// \brief Registers the node with the cache. A node new to the cache is marked changed,
+        ///        as it hasn't been validated as a part of the function yet.
+        static void register_node(Node* node, const std::shared_ptr<FunctionCache>& cache);
+
+        /// \brief Inputs or control dependencies of the node have changed, the topological order
+        ///        has to be rebuilt and the node has to be revalidated.
+        static void node_rewired(Node* node);
+
+        /// \brief The node itself has changed, it has to be revalidated.
+        static void node_changed(Node* node);
+
+        /// \brief Output of the node has got another type, its consumers have to be revalidated.
+        static void output_changed(Node* node, size_t output_index);
+
+        bool is_order_valid() const;
+        void set_order_valid(bool valid);
+        /// \brief Nodes changed since the last validation. The pointers are used as keys only,
+        ///        a destroyed node is never in the topological order anyway.
+        std::unordered_set<const Node*> get_changed_nodes() const;
+        void clear_changed_nodes();
+
+    private:
+        static void node_changed_locked(Node* node);
+        static std::mutex& get_mutex();
+
+        bool m_order_valid = false;
+        std::unordered_set<const Node*> m_changed;
+    };
+}
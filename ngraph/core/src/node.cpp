@@ -8,6 +8,7 @@
 #include <typeindex>
 #include <typeinfo>
 
+#include "function_cache.hpp"
 #include "itt.hpp"
 #include "ngraph/descriptor/input.hpp"
 #include "ngraph/graph_util.hpp"
@@ -190,6 +191,7 @@ void Node::set_arguments(const OutputVector& arguments)
         auto& output_descriptor = output_node->m_outputs.at(output.get_index());
         m_inputs.emplace_back(this, i++, output_descriptor);
     }
+    FunctionCache::node_rewired(this);
 }
 
 descriptor::Input& Node::get_input_descriptor(size_t position)
@@ -263,7 +265,12 @@ void Node::set_input_is_relevant_to_value(size_t i, bool relevant)
 
 void Node::set_output_type(size_t i, const element::Type& element_type, const PartialShape& pshape)
 {
-    get_output_descriptor(i).get_tensor_ptr()->set_tensor_type(element_type, pshape);
+    auto& tensor = *get_output_descriptor(i).get_tensor_ptr();
+    if (tensor.get_element_type() != element_type || tensor.get_partial_shape() != pshape)
+    {
+        FunctionCache::output_changed(this, i);
+    }
+    tensor.set_tensor_type(element_type, pshape);
 }
 
 std::string Node::description() const
@@ -478,6 +485,7 @@ void Node::add_control_dependency(std::shared_ptr<Node> node)
         {
             node->m_control_dependents.push_back(this);
         }
+        FunctionCache::node_rewired(this);
     }
 }
 
@@ -510,6 +518,7 @@ void Node::remove_control_dependency(std::shared_ptr<Node> node)
         if (it != m_control_dependencies.end())
         {
             m_control_dependencies.erase(it);
+            FunctionCache::node_rewired(this);
         }
     }
     {
@@ -531,7 +540,11 @@ void Node::clear_control_dependencies()
             node->m_control_dependents.erase(it);
         }
     }
-    m_control_dependencies.clear();
+    if (!m_control_dependencies.empty())
+    {
+        m_control_dependencies.clear();
+        FunctionCache::node_rewired(this);
+    }
 }
 
 void Node::clear_control_dependents()
@@ -3,18 +3,67 @@
 //
 
 #include "ngraph/pass/constant_folding.hpp"
+#include <algorithm>
+#include <atomic>
+#include <exception>
 #include <ngraph/op/constant.hpp>
+#include <thread>
+#include <unordered_set>
+#include "ngraph/op/parameter.hpp"
+#include "ngraph/op/result.hpp"
+#include "ngraph/op/sink.hpp"
 #include "ngraph/op/util/sub_graph_base.hpp"
 #include "ngraph/rt_info.hpp"
+#include "ngraph/runtime/reference/parallel_chunks.hpp"
 
 using namespace std;
 using namespace ngraph;
 
 NGRAPH_RTTI_DEFINITION(ngraph::pass::ConstantFolding, "ConstantFolding", 0);
 
+namespace
+{
+    // Below this amount of output elements per level the folding is not worth extra threads
+    constexpr size_t parallel_folding_threshold = 1 << 16;
+
+    bool is_foldable(const std::shared_ptr<Node>& node)
+    {
+        if (node->get_input_size() == 0 || is_type<op::Parameter>(node) ||
+            is_type<op::Result>(node) || is_type<op::Sink>(node) ||
+            is_type<op::util::SubGraphOp>(node) ||
+            node->get_rt_info().count("DISABLED_CONSTANT_FOLDING"))
+        {
+            return false;
+        }
+        for (const auto& input : node->inputs())
+        {
+            if (!is_type<op::Constant>(input.get_source_output().get_node()))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    size_t output_elements(const std::shared_ptr<Node>& node)
+    {
+        size_t elements = 0;
+        for (const auto& output : node->outputs())
+        {
+            const auto& shape = output.get_partial_shape();
+            elements += shape.is_static() ? shape_size(shape.to_shape()) : 0;
+        }
+        return elements;
+    }
+} // namespace
+
 bool ngraph::pass::ConstantFolding::run_on_function(std::shared_ptr<ngraph::Function> f)
 {
+    // folding runs at compile time, so the kernels are allowed to start threads of their own
+    runtime::reference::ParallelKernels parallel_kernels(true);
+
     bool rewritten = pre_calculated_values_folding(f);
+    rewritten |= parallel_constant_folding(f, rewritten);
 
     for (const auto& node : f->get_ordered_ops())
     {
@@ -26,33 +75,7 @@ bool ngraph::pass::ConstantFolding::run_on_function(std::shared_ptr<ngraph::Func
         OutputVector replacements(node->get_output_size());
         if (node->constant_fold(replacements, node->input_values()))
         {
-            NGRAPH_CHECK(replacements.size() == node->get_output_size(),
-                         "constant_fold_default returned incorrect number of replacements for ",
-                         node);
-
-            for (size_t i = 0; i < replacements.size(); ++i)
-            {
-                auto node_output = node->output(i);
-                auto replacement = replacements.at(i);
-                if (replacement.get_node_shared_ptr() && (node_output != replacement))
-                {
-                    if (replacements.size() == 1)
-                    {
-                        replacement.get_node_shared_ptr()->set_friendly_name(
-                            node->get_friendly_name());
-                    }
-                    else
-                    {
-                        replacement.get_node_shared_ptr()->set_friendly_name(
-                            node->get_friendly_name() + "." + std::to_string(i));
-                    }
-                    node_output.replace(replacement);
-                    // Propagate runtime info attributes to replacement consumer nodes
-                    copy_runtime_info_to_target_inputs(node, replacement);
-
-                    rewritten = true;
-                }
-            }
+            rewritten |= replace_folded_outputs(node, replacements);
         }
         else
         {
@@ -70,6 +93,153 @@ bool ngraph::pass::ConstantFolding::run_on_function(std::shared_ptr<ngraph::Func
     return rewritten;
 }
 
+bool ngraph::pass::ConstantFolding::replace_folded_outputs(const std::shared_ptr<Node>& node,
+                                                           const OutputVector& replacements)
+{
+    NGRAPH_CHECK(replacements.size() == node->get_output_size(),
+                 "constant_fold_default returned incorrect number of replacements for ",
+                 node);
+
+    bool rewritten = false;
+    for (size_t i = 0; i < replacements.size(); ++i)
+    {
+        auto node_output = node->output(i);
+        auto replacement = replacements.at(i);
+        if (replacement.get_node_shared_ptr() && (node_output != replacement))
+        {
+            if (replacements.size() == 1)
+            {
+                replacement.get_node_shared_ptr()->set_friendly_name(node->get_friendly_name());
+            }
+            else
+            {
+                replacement.get_node_shared_ptr()->set_friendly_name(
+                    node->get_friendly_name() + "." + std::to_string(i));
+            }
+            node_output.replace(replacement);
+            // Propagate runtime info attributes to replacement consumer nodes
+            copy_runtime_info_to_target_inputs(node, replacement);
+
+            rewritten = true;
+        }
+    }
+    return rewritten;
+}
+
+bool ngraph::pass::ConstantFolding::parallel_constant_folding(
+    const std::shared_ptr<ngraph::Function>& f, bool rewritten)
+{
+    const size_t max_threads = std::max(1u, std::thread::hardware_concurrency());
+
+    std::unordered_set<Node*> function_nodes;
+    // nodes queued to a level once, a folded node may still consume the constant it produced
+    std::unordered_set<Node*> queued;
+    std::vector<std::shared_ptr<Node>> level;
+    for (const auto& node : f->get_ordered_ops())
+    {
+        function_nodes.insert(node.get());
+        if (is_foldable(node))
+        {
+            level.push_back(node);
+            queued.insert(node.get());
+        }
+    }
+
+    bool folded_any = false;
+    while (!level.empty())
+    {
+        size_t elements = 0;
+        for (const auto& node : level)
+        {
+            if (rewritten || folded_any)
+            {
+                node->validate_and_infer_types();
+            }
+            elements += output_elements(node);
+            // names are generated lazily, so they are created here rather than concurrently
+            // by error reporting of the evaluation
+            node->get_name();
+            for (const auto& input : node->input_values())
+            {
+                input.get_node()->get_name();
+            }
+        }
+
+        std::vector<OutputVector> replacements(level.size());
+        std::vector<char> folded(level.size(), 0);
+        std::vector<std::exception_ptr> errors(level.size());
+        std::atomic<size_t> next{0};
+        auto fold = [&]() {
+            for (size_t i = next++; i < level.size(); i = next++)
+            {
+                try
+                {
+                    replacements[i].resize(level[i]->get_output_size());
+                    folded[i] = level[i]->constant_fold(replacements[i], level[i]->input_values());
+                }
+                catch (...)
+                {
+                    errors[i] = std::current_exception();
+                }
+            }
+        };
+
+        const size_t threads = elements < parallel_folding_threshold
+                                   ? 1
+                                   : std::min(max_threads, level.size());
+        if (threads == 1)
+        {
+            fold();
+        }
+        else
+        {
+            // kernels of the folded nodes must not start threads on top of these
+            auto fold_in_region = [&]() {
+                runtime::reference::ParallelKernels single_threaded(false);
+                fold();
+            };
+            std::vector<std::thread> workers;
+            for (size_t t = 1; t < threads; ++t)
+            {
+                workers.emplace_back(fold_in_region);
+            }
+            fold_in_region();
+            for (auto& worker : workers)
+            {
+                worker.join();
+            }
+        }
+
+        std::vector<std::shared_ptr<Node>> next_level;
+        for (size_t i = 0; i < level.size(); ++i)
+        {
+            if (errors[i])
+            {
+                std::rethrow_exception(errors[i]);
+            }
+            if (!folded[i] || !replace_folded_outputs(level[i], replacements[i]))
+            {
+                continue;
+            }
+            folded_any = true;
+            for (const auto& replacement : replacements[i])
+            {
+                for (const auto& input : replacement.get_target_inputs())
+                {
+                    auto consumer = input.get_node()->shared_from_this();
+                    if (function_nodes.count(consumer.get()) && is_foldable(consumer) &&
+                        queued.insert(consumer.get()).second)
+                    {
+                        next_level.push_back(consumer);
+                    }
+                }
+            }
+        }
+        level.swap(next_level);
+    }
+    return folded_any;
+}
+
 void ngraph::pass::ConstantFolding::copy_runtime_info_to_target_inputs(
     const std::shared_ptr<Node>& node, const Output<Node>& replacement)
 {
@@ -10,6 +10,7 @@
 #include <unordered_set>
 #include <vector>
 
+#include "function_cache.hpp"
 #include "itt.hpp"
 #include "ngraph/env_util.hpp"
 #include "ngraph/log.hpp"
@@ -67,6 +68,20 @@ namespace ngraph
                 static PerfCounters counters;
                 return counters;
             }
+
+            // Callback may modify attributes of any matched node in place, so all of them have to
+            // be revalidated
+            void matched_nodes_changed(pattern::Matcher& m)
+            {
+                for (const auto& pattern_value : m.get_pattern_value_map())
+                {
+                    FunctionCache::node_changed(pattern_value.second.get_node());
+                }
+                for (const auto& value : m.get_matched_values())
+                {
+                    FunctionCache::node_changed(value.get_node());
+                }
+            }
         } // namespace
     }     // namespace pass
 } // namespace ngraph
@@ -137,6 +152,8 @@ bool pass::GraphRewrite::run_on_function(shared_ptr<Function> f)
         // including ones triggered by parent type info.
     }
 
+    bool unmatched_handler_applied = false;
+
     // This lambda preforms execution of particular MatcherPass on given node.
     // It automatically handles nodes registered by MatcherPass during transformation and set
     // transformation callback.
@@ -156,6 +173,13 @@ bool pass::GraphRewrite::run_on_function(shared_ptr<Function> f)
         // Apply MatcherPass. In case if it returns true no other MatcherPasses will apply
         // to this node
         bool status = m_pass->apply(node);
+        if (status)
+        {
+            // Matched nodes are marked changed by the matcher handler, a handler without a
+            // matcher may change any node
+            FunctionCache::node_changed(node.get());
+            unmatched_handler_applied |= m_pass->get_matcher() == nullptr;
+        }
 
         // In case if MatcherPass registered nodes they will be added to the beginning of execution
         // queue
@@ -185,7 +209,10 @@ bool pass::GraphRewrite::run_on_function(shared_ptr<Function> f)
         {
             if (auto sub_graph = sub_graph_node->get_function())
             {
-                run_on_function(sub_graph);
+                if (run_on_function(sub_graph))
+                {
+                    FunctionCache::node_changed(node.get());
+                }
             }
         }
         // Temporary keep this GraphRewrite property for backward compatibility
@@ -245,6 +272,13 @@ bool pass::GraphRewrite::run_on_function(shared_ptr<Function> f)
             }
         }
     }
+    if (unmatched_handler_applied)
+    {
+        for (const auto& op : f->get_ops())
+        {
+            FunctionCache::node_changed(op.get());
+        }
+    }
     return rewritten;
 }
 
@@ -262,6 +296,10 @@ void pass::GraphRewrite::add_matcher(const shared_ptr<pattern::Matcher>& m,
                 NGRAPH_DEBUG << "Matcher " << m->get_name() << " matched " << node;
                 NGRAPH_PASS_CALLBACK(m);
                 bool status = callback(*m.get());
+                if (status)
+                {
+                    matched_nodes_changed(*m);
+                }
                 // explicitly clear Matcher state because it holds pointers to matched nodes
                 m->clear_state();
                 return status;
@@ -399,6 +437,10 @@ void ngraph::pass::MatcherPass::register_matcher(const std::shared_ptr<ngraph::p
             NGRAPH_DEBUG << "Matcher " << m->get_name() << " matched " << node;
             NGRAPH_PASS_CALLBACK(m);
             bool status = callback(*m.get());
+            if (status)
+            {
+                matched_nodes_changed(*m);
+            }
             // explicitly clear Matcher state because it holds pointers to matched nodes
             m->clear_state();
             return status;
@@ -5,6 +5,7 @@
 #include <algorithm>
 #include <iomanip>
 #include <iostream>
+#include <map>
 #include <memory>
 #include <mutex>
 #include <unordered_map>
@@ -62,8 +63,18 @@ void pass::Manager::run_passes(shared_ptr<Function> func)
     size_t index = 0;
     stopwatch pass_timer;
     stopwatch overall_timer;
+    stopwatch validation_timer;
     overall_timer.start();
     bool function_changed = false;
+    // Changes made by MatcherPasses are tracked by the function, so only the changed nodes have
+    // to be revalidated. Other passes may modify node attributes in place, after them all the
+    // nodes are revalidated.
+    bool full_validation_needed = false;
+    bool incremental_validation = false;
+    // Validation is reported as a part of the pass which changed the function
+    bool validated = false;
+    std::string changing_pass_name;
+    std::map<std::string, size_t> pass_milliseconds;
     for (auto& pass : m_pass_list)
     {
         if (m_pass_config->is_disabled(pass->get_type_info()))
@@ -93,6 +104,17 @@ void pass::Manager::run_passes(shared_ptr<Function> func)
             // on on entire ngraph::Function
             function_changed = GraphRewrite(matcher_pass).run_on_function(func);
         }
+        else if (auto graph_rewrite = dynamic_pointer_cast<GraphRewrite>(pass))
+        {
+            if (graph_rewrite->get_property(PassProperty::REQUIRE_STATIC_SHAPE) &&
+                func->is_dynamic())
+            {
+                NGRAPH_DEBUG << "Pass " << pass->get_name() << " requires static shape but the "
+                             << "function is dynamic. Skipping this transformation";
+                continue;
+            }
+            function_changed = graph_rewrite->run_on_function(func);
+        }
         else if (auto function_pass = dynamic_pointer_cast<FunctionPass>(pass))
         {
             // This checks is to skip the graph transformation when the graph pass relies on
@@ -109,13 +131,26 @@ void pass::Manager::run_passes(shared_ptr<Function> func)
             {
                 if (function_changed)
                 {
-                    function_pass->run_on_function(func);
+                    validation_timer.start();
+                    incremental_validation = !full_validation_needed;
+                    if (incremental_validation)
+                    {
+                        func->validate_changed_nodes_and_infer_types();
+                    }
+                    else
+                    {
+                        function_pass->run_on_function(func);
+                    }
+                    validation_timer.stop();
+                    validated = true;
                     function_changed = false;
+                    full_validation_needed = false;
                 }
             }
             else
             {
                 function_changed = function_pass->run_on_function(func);
+                full_validation_needed |= function_changed;
             }
         }
         else if (auto node_pass = dynamic_pointer_cast<NodePass>(pass))
@@ -130,6 +165,7 @@ void pass::Manager::run_passes(shared_ptr<Function> func)
             {
                 function_changed |= node_pass->run_on_node(n);
             }
+            full_validation_needed |= function_changed;
         }
         NGRAPH_SUPPRESS_DEPRECATED_END
 
@@ -154,11 +190,41 @@ void pass::Manager::run_passes(shared_ptr<Function> func)
         pass_timer.stop();
         if (profile_enabled)
         {
-            cout << setw(7) << pass_timer.get_milliseconds() << "ms " << pass->get_name() << "\n";
+            cout << setw(7) << pass_timer.get_milliseconds() << "ms " << pass->get_name();
+            if (validated)
+            {
+                cout << " of " << changing_pass_name;
+            }
+            if (incremental_validation)
+            {
+                cout << " (changed nodes only)";
+            }
+            cout << "\n";
+            pass_milliseconds[validated ? changing_pass_name : pass->get_name()] +=
+                pass_timer.get_milliseconds();
         }
+        if (function_changed)
+        {
+            changing_pass_name = pass->get_name();
+        }
+        validated = false;
+        incremental_validation = false;
     }
     if (profile_enabled)
     {
-        cout << "passes done in " << overall_timer.get_milliseconds() << "ms\n";
+        vector<pair<string, size_t>> sorted_pass_milliseconds(pass_milliseconds.begin(),
+                                                              pass_milliseconds.end());
+        stable_sort(sorted_pass_milliseconds.begin(),
+                    sorted_pass_milliseconds.end(),
+                    [](const pair<string, size_t>& a, const pair<string, size_t>& b) {
+                        return a.second > b.second;
+                    });
+        cout << "time per pass including the validation of its changes:\n";
+        for (const auto& pass_time : sorted_pass_milliseconds)
+        {
+            cout << setw(7) << pass_time.second << "ms " << pass_time.first << "\n";
+        }
+        cout << "passes done in " << overall_timer.get_milliseconds() << "ms, validation took "
+             << validation_timer.get_total_milliseconds() << "ms\n";
     }
 }
@@ -39,6 +39,24 @@ namespace ngraph
             ONNX_IMPORTER_API
             std::shared_ptr<Function> import_onnx_model(ONNX_NAMESPACE::ModelProto& model_proto,
                                                         const std::string& model_path);
+
+            /// \brief      Imports and converts an serialized ONNX model from a ModelProto
+            ///             to an nGraph Function representation.
+            ///
+            /// \note       The Constants created from the initializers share the ownership of
+            ///             the ModelProto and reference its raw data instead of copying it.
+            ///
+            /// \param[in]  model_proto Shared pointer to a ModelProto object.
+            /// \param[in]  model_path  The path to the imported onnx model.
+            ///                         It is required if the imported model uses data saved in
+            ///                         external files.
+            ///
+            /// \return     An nGraph function that represents a single output from the created
+            /// graph.
+            ONNX_IMPORTER_API
+            std::shared_ptr<Function>
+                import_onnx_model(std::shared_ptr<ONNX_NAMESPACE::ModelProto> model_proto,
+                                  const std::string& model_path);
         } // namespace detail
     }     // namespace onnx_import
 } // namespace ngraph
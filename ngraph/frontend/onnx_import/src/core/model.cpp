@@ -33,6 +33,7 @@ namespace ngraph
 
         Model::Model(const ONNX_NAMESPACE::ModelProto& model_proto)
             : m_model_proto{&model_proto}
+            , m_mmap_cache{std::make_shared<detail::MappedMemoryHandles::element_type>()}
         {
             // Walk through the elements of opset_import field and register operator sets
             // for each domain. An exception UnknownDomain() will raise if the domain is
@@ -51,6 +52,12 @@ namespace ngraph
             }
         }
 
+        Model::Model(std::shared_ptr<const ONNX_NAMESPACE::ModelProto> model_proto)
+            : Model(*model_proto)
+        {
+            m_model_proto_holder = std::move(model_proto);
+        }
+
         const Operator& Model::get_operator(const std::string& name,
                                             const std::string& domain) const
         {
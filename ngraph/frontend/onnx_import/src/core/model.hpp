@@ -4,12 +4,14 @@
 
 #pragma once
 
+#include <memory>
 #include <onnx/onnx_pb.h>
 #include <ostream>
 #include <string>
 #include <unordered_map>
 
 #include "onnx_import/core/operator_set.hpp"
+#include "utils/mapped_memory.hpp"
 
 namespace ngraph
 {
@@ -30,6 +32,10 @@ namespace ngraph
             Model() = delete;
             explicit Model(const ONNX_NAMESPACE::ModelProto& model_proto);
 
+            /// \brief      Creates the model sharing the ownership of the proto, which lets
+            ///             the initializers reference its raw data instead of copying it.
+            explicit Model(std::shared_ptr<const ONNX_NAMESPACE::ModelProto> model_proto);
+
             Model(const Model&) = default;
             Model(Model&&) = default;
 
@@ -45,6 +51,15 @@ namespace ngraph
                 return m_model_proto->producer_version();
             }
 
+            /// \brief      The owner of the proto, empty if the proto is owned by the caller
+            const std::shared_ptr<const ONNX_NAMESPACE::ModelProto>& get_model_proto_holder() const
+            {
+                return m_model_proto_holder;
+            }
+
+            /// \brief      The external data files mapped by the initializers of the model
+            const detail::MappedMemoryHandles& get_mmap_cache() const { return m_mmap_cache; }
+
             /// \brief Access an operator object by its type name and domain name
             /// The function will return the operator object if it exists, or report an error
             /// in case of domain or operator absence.
@@ -72,6 +87,8 @@ namespace ngraph
 
         private:
             const ONNX_NAMESPACE::ModelProto* m_model_proto;
+            std::shared_ptr<const ONNX_NAMESPACE::ModelProto> m_model_proto_holder;
+            detail::MappedMemoryHandles m_mmap_cache;
             std::unordered_map<std::string, OperatorSet> m_opset;
         };
 
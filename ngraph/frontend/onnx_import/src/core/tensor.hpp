@@ -4,11 +4,13 @@
 
 #pragma once
 
+#include <cstdint>
 #include <onnx/onnx_pb.h>
 #include <utility>
 #include <vector>
 
 #include "ngraph/op/constant.hpp"
+#include "ngraph/runtime/shared_buffer.hpp"
 #include "ngraph/shape.hpp"
 #include "ngraph/type/element_type.hpp"
 #include "onnx_common/utils.hpp"
@@ -446,9 +448,19 @@ namespace ngraph
             };
 
             Tensor() = delete;
-            explicit Tensor(const ONNX_NAMESPACE::TensorProto& tensor)
+
+            /// \param[in]  tensor        The ONNX protobuf tensor representation.
+            /// \param[in]  mmap_cache    The external data files mapped for the model. When set,
+            ///                           the Constant references the mapped pages of the file.
+            /// \param[in]  proto_holder  The owner of the tensor proto. When set, the Constant
+            ///                           references the raw data of the proto and keeps it alive.
+            explicit Tensor(const ONNX_NAMESPACE::TensorProto& tensor,
+                            detail::MappedMemoryHandles mmap_cache = nullptr,
+                            std::shared_ptr<const void> proto_holder = nullptr)
                 : m_tensor_proto{&tensor}
                 , m_shape{std::begin(tensor.dims()), std::end(tensor.dims())}
+                , m_mmap_cache{std::move(mmap_cache)}
+                , m_proto_holder{std::move(proto_holder)}
             {
                 if (m_shape == Shape{0})
                 {
@@ -569,8 +581,12 @@ namespace ngraph
             template <typename T>
             std::shared_ptr<ngraph::op::Constant> make_ng_constant(const element::Type& type) const
             {
-                auto constant =
-                    std::make_shared<ngraph::op::Constant>(type, m_shape, get_data<T>());
+                auto constant = make_shared_ng_constant<T>(type);
+                if (!constant)
+                {
+                    constant =
+                        std::make_shared<ngraph::op::Constant>(type, m_shape, get_data<T>());
+                }
                 if (m_tensor_proto->has_name())
                 {
                     constant->set_friendly_name(get_name());
@@ -578,8 +594,67 @@ namespace ngraph
                 return constant;
             }
 
+            template <typename T>
+            static bool is_aligned(const void* data)
+            {
+                return reinterpret_cast<std::uintptr_t>(data) % alignof(T) == 0;
+            }
+
+            /// \brief  Creates a Constant referencing the data of the tensor in place
+            ///
+            /// \return The Constant or nullptr if the data has to be converted into a copy
+            template <typename T>
+            std::shared_ptr<ngraph::op::Constant>
+                make_shared_ng_constant(const element::Type& type) const
+            {
+                if (m_tensor_proto->has_segment())
+                {
+                    return nullptr;
+                }
+                const size_t byte_size = shape_size(m_shape) * sizeof(T);
+
+                if (detail::tensor::detail::has_tensor_external_data(*m_tensor_proto))
+                {
+                    if (!m_mmap_cache)
+                    {
+                        return nullptr;
+                    }
+                    const auto buffer = detail::TensorExternalData(*m_tensor_proto)
+                                            .load_external_mmap_data(m_mmap_cache);
+                    if (!buffer || buffer->size() != byte_size)
+                    {
+                        return nullptr;
+                    }
+                    if (!is_aligned<T>(buffer->get_ptr()))
+                    {
+                        // a single copy straight from the mapped pages
+                        return std::make_shared<ngraph::op::Constant>(
+                            type, m_shape, buffer->get_ptr());
+                    }
+                    return std::make_shared<ngraph::op::Constant>(type, m_shape, buffer);
+                }
+
+                if (m_proto_holder && m_tensor_proto->has_raw_data())
+                {
+                    const auto& raw_data = m_tensor_proto->raw_data();
+                    if (byte_size == 0 || raw_data.size() != byte_size ||
+                        !is_aligned<T>(raw_data.data()))
+                    {
+                        return nullptr;
+                    }
+                    auto proto_holder = m_proto_holder;
+                    auto buffer =
+                        std::make_shared<runtime::SharedBuffer<std::shared_ptr<const void>>>(
+                            const_cast<char*>(raw_data.data()), raw_data.size(), proto_holder);
+                    return std::make_shared<ngraph::op::Constant>(type, m_shape, buffer);
+                }
+                return nullptr;
+            }
+
             const ONNX_NAMESPACE::TensorProto* m_tensor_proto;
             Shape m_shape;
+            detail::MappedMemoryHandles m_mmap_cache;
+            std::shared_ptr<const void> m_proto_holder;
         };
 
         inline std::ostream& operator<<(std::ostream& outs, const Tensor& tensor)
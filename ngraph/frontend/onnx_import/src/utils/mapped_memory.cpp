@@ -0,0 +1,124 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "utils/mapped_memory.hpp"
+#include "ngraph/file_util.hpp"
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace ngraph
+{
+    namespace onnx_import
+    {
+        namespace detail
+        {
+            std::shared_ptr<MappedMemory> MappedMemory::map(const std::string& path)
+            {
+                std::shared_ptr<MappedMemory> memory{new MappedMemory()};
+#ifdef _WIN32
+#if defined(ENABLE_UNICODE_PATH_SUPPORT)
+                const std::wstring file_path = file_util::multi_byte_char_to_wstring(path.c_str());
+                HANDLE file = ::CreateFileW(file_path.c_str(),
+                                            GENERIC_READ,
+                                            FILE_SHARE_READ,
+                                            NULL,
+                                            OPEN_EXISTING,
+                                            FILE_ATTRIBUTE_NORMAL,
+                                            NULL);
+#else
+                HANDLE file = ::CreateFileA(path.c_str(),
+                                            GENERIC_READ,
+                                            FILE_SHARE_READ,
+                                            NULL,
+                                            OPEN_EXISTING,
+                                            FILE_ATTRIBUTE_NORMAL,
+                                            NULL);
+#endif
+                if (file == INVALID_HANDLE_VALUE)
+                {
+                    return nullptr;
+                }
+                memory->m_file = file;
+
+                LARGE_INTEGER file_size;
+                if (!::GetFileSizeEx(file, &file_size) || file_size.QuadPart == 0)
+                {
+                    return nullptr;
+                }
+                HANDLE mapping = ::CreateFileMapping(file, NULL, PAGE_WRITECOPY, 0, 0, NULL);
+                if (mapping == NULL)
+                {
+                    return nullptr;
+                }
+                memory->m_mapping = mapping;
+
+                void* data = ::MapViewOfFile(mapping, FILE_MAP_COPY, 0, 0, 0);
+                if (data == NULL)
+                {
+                    return nullptr;
+                }
+                memory->m_data = static_cast<char*>(data);
+                memory->m_size = static_cast<std::size_t>(file_size.QuadPart);
+#else
+                const int fd = ::open(path.c_str(), O_RDONLY);
+                if (fd == -1)
+                {
+                    return nullptr;
+                }
+                struct stat sb = {};
+                if (::fstat(fd, &sb) == 0 && sb.st_size > 0)
+                {
+                    void* data =
+                        ::mmap(nullptr, sb.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+                    if (data != MAP_FAILED)
+                    {
+                        memory->m_data = static_cast<char*>(data);
+                        memory->m_size = static_cast<std::size_t>(sb.st_size);
+                    }
+                }
+                // the mapping stays valid after the descriptor is closed
+                ::close(fd);
+                if (memory->m_data == nullptr)
+                {
+                    return nullptr;
+                }
+#endif
+                return memory;
+            }
+
+            MappedMemory::~MappedMemory()
+            {
+#ifdef _WIN32
+                if (m_data != nullptr)
+                {
+                    ::UnmapViewOfFile(m_data);
+                }
+                if (m_mapping != nullptr)
+                {
+                    ::CloseHandle(m_mapping);
+                }
+                if (m_file != nullptr)
+                {
+                    ::CloseHandle(m_file);
+                }
+#else
+                if (m_data != nullptr)
+                {
+                    ::munmap(m_data, m_size);
+                }
+#endif
+            }
+        }
+    }
+}
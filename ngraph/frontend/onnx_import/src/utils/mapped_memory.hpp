@@ -0,0 +1,54 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <string>
+
+namespace ngraph
+{
+    namespace onnx_import
+    {
+        namespace detail
+        {
+            /// \brief  Read-only view of a whole file mapped into memory
+            ///
+            /// \note   The pages are mapped copy-on-write, so a Constant which writes to its data
+            ///         does not modify the file.
+            class MappedMemory
+            {
+            public:
+                /// \brief      Maps the file into memory
+                ///
+                /// \return     The mapped file or nullptr if the file cannot be mapped
+                static std::shared_ptr<MappedMemory> map(const std::string& path);
+
+                MappedMemory(const MappedMemory&) = delete;
+                MappedMemory& operator=(const MappedMemory&) = delete;
+                ~MappedMemory();
+
+                char* data() const { return m_data; }
+                std::size_t size() const { return m_size; }
+
+            private:
+                MappedMemory() = default;
+
+                char* m_data = nullptr;
+                std::size_t m_size = 0;
+#ifdef _WIN32
+                void* m_file = nullptr;
+                void* m_mapping = nullptr;
+#endif
+            };
+
+            /// \brief  Files mapped while importing a model, shared by all its initializers.
+            ///         The mappings themselves live as long as the Constants referencing them.
+            using MappedMemoryHandles =
+                std::shared_ptr<std::map<std::string, std::shared_ptr<MappedMemory>>>;
+        }
+    }
+}
@@ -15,11 +15,9 @@ namespace ngraph
     {
         namespace detail
         {
-            std::shared_ptr<Function>
-                convert_to_ng_function(const ONNX_NAMESPACE::ModelProto& model_proto)
+            static std::shared_ptr<Function> convert_to_ng_function(Model& model)
             {
-                Model model{model_proto};
-                Graph graph{model_proto.graph(), model};
+                Graph graph{model.get_graph(), model};
                 auto function = std::make_shared<Function>(
                     graph.get_ng_outputs(), graph.get_ng_parameters(), graph.get_name());
                 for (std::size_t i{0}; i < function->get_output_size(); ++i)
@@ -37,7 +35,20 @@ namespace ngraph
                 transform::fixup_legacy_operators(model_proto);
                 transform::update_external_data_paths(model_proto, model_path);
 
-                return detail::convert_to_ng_function(model_proto);
+                Model model{model_proto};
+                return convert_to_ng_function(model);
+            }
+
+            std::shared_ptr<Function>
+                import_onnx_model(std::shared_ptr<ONNX_NAMESPACE::ModelProto> model_proto,
+                                  const std::string& model_path)
+            {
+                transform::expand_onnx_functions(*model_proto);
+                transform::fixup_legacy_operators(*model_proto);
+                transform::update_external_data_paths(*model_proto, model_path);
+
+                Model model{std::shared_ptr<const ONNX_NAMESPACE::ModelProto>{model_proto}};
+                return convert_to_ng_function(model);
             }
         } // namespace detail
     }     // namespace onnx_import
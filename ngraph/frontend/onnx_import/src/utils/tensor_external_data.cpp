@@ -23,9 +23,9 @@ namespace ngraph
                     if (entry.key() == "location")
                         m_data_location = entry.value();
                     if (entry.key() == "offset")
-                        m_offset = std::stoi(entry.value());
+                        m_offset = std::stoull(entry.value());
                     if (entry.key() == "length")
-                        m_data_lenght = std::stoi(entry.value());
+                        m_data_lenght = std::stoull(entry.value());
                     if (entry.key() == "checksum")
                         m_sha1_digest = std::stoi(entry.value());
                 }
@@ -47,17 +47,10 @@ namespace ngraph
                 if (m_data_lenght == 0) // read entire file
                     read_data_lenght = external_data_stream.tellg();
                 else
-                    read_data_lenght = m_data_lenght;
+                    read_data_lenght = static_cast<std::streamsize>(m_data_lenght);
 
-                const auto page_size = 4096;
-                if (m_offset != 0 && m_offset % page_size != 0)
-                {
-                    NGRAPH_WARN << "offset should be multiples 4096 (page size) to enable mmap "
-                                   "support, current value is "
-                                << m_offset;
-                }
                 // default value of m_offset is 0
-                external_data_stream.seekg(m_offset, std::ios::beg);
+                external_data_stream.seekg(static_cast<std::streamoff>(m_offset), std::ios::beg);
 
                 if (m_sha1_digest != 0)
                 {
@@ -72,6 +65,40 @@ namespace ngraph
                 return read_data;
             }
 
+            std::shared_ptr<runtime::SharedBuffer<std::shared_ptr<MappedMemory>>>
+                TensorExternalData::load_external_mmap_data(const MappedMemoryHandles& cache) const
+            {
+                auto& mapped_memory = (*cache)[m_data_location];
+                if (!mapped_memory)
+                {
+                    mapped_memory = MappedMemory::map(m_data_location);
+                    if (!mapped_memory)
+                    {
+                        cache->erase(m_data_location);
+                        return nullptr;
+                    }
+                }
+
+                const uint64_t file_size = mapped_memory->size();
+                if (m_offset > file_size)
+                    throw error::invalid_external_data{*this};
+                // default value of m_data_lenght is 0, which means the rest of the file
+                const uint64_t data_lenght =
+                    (m_data_lenght == 0) ? file_size - m_offset : m_data_lenght;
+                if (data_lenght > file_size - m_offset)
+                    throw error::invalid_external_data{*this};
+
+                if (m_sha1_digest != 0)
+                {
+                    NGRAPH_WARN << "SHA1 checksum is not supported";
+                }
+
+                return std::make_shared<runtime::SharedBuffer<std::shared_ptr<MappedMemory>>>(
+                    mapped_memory->data() + m_offset,
+                    static_cast<size_t>(data_lenght),
+                    mapped_memory);
+            }
+
             std::string TensorExternalData::to_string() const
             {
                 std::stringstream s;
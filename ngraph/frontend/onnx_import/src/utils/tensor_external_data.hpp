@@ -6,6 +6,9 @@
 
 #include <onnx/onnx_pb.h>
 
+#include "ngraph/runtime/shared_buffer.hpp"
+#include "utils/mapped_memory.hpp"
+
 namespace ngraph
 {
     namespace onnx_import
@@ -27,6 +30,19 @@ namespace ngraph
                 /// \return     External binary data loaded into a std::string
                 std::string load_external_data() const;
 
+                /// \brief      Map external data from tensor passed to constructor
+                ///
+                /// \note       The file is mapped once per cache and shared by all the tensors
+                ///             stored in it. If the data lies outside of the mapped file,
+                ///             the invalid_external_data exception is thrown.
+                ///
+                /// \param[in]  cache  The files already mapped by the other tensors
+                ///
+                /// \return     Buffer referencing the mapped pages, which keeps the mapping alive,
+                ///             or nullptr if the file cannot be mapped
+                std::shared_ptr<runtime::SharedBuffer<std::shared_ptr<MappedMemory>>>
+                    load_external_mmap_data(const MappedMemoryHandles& cache) const;
+
                 /// \brief      Represets parameter of external data as string
                 ///
                 /// \return     State of TensorExternalData as string representation
@@ -34,8 +50,8 @@ namespace ngraph
 
             private:
                 std::string m_data_location{};
-                int m_offset = 0;
-                int m_data_lenght = 0;
+                uint64_t m_offset = 0;
+                uint64_t m_data_lenght = 0;
                 int m_sha1_digest = 0;
             };
         }
@@ -2,12 +2,18 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <mutex>
+#include <numeric>
+#include <set>
+#include <thread>
+
 #include "gtest/gtest.h"
 
 #include "ngraph/ngraph.hpp"
 #include "ngraph/opsets/opset5.hpp"
 #include "ngraph/pass/constant_folding.hpp"
 #include "ngraph/pass/manager.hpp"
+#include "ngraph/runtime/reference/parallel_chunks.hpp"
 #include "util/all_close_f.hpp"
 #include "util/test_tools.hpp"
 
@@ -3442,3 +3448,105 @@ TEST(constant_folding, constant_loop)
     range_test_check(result_node_0->cast_vector<float>(), expected_0);
     range_test_check(result_node_1->cast_vector<float>(), expected_1);
 }
+
+TEST(constant_folding, independent_chains)
+{
+    // chains are large enough to be folded by several threads
+    const size_t chains = 8;
+    const Shape shape{256, 128};
+    ResultVector results;
+    for (size_t c = 0; c < chains; ++c)
+    {
+        vector<float> values(shape_size(shape));
+        std::iota(values.begin(), values.end(), static_cast<float>(c));
+        auto data = make_shared<op::Constant>(element::f32, shape, values);
+        auto add = make_shared<op::v1::Add>(
+            data, op::Constant::create(element::f32, Shape{}, {1}));
+        auto transpose = make_shared<op::v1::Transpose>(
+            add, op::Constant::create(element::i64, Shape{2}, {1, 0}));
+        auto multiply = make_shared<op::v1::Multiply>(
+            transpose, op::Constant::create(element::f32, Shape{}, {2}));
+        multiply->set_friendly_name("chain_" + std::to_string(c));
+        results.push_back(make_shared<op::Result>(multiply));
+    }
+    auto f = make_shared<Function>(results, ParameterVector{});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::ConstantFolding>();
+    pass_manager.run_passes(f);
+
+    ASSERT_EQ(count_ops_of_type<op::v1::Add>(f), 0);
+    ASSERT_EQ(count_ops_of_type<op::v1::Transpose>(f), 0);
+    ASSERT_EQ(count_ops_of_type<op::v1::Multiply>(f), 0);
+    ASSERT_EQ(count_ops_of_type<op::Constant>(f), chains);
+
+    for (size_t c = 0; c < chains; ++c)
+    {
+        auto folded = as_type_ptr<op::Constant>(
+            f->get_results().at(c)->input_value(0).get_node_shared_ptr());
+        ASSERT_TRUE(folded);
+        ASSERT_EQ(folded->get_friendly_name(), "chain_" + std::to_string(c));
+        ASSERT_EQ(folded->get_shape(), (Shape{shape[1], shape[0]}));
+
+        auto values = folded->cast_vector<float>();
+        for (size_t i = 0; i < shape[1]; ++i)
+        {
+            for (size_t j = 0; j < shape[0]; ++j)
+            {
+                const float expected = (c + j * shape[1] + i + 1) * 2.0f;
+                ASSERT_FLOAT_EQ(values[i * shape[0] + j], expected);
+            }
+        }
+    }
+}
+
+TEST(constant_folding, large_row_broadcast_binop)
+{
+    // the binop is large enough to be split over threads by the folding
+    const Shape shape{1024, 256};
+    vector<float> values(shape_size(shape));
+    std::iota(values.begin(), values.end(), 0.0f);
+    vector<float> row(shape[1]);
+    std::iota(row.begin(), row.end(), 1.0f);
+    auto add = make_shared<op::v1::Add>(op::Constant::create(element::f32, shape, values),
+                                        op::Constant::create(element::f32, Shape{shape[1]}, row));
+    auto f = make_shared<Function>(add, ParameterVector{});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::ConstantFolding>();
+    pass_manager.run_passes(f);
+
+    ASSERT_EQ(count_ops_of_type<op::v1::Add>(f), 0);
+    auto folded = get_result_constant<float>(f, 0);
+    ASSERT_EQ(folded.size(), values.size());
+    for (size_t i = 0; i < folded.size(); ++i)
+    {
+        ASSERT_FLOAT_EQ(folded[i], values[i] + row[i % shape[1]]);
+    }
+}
+
+TEST(constant_folding, reference_kernels_are_single_threaded_by_default)
+{
+    // kernels also run at inference time, only the folding lets them start threads
+    std::mutex mutex;
+    std::set<std::thread::id> thread_ids;
+    auto record = [&](size_t, size_t) {
+        std::lock_guard<std::mutex> lock(mutex);
+        thread_ids.insert(std::this_thread::get_id());
+    };
+
+    runtime::reference::parallel_chunks(1 << 20, 1, record);
+    ASSERT_EQ(thread_ids.size(), 1);
+    ASSERT_EQ(*thread_ids.begin(), std::this_thread::get_id());
+
+    {
+        runtime::reference::ParallelKernels parallel_kernels(true);
+        {
+            runtime::reference::ParallelKernels single_threaded(false);
+            runtime::reference::parallel_chunks(1 << 20, 1, record);
+        }
+        ASSERT_EQ(thread_ids.size(), 1);
+        runtime::reference::parallel_chunks(1 << 20, 1, record);
+    }
+    ASSERT_EQ(thread_ids.size(), std::max(1u, std::thread::hardware_concurrency()));
+}
@@ -89,6 +89,30 @@ NGRAPH_TEST(${BACKEND_NAME}, onnx_external_two_tensors_data_in_the_same_file)
     test_case.run();
 }
 
+NGRAPH_TEST(${BACKEND_NAME}, onnx_external_two_tensors_data_share_file_mapping)
+{
+    const auto function = onnx_import::import_onnx_model(file_util::path_join(
+        SERIALIZED_ZOO,
+        "onnx/external_data/external_data_two_tensors_data_in_the_same_file.prototxt"));
+
+    const char* data_a = nullptr;
+    const char* data_b = nullptr;
+    for (const auto& op : function->get_ops())
+    {
+        if (const auto constant = as_type_ptr<op::Constant>(op))
+        {
+            if (constant->get_friendly_name() == "data_a")
+                data_a = constant->get_data_ptr<char>();
+            if (constant->get_friendly_name() == "data_b")
+                data_b = constant->get_data_ptr<char>();
+        }
+    }
+    ASSERT_NE(data_a, nullptr);
+    ASSERT_NE(data_b, nullptr);
+    // both constants reference the single mapping of the file at their offsets
+    EXPECT_EQ(data_b - data_a, 4096);
+}
+
 NGRAPH_TEST(${BACKEND_NAME}, onnx_external_invalid_external_data_exception)
 {
     try
@@ -11,7 +11,9 @@
 
 #include "ngraph/graph_util.hpp"
 #include "ngraph/ngraph.hpp"
+#include "ngraph/pass/graph_rewrite.hpp"
 #include "ngraph/pass/manager.hpp"
+#include "ngraph/pattern/op/wrap_type.hpp"
 #include "util/test_tools.hpp"
 
 using namespace ngraph;
@@ -42,3 +44,91 @@ namespace
         bool run_on_function(std::shared_ptr<ngraph::Function> /* f */) override { return false; }
     };
 }
+
+TEST(pass_manager, ordered_ops_cache_rebuilt_after_replace)
+{
+    auto param = make_shared<op::Parameter>(element::f32, Shape{2, 3});
+    auto relu = make_shared<op::Relu>(param);
+    auto abs = make_shared<op::Abs>(relu);
+    auto f = make_shared<Function>(abs, ParameterVector{param});
+
+    EXPECT_EQ(f->get_ordered_ops(), f->get_ordered_ops());
+    EXPECT_EQ(f->get_ordered_ops().size(), 4);
+
+    auto neg = make_shared<op::Negative>(relu);
+    replace_node(relu, neg);
+    neg->input(0).replace_source_output(relu);
+    auto sorted = f->get_ordered_ops();
+    EXPECT_EQ(sorted.size(), 5);
+    EXPECT_TRUE(validate_list(sorted));
+}
+
+TEST(pass_manager, ordered_ops_cache_does_not_keep_replaced_nodes)
+{
+    auto param = make_shared<op::Parameter>(element::f32, Shape{2, 3});
+    auto relu = make_shared<op::Relu>(param);
+    auto abs = make_shared<op::Abs>(relu);
+    auto f = make_shared<Function>(abs, ParameterVector{param});
+    EXPECT_EQ(f->get_ordered_ops().size(), 4);
+
+    weak_ptr<Node> replaced = relu;
+    replace_node(relu, make_shared<op::Negative>(param));
+    relu.reset();
+    EXPECT_TRUE(replaced.expired());
+
+    auto sorted = f->get_ordered_ops();
+    EXPECT_EQ(sorted.size(), 4);
+    EXPECT_TRUE(validate_list(sorted));
+}
+
+TEST(pass_manager, validate_changed_nodes_propagates_downstream)
+{
+    auto param = make_shared<op::Parameter>(element::f32, Shape{2, 3});
+    auto relu = make_shared<op::Relu>(param);
+    auto abs = make_shared<op::Abs>(relu);
+    auto f = make_shared<Function>(abs, ParameterVector{param});
+    f->validate_nodes_and_infer_types();
+
+    f->replace_parameter(0, make_shared<op::Parameter>(element::f32, Shape{4, 5}));
+    f->validate_changed_nodes_and_infer_types();
+    EXPECT_EQ(relu->get_output_shape(0), (Shape{4, 5}));
+    EXPECT_EQ(abs->get_output_shape(0), (Shape{4, 5}));
+    EXPECT_EQ(f->get_output_shape(0), (Shape{4, 5}));
+}
+
+namespace
+{
+    class ConvertToF16BeforeAbs : public ngraph::pass::MatcherPass
+    {
+    public:
+        ConvertToF16BeforeAbs()
+        {
+            auto convert = pattern::wrap_type<op::Convert>();
+            auto abs = pattern::wrap_type<op::Abs>({convert});
+            register_matcher(make_shared<pattern::Matcher>(abs, "ConvertToF16BeforeAbs"),
+                             [convert](pattern::Matcher& m) {
+                                 auto matched = as_type_ptr<op::Convert>(
+                                     m.get_pattern_value_map().at(convert).get_node_shared_ptr());
+                                 matched->set_convert_element_type(element::f16);
+                                 return true;
+                             });
+        }
+    };
+}
+
+TEST(pass_manager, validate_changed_nodes_after_matched_node_modified)
+{
+    auto param = make_shared<op::Parameter>(element::f32, Shape{2, 3});
+    auto convert = make_shared<op::Convert>(param, element::f32);
+    auto abs = make_shared<op::Abs>(convert);
+    auto f = make_shared<Function>(abs, ParameterVector{param});
+    f->validate_nodes_and_infer_types();
+
+    // the callback modifies the matched Convert, not the Abs root of the pattern
+    pass::GraphRewrite rewrite;
+    rewrite.add_matcher<ConvertToF16BeforeAbs>();
+    EXPECT_TRUE(rewrite.run_on_function(f));
+    f->validate_changed_nodes_and_infer_types();
+    EXPECT_EQ(convert->get_output_element_type(0), element::f16);
+    EXPECT_EQ(abs->get_output_element_type(0), element::f16);
+}